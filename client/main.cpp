@@ -3,7 +3,9 @@
 #include <algorithm>
 #include <cctype>
 #include <cmath>
+#include <fstream>
 #include <iostream>
+#include <iterator>
 #include <pthread.h>
 #include <numeric>
 #include <deque>
@@ -23,6 +25,7 @@
 
 auto g_stream_overlay_alpha = 0.0F;
 auto g_slice_overlay_alpha  = 0.0F;
+auto g_send_map = false;
 
 auto key_callback(GLFWwindow* window, int key, int, int action, int) -> void
 {
@@ -39,6 +42,9 @@ auto key_callback(GLFWwindow* window, int key, int, int action, int) -> void
 			case GLFW_KEY_2:
 				g_slice_overlay_alpha = g_slice_overlay_alpha > 0.0F ? 0.0F : 1.0F;
 				break;
+			case GLFW_KEY_M:
+				g_send_map = true;
+				break;
 		}
 	}
 }
@@ -113,27 +119,41 @@ auto create_render_commands(const pose_t& pose, uint32_t stream_bitmask) -> std:
 	return cmds;
 }
 
+using slice_ranges_t = std::array<uint32_t, config::common::num_slices>;
+
 struct stream_render_t
 {
 	uint32_t id {};
-	uint32_t slice_bitmask {};
 };
 
-auto create_stream_render_data(
-	uint32_t stream_bitmask,
-	const std::array<uint32_t, config::client::num_streams>& slice_bitmasks
-) -> std::vector<stream_render_t>
+auto create_stream_render_data(uint32_t stream_bitmask) -> std::vector<stream_render_t>
 {
 	std::vector<stream_render_t> stream_render_data;
 	while (stream_bitmask > 0)
 	{
 		const auto stream_id = static_cast<uint32_t>(std::countr_zero(stream_bitmask));
-		stream_render_data.push_back({stream_id, slice_bitmasks[stream_id]});
+		stream_render_data.push_back({stream_id});
 		stream_bitmask &= ~(1U << stream_id);
 	}
 	return stream_render_data;
 }
 
+// Columns decoded by each slice of the active streams, as slice widths vary, so the shader overlays the columns that were lost
+auto create_slice_range_data(
+	uint32_t stream_bitmask,
+	const std::array<slice_ranges_t, config::client::num_streams>& slice_ranges
+) -> std::vector<uint32_t>
+{
+	std::vector<uint32_t> slice_range_data;
+	while (stream_bitmask > 0)
+	{
+		const auto stream_id = std::countr_zero(stream_bitmask);
+		slice_range_data.insert(std::end(slice_range_data), std::cbegin(slice_ranges[stream_id]), std::cend(slice_ranges[stream_id]));
+		stream_bitmask &= ~(1U << stream_id);
+	}
+	return slice_range_data;
+}
+
 auto create_slice_render_data(uint32_t stream_bitmask) -> glm::vec4
 {
 	const auto num_active_streams = std::popcount(stream_bitmask);
@@ -164,11 +184,13 @@ auto log_result(float frame_time, const stream_t::result_t& r) -> void
 			if (r.stream_bitmask & (1 << i)) // Only log data for completed streams
 			{
 				fmt::print(
-					"{:1d}) RTT {:5.1f} | Render {:4.1f} | Stream {:4.1f} | CR {:4.2f}\n",
+					"{:1d}) RTT {:5.1f} | Render {:4.1f} (Floor {:4.1f}) | Stream {:4.1f} (Pacing {:4.1f}) | CR {:4.2f}\n",
 					i,
 					r.stats[i].pose_rtt_ns * 1e-6,
 					r.stats[i].render_time_us * 1e-3,
+					r.stats[i].floor_time_us * 1e-3,
 					r.stats[i].stream_time_us * 1e-3,
+					r.stats[i].pacing_delay_us * 1e-3,
 					r.stats[i].num_enc_bytes / static_cast<float>(config::common::screen_buffer_size)
 				);
 			}
@@ -244,19 +266,28 @@ auto main() -> int
 	const auto stream_render_buffer = gl::create_buffer<stream_render_t>(config::client::num_streams);
 	gl::bind_buffer(stream_render_buffer, 0);
 
+	const auto slice_range_buffer = gl::create_buffer<uint32_t>(config::client::num_streams * config::common::num_slices);
+	gl::bind_buffer(slice_range_buffer, 1);
+
 	stream_t stream {config::client::server_infos, screen_buffer.data()};
 
+	std::vector<uint8_t> map_file;
+	if (config::client::map_path[0] != '\0')
+	{
+		std::ifstream file {config::client::map_path, std::ios::binary};
+		map_file.assign(std::istreambuf_iterator<char> {file}, std::istreambuf_iterator<char> {});
+		if (map_file.empty()) std::cerr << "Failed to read map " << config::client::map_path << '\n';
+		g_send_map = !map_file.empty();
+	}
+
 	std::deque<double> frame_time_deque (10, 0);
 
 	uint16_t frame_num = 0;
 	auto pose = pose_t {0, frame_num, {22.0F, 11.05F}, {-1, 0}, {0, -1}};
 
 	uint32_t prev_stream_bitmask {config::client::all_stream_bitmask};
-	std::array<uint32_t, config::client::num_streams> prev_slice_bitmasks {};
-	std::fill(
-		std::begin(prev_slice_bitmasks),
-		std::end(prev_slice_bitmasks),
-		config::common::all_slice_bitmask);
+	std::array<slice_ranges_t, config::client::num_streams> prev_slice_ranges {};
+	for (auto&& slice_ranges : prev_slice_ranges) slice_ranges[0] = config::common::screen_width << 16;
 
 	constexpr auto slice_texture_data = create_slice_texture_data();
 
@@ -276,6 +307,12 @@ auto main() -> int
 		const auto avg_frame_rate = frame_time_deque.size() / std::reduce(std::cbegin(frame_time_deque), std::cend(frame_time_deque));
 		ts_prev = ts_now;
 
+		if (g_send_map && !map_file.empty())
+		{
+			stream.send_map(map_file);
+			g_send_map = false;
+		}
+
 		update_pose(window, pose);
 		pose.frame_num = frame_num++;
 		const auto cmds = create_render_commands(pose, prev_stream_bitmask);
@@ -283,9 +320,12 @@ auto main() -> int
 		stream.send(cmds);
 
 		const auto num_active_streams = std::popcount(prev_stream_bitmask);
-		const auto stream_render_data = create_stream_render_data(prev_stream_bitmask, prev_slice_bitmasks);
+		const auto stream_render_data = create_stream_render_data(prev_stream_bitmask);
 		gl::update_data(
 			stream_render_buffer, stream_render_data.data(), stream_render_data.size());
+		const auto slice_range_data = create_slice_range_data(prev_stream_bitmask, prev_slice_ranges);
+		gl::update_data(
+			slice_range_buffer, slice_range_data.data(), slice_range_data.size());
 		const auto slice_render_data = create_slice_render_data(prev_stream_bitmask);
 
 		const auto title = fmt::format("{} | {:.1f} fps | {:d} server(s)", config::client::name, avg_frame_rate, num_active_streams);
@@ -310,8 +350,8 @@ auto main() -> int
 			prev_stream_bitmask = result.stream_bitmask;
 			std::transform(
 				std::cbegin(result.stats), std::cend(result.stats),
-				std::begin(prev_slice_bitmasks),
-				[](const auto& s) { return s.slice_bitmask; });
+				std::begin(prev_slice_ranges),
+				[](const auto& s) { return s.slice_ranges; });
 		}
 
 		glUseProgram(program.handle);
@@ -333,6 +373,7 @@ auto main() -> int
 		glfwPollEvents();
 	}
 
+	gl::delete_buffer(slice_range_buffer);
 	gl::delete_buffer(stream_render_buffer);
 	gl::delete_buffer(index_buffer);
 	gl::delete_texture(screen_texture);
@@ -2,6 +2,7 @@
 
 #include <array>
 #include <atomic>
+#include <bitset>
 #include <cmath>
 #include <condition_variable>
 #include <cstring> // memset
@@ -25,6 +26,12 @@
 #include "common/protocol.hpp"
 #include "types.hpp"
 
+// Servers are identified by address and port so that several can share one address (e.g. host servers on loopback)
+constexpr auto make_server_key(uint32_t addr, uint16_t port) -> uint64_t
+{
+	return (static_cast<uint64_t>(addr) << 16) | port;
+}
+
 auto get_timestamp_ns() -> uint64_t
 {
 	return std::chrono::duration_cast<std::chrono::nanoseconds>(
@@ -45,6 +52,7 @@ public:
 	stream_t(const server_info_t* server_infos, uint8_t* screen_buffer);
 
 	auto send(const std::vector<render_command_t>& cmds) -> void;
+	auto send_map(const std::vector<uint8_t>& map_file) -> void;
 	auto recv() -> result_t;
 
 	template <typename T>
@@ -60,14 +68,16 @@ private:
 	int sock {};
 	sockaddr_in client_addr;
 	std::vector<sockaddr_in> server_addrs;
-	std::unordered_map<uint32_t, int> server_id_map;
+	std::unordered_map<uint64_t, int> server_id_map;
 
 	// System state
 	uint32_t active_stream_bitmask {};
 	std::atomic_flag drop_incoming_pkts;
 	std::atomic_flag is_running; // TODO: Use std::recv_token
 	std::array<uint8_t, config::common::pkt_buffer_size> pkt_buffer;
-	std::array<std::array<uint32_t, config::common::num_slices>, config::client::num_streams> pkt_bitmasks;
+	int pkt_size {0};
+	using pkt_bitmask_t = std::bitset<protocol::max_slice_pkts>;
+	std::array<std::array<pkt_bitmask_t, config::common::num_slices>, config::client::num_streams> pkt_bitmasks;
 
 	// For signal early exit
 	bool all_stream_ready {false};
@@ -89,9 +99,12 @@ stream_t::~stream_t()
 stream_t::stream_t(const server_info_t* server_infos, uint8_t* screen_buffer)
 	: screen_buffer {screen_buffer}
 {
-	enc_buffer.resize(config::common::screen_buffer_size * config::client::num_streams);
+	// Padded for the full payload of the last packet of the last slice
+	enc_buffer.resize(
+		config::common::max_enc_slice_buffer_size * config::common::num_slices * config::client::num_streams +
+		config::common::pkt_buffer_size);
 
-	for (auto&& x : pkt_bitmasks) std::fill(std::begin(x), std::end(x), 0);
+	for (auto&& x : pkt_bitmasks) std::fill(std::begin(x), std::end(x), pkt_bitmask_t {});
 
 	sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
 	if (sock < 0) throw std::runtime_error {"Failed to create stream socket!"};
@@ -119,7 +132,7 @@ stream_t::stream_t(const server_info_t* server_infos, uint8_t* screen_buffer)
 		server_addr.sin_addr.s_addr = htonl(server_infos[i].addr);
 		server_addr.sin_port        = htons(server_infos[i].port);
 		server_addrs.push_back(server_addr);
-		server_id_map.insert({server_infos[i].addr, i});
+		server_id_map.insert({make_server_key(server_infos[i].addr, server_infos[i].port), i});
 	}
 
 	std::memset(&client_addr, 0, sizeof(client_addr));
@@ -150,8 +163,12 @@ auto stream_t::send(const std::vector<render_command_t>& cmds) -> void
 	// Reset system state
 	active_stream_bitmask = 0;
 	result.stream_bitmask = config::client::all_stream_bitmask;
-	for (auto&& x : result.stats) x.slice_bitmask = 0;
-	for (auto&& x : pkt_bitmasks) std::fill(std::begin(x), std::end(x), 0);
+	for (auto&& x : result.stats)
+	{
+		x.slice_bitmask = 0;
+		x.slice_ranges.fill(0);
+	}
+	for (auto&& x : pkt_bitmasks) std::fill(std::begin(x), std::end(x), pkt_bitmask_t {});
 	{
 		std::lock_guard lock {all_stream_ready_mutex};
 		all_stream_ready = false;
@@ -162,6 +179,34 @@ auto stream_t::send(const std::vector<render_command_t>& cmds) -> void
 	for (auto i = 0; i < cmds.size(); i++) send_render_command(cmds[i], i);
 }
 
+// Push a map file to every server, in protocol::map_chunk_t datagrams
+// Servers load the map between frames once all chunks have arrived
+auto stream_t::send_map(const std::vector<uint8_t>& map_file) -> void
+{
+	std::array<uint8_t, sizeof(protocol::map_chunk_t) + protocol::max_map_chunk_size> chunk_buffer;
+
+	for (auto offset = 0; offset < static_cast<int>(map_file.size()); offset += protocol::max_map_chunk_size)
+	{
+		const auto chunk_size = std::min<int>(protocol::max_map_chunk_size, map_file.size() - offset);
+
+		protocol::map_chunk_t chunk;
+		chunk.file_size = map_file.size();
+		chunk.offset    = offset;
+		const auto payload = protocol::write(chunk, chunk_buffer.data());
+		std::memcpy(payload, map_file.data() + offset, chunk_size);
+
+		for (const auto& server_addr : server_addrs)
+		{
+			const auto nbytes = sendto(sock, chunk_buffer.data(), sizeof(chunk) + chunk_size, 0,
+				reinterpret_cast<const sockaddr*>(&server_addr), sizeof(server_addr));
+			if (nbytes < 0) std::cerr << "Failed to send map!\n";
+		}
+
+		// Do not overrun the receive buffers of the servers
+		std::this_thread::sleep_for(std::chrono::microseconds(200));
+	}
+}
+
 auto stream_t::recv() -> result_t
 {
 	// Halt processing incoming packets
@@ -202,14 +247,15 @@ auto stream_t::recv_packet() -> int
 		sock, pkt_buffer.data(), pkt_buffer.size(), 0,
 		reinterpret_cast<struct sockaddr*>(&server_addr), &server_addr_size);
 
-	if (nbytes < static_cast<int>(pkt_buffer.size()))
+	if (nbytes < static_cast<int>(sizeof(protocol::pkt_info_t)))
 	{
 		std::cerr << "Failed to recv frame packet!\n";
 		return -1;
 	}
+	pkt_size = nbytes;
 
-	const auto server_ip = ntohl(server_addr.sin_addr.s_addr);
-	return server_id_map.at(server_ip);
+	const auto server_key = make_server_key(ntohl(server_addr.sin_addr.s_addr), ntohs(server_addr.sin_port));
+	return server_id_map.at(server_key);
 }
 
 auto stream_t::pkt_recv_worker_task() -> void
@@ -225,38 +271,69 @@ auto stream_t::pkt_recv_worker_task() -> void
 		pkt_ptr = protocol::read(pkt_ptr, pkt_info);
 		//std::clog << pkt_info << '\n';
 
+		// Packets are as long as their payload, plus the frame info on the last packet of a frame
+		const auto frame_end = pkt_info.slice_id == (config::common::num_slices - 1);
+		const auto is_frame_end_pkt = frame_end && pkt_info.slice_end;
+		const auto expected_pkt_size = sizeof(pkt_info) + pkt_info.payload_size + (is_frame_end_pkt ? sizeof(protocol::frame_info_t) : 0);
+		if (pkt_size != static_cast<int>(expected_pkt_size))
+		{
+			std::cerr << "Dropped frame packet of " << pkt_size << " bytes, expected " << expected_pkt_size << '\n';
+			continue;
+		}
+
 		// Determine precise location in buffer to store packet
 		// Ignore packets with no encoded data
+		// Slices have varying widths, so every encoded slice gets room for the widest one
 		constexpr auto max_pkt_payload_size = config::common::pkt_buffer_size - sizeof(pkt_info);
 		const auto stream_offset = stream_id * config::common::screen_buffer_size;
-		const auto slice_offset  = pkt_info.slice_id * config::common::slice_buffer_size;
-		const auto pkt_offset    = pkt_info.pkt_id   * max_pkt_payload_size;
-		const auto enc_ptr       = enc_buffer.data() + stream_offset + slice_offset + pkt_offset;
-		if (pkt_info.has_data) protocol::read_payload(pkt_ptr, max_pkt_payload_size, enc_ptr);
+		const auto enc_offset    = (stream_id * config::common::num_slices + pkt_info.slice_id) * config::common::max_enc_slice_buffer_size;
+		const auto pkt_offset    = pkt_info.pkt_id * max_pkt_payload_size;
+		if (pkt_offset + pkt_info.payload_size > config::common::max_enc_slice_buffer_size)
+		{
+			std::cerr << "Dropped packet " << static_cast<int>(pkt_info.pkt_id) << " past the end of slice " << pkt_info.slice_id << '\n';
+			continue;
+		}
+		if (pkt_info.slice_id >= config::common::num_slices || pkt_info.slice_start >= config::common::screen_width)
+		{
+			std::cerr << "Dropped packet of slice " << pkt_info.slice_id << " at column " << pkt_info.slice_start << " outside the screen\n";
+			continue;
+		}
+		const auto enc_ptr       = enc_buffer.data() + enc_offset + pkt_offset;
+		if (pkt_info.has_data) pkt_ptr = protocol::read_payload(pkt_ptr, pkt_info.payload_size, enc_ptr);
 
 		// Mark packet received for a slice
-		pkt_bitmasks[stream_id][pkt_info.slice_id] |= (1U << pkt_info.pkt_id);
+		pkt_bitmasks[stream_id][pkt_info.slice_id].set(pkt_info.pkt_id);
 
 		// Mark slice complete if all of its packets have been received
-		const auto all_slice_pkts_bitmask = (1U << (pkt_info.pkt_id + 1)) - 1U;
+		const auto all_slice_pkts_bitmask = ~pkt_bitmask_t {} >> (protocol::max_slice_pkts - 1 - pkt_info.pkt_id);
 		const auto all_slice_pkts_recvd   = pkt_bitmasks[stream_id][pkt_info.slice_id] == all_slice_pkts_bitmask;
 		if (pkt_info.slice_end && all_slice_pkts_recvd)
 		{
-			result.stats[stream_id].slice_bitmask |= (1U << pkt_info.slice_id);
-
 			// Decode slice once all packets have been received
-			auto enc_ptr = enc_buffer.data() + stream_offset + slice_offset;
-			auto out_ptr = screen_buffer     + stream_offset + slice_offset;
-			result.stats[stream_id].num_enc_bytes += codec::decode_slice(enc_ptr, out_ptr);
+			// The slice must end within its packets and within the screen, or it is lost
+			auto enc_ptr = enc_buffer.data() + enc_offset;
+			auto out_ptr = screen_buffer     + stream_offset + pkt_info.slice_start * config::common::screen_height;
+			const auto enc_size = static_cast<int>(pkt_offset + pkt_info.payload_size);
+			const auto max_columns = config::common::screen_width - pkt_info.slice_start;
+			const auto codec_id = static_cast<codec::codec_id_t>(pkt_info.codec_id);
+			const auto num_columns = codec::decode_slice(enc_ptr, enc_size, out_ptr, codec_id, config::common::screen_height, max_columns);
+			if (num_columns < 0)
+			{
+				std::cerr << "Dropped corrupt slice " << pkt_info.slice_id << '\n';
+			}
+			else
+			{
+				result.stats[stream_id].slice_bitmask |= (1U << pkt_info.slice_id);
+				result.stats[stream_id].slice_ranges[pkt_info.slice_id] = pkt_info.slice_start | ((pkt_info.slice_start + num_columns) << 16);
+				result.stats[stream_id].num_enc_bytes += enc_size;
+			}
 		}
 
 		// Unpack frame stats from the last packet of the frame
-		const auto frame_end = pkt_info.slice_id == (config::common::num_slices - 1);
-		const auto is_frame_end_pkt = frame_end && pkt_info.slice_end;
 		if (is_frame_end_pkt)
 		{
 			protocol::frame_info_t frame_info;
-			protocol::read(pkt_buffer.data() + config::common::pkt_buffer_size - sizeof(frame_info), frame_info);
+			protocol::read(pkt_ptr, frame_info);
 
 			const auto pose_recv_timestamp = get_timestamp_ns();
 			const auto pose_rtt_ns = pose_recv_timestamp - frame_info.timestamp;
@@ -264,6 +341,8 @@ auto stream_t::pkt_recv_worker_task() -> void
 			result.stats[stream_id].pose_rtt_ns    = pose_rtt_ns;
 			result.stats[stream_id].render_time_us = frame_info.render_time_us;
 			result.stats[stream_id].stream_time_us = frame_info.stream_time_us;
+			result.stats[stream_id].pacing_delay_us = frame_info.pacing_delay_us;
+			result.stats[stream_id].floor_time_us  = frame_info.render_stats.floor_time_us;
 
 			active_stream_bitmask |= (1U << stream_id);
 		}
@@ -9,7 +9,7 @@ constexpr auto shader_vs = R"glsl(
 out VS_TO_FS
 {
     vec2 texcoord;
-    float slice_overlay_alpha;
+    flat  uint frame_id;
     flat  uint texture_id;
 } vs_to_fs;
 
@@ -24,12 +24,10 @@ vec2 quad_coords[4] = vec2[](
 layout(location = 0) uniform  vec4 u_slice_render_data;
 layout(location = 1) uniform  vec4 u_slice_texture_data;
 layout(location = 2) uniform   int u_num_slices;
-layout(location = 3) uniform float u_slice_overlay_alpha;
 
 struct stream_render_t
 {
     uint id;
-    uint slice_bitmask;
 };
 
 layout(binding = 0, std430) readonly buffer stream_render_buffer
@@ -59,12 +57,9 @@ void main()
 
     gl_Position = slice_render_T * vec4(quad_coord, 0, 1) * 2 - 1;
     vs_to_fs.texcoord = vec2(1 - texcoord.y, texcoord.x); // Transpose and flip texture
+    vs_to_fs.frame_id = uint(frame_id);
     vs_to_fs.texture_id = stream_render_data[frame_id].id;
 
-    const uint slice_bitmask = stream_render_data[frame_id].slice_bitmask;
-    const uint slice_present = (slice_bitmask >> slice_id) & 1U;
-    vs_to_fs.slice_overlay_alpha = mix(u_slice_overlay_alpha, 0.0F, slice_present);
-
     /*
     // Screen-space triangle
     // Render without index buffer
@@ -92,7 +87,7 @@ constexpr auto shader_fs = R"glsl(
 in VS_TO_FS
 {
     vec2 texcoord;
-    float slice_overlay_alpha;
+    flat  uint frame_id;
     flat  uint texture_id;
 } vs_to_fs;
 
@@ -103,8 +98,16 @@ vec3 overlay_color[2] = vec3[](
 
 out vec4 out_color;
 
+layout(location = 2) uniform   int u_num_slices;
+layout(location = 3) uniform float u_slice_overlay_alpha;
 layout(location = 4) uniform float u_stream_overlay_alpha;
 
+// Columns decoded by each slice, first | (last + 1) << 16
+layout(binding = 1, std430) readonly buffer slice_range_buffer
+{
+    uint slice_ranges[];
+};
+
 layout(binding = 0) uniform usampler2DArray in_texture;
 
 vec3 unpack_rgb233(uint color)
@@ -115,13 +118,27 @@ vec3 unpack_rgb233(uint color)
         (((color & 0x07U) >> 0) << 5) / 255.0);
 }
 
+// Columns no received slice covers are left from an earlier frame
+bool is_column_lost(uint column)
+{
+    for (int i = 0; i < u_num_slices; i++)
+    {
+        const uint range = slice_ranges[vs_to_fs.frame_id * u_num_slices + i];
+        if (column >= (range & 0xFFFFU) && column < (range >> 16)) return false;
+    }
+    return true;
+}
+
 void main()
 {
+    const uint column = uint(vs_to_fs.texcoord.y * textureSize(in_texture, 0).y);
+    const float slice_overlay_alpha = is_column_lost(column) ? u_slice_overlay_alpha : 0.0F;
+
     const vec3 color = unpack_rgb233(texture(in_texture, vec3(vs_to_fs.texcoord, vs_to_fs.texture_id)).r);
     const vec3 final_color = mix(
         mix(color, overlay_color[vs_to_fs.texture_id], u_stream_overlay_alpha),
         SLICE_OVERLAY_COLOR,
-        vs_to_fs.slice_overlay_alpha);
+        slice_overlay_alpha);
     out_color = vec4(final_color, 1);
 }
 
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
 
 #include "glm/vec2.hpp"
 
+#include "common/config.hpp"
+
 struct pose_t
 {
 	uint64_t  timestamp {0};
@@ -37,6 +40,11 @@ struct stats_t
 	uint64_t pose_rtt_ns    {0};
 	uint32_t render_time_us {0};
 	uint32_t stream_time_us {0};
+	uint32_t pacing_delay_us {0};
+	uint32_t floor_time_us  {0};
 	uint32_t slice_bitmask  {0};
 	uint32_t num_enc_bytes  {0};
+
+	// Columns of each decoded slice, first | (last + 1) << 16, 0 for lost slices
+	std::array<uint32_t, config::common::num_slices> slice_ranges {};
 };
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <algorithm>
+#include <bit>
 #include <cassert>
+#include <cstdint>
 #include <vector>
 #include <stdexcept>
 
@@ -17,7 +20,9 @@ public:
 
 	auto write(uint32_t value, int count) -> void
 	{
-		// TODO: throw bitstream overflow if it attempts to exceed capacity
+#if defined(__cpp_exceptions)
+		if (num_bits + count > 8 * capacity) throw std::runtime_error {"bitstream overflow"};
+#endif
 		assert(count <= max_write_cache_bits);
 		const auto num_free_bits = max_write_cache_bits - num_write_cache_bits;
 
@@ -39,21 +44,27 @@ public:
 
 	auto write(int bit) -> void
 	{
-		// TODO: throw bitstream overflow if it attempts to exceed capacity
+#if defined(__cpp_exceptions)
+		if (num_bits == 8 * capacity) throw std::runtime_error {"bitstream overflow"};
+#endif
 		write_cache = (write_cache << 1) | (bit & 1);
 		num_bits++;
 		num_write_cache_bits++;
 		if (num_write_cache_bits == max_write_cache_bits) flush_write_cache();
 	}
 
+	// Pad the last byte with zeros and write out the bytes holding bits, so streams can follow each other byte-aligned
 	auto flush() -> void
 	{
-		const auto num_pad_bits = max_write_cache_bits - num_write_cache_bits;
-		write_cache <<= num_pad_bits;
-		flush_write_cache();
-		num_bits += num_write_cache_bits;
+		const auto num_bytes = (num_write_cache_bits + 7) / 8;
+		for (auto i = 0; i < num_bytes; i++)
+		{
+			const auto shift = num_write_cache_bits - 8 * (i + 1);
+			buffer[write_buffer_pos++] = ((shift >= 0) ? (write_cache >> shift) : (write_cache << -shift)) & 0xFF;
+		}
+		num_bits += 8 * num_bytes - num_write_cache_bits;
 		write_cache = 0;
-		num_write_cache_bits++;
+		num_write_cache_bits = 0;
 	}
 
 	auto read() -> int
@@ -69,6 +80,55 @@ public:
 		return bit;
 	}
 
+	// Read up to 32 bits, taking as many as possible from the read cache at once
+	auto read(int count) -> uint32_t
+	{
+#if defined(__cpp_exceptions)
+		if (num_bits < count) throw std::runtime_error {"bitstream underflow"};
+#endif
+		auto value = uint64_t {0};
+		while (count > 0)
+		{
+			if (num_read_cache_bits == max_read_cache_bits) fetch_read_cache();
+			const auto n = std::min<int>(count, max_read_cache_bits - num_read_cache_bits);
+			read_cache <<= n;
+			value = (value << n) | ((read_cache >> max_read_cache_bits) & ((uint64_t {1} << n) - 1));
+			num_bits -= n;
+			num_read_cache_bits += n;
+			count -= n;
+		}
+		return static_cast<uint32_t>(value);
+	}
+
+	// Skip 0 bits up to the next 1 bit and that one, returning the number of 0 bits, for prefix codes
+	// Returns -1 if the stream ends before a 1 bit, as received streams can be corrupt
+	auto read_unary() -> int
+	{
+		auto count = 0;
+		for (;;)
+		{
+			if (num_bits <= 0) return -1;
+			if (num_read_cache_bits == max_read_cache_bits) fetch_read_cache();
+
+			// Unread bits are the top bits of the lower half of the read cache
+			const auto num_cached = static_cast<int>(max_read_cache_bits) - num_read_cache_bits;
+			const auto num_zeros = std::min(std::countl_zero(static_cast<uint32_t>(read_cache)), num_cached);
+			const auto n = (num_zeros < num_cached) ? num_zeros + 1 : num_zeros;
+			read_cache <<= n;
+			num_bits -= n;
+			num_read_cache_bits += n;
+			count += num_zeros;
+			if (num_zeros < num_cached) return count;
+		}
+	}
+
+	// Read num_bytes that are already in the buffer, such as a received stream
+	auto assign(int num_bytes) -> void
+	{
+		clear();
+		num_bits = 8 * num_bytes;
+	}
+
 	auto clear() -> void
 	{
 		num_bits = 0;
@@ -100,14 +160,23 @@ private:
 		num_write_cache_bits = 0;
 	}
 
+	// Bytes past capacity read as 0, as streams end anywhere in their last word and the buffer may end there too
 	auto fetch_read_cache() -> void
 	{
 		//read_cache = buffer[read_buffer_pos++];
-		read_cache =
-			(buffer[read_buffer_pos + 0] << 24) |
-			(buffer[read_buffer_pos + 1] << 16) |
-			(buffer[read_buffer_pos + 2] <<  8) |
-			(buffer[read_buffer_pos + 3] <<  0);
+		if (read_buffer_pos + 4 <= capacity)
+		{
+			read_cache =
+				(buffer[read_buffer_pos + 0] << 24) |
+				(buffer[read_buffer_pos + 1] << 16) |
+				(buffer[read_buffer_pos + 2] <<  8) |
+				(buffer[read_buffer_pos + 3] <<  0);
+		}
+		else
+		{
+			read_cache = 0;
+			for (auto i = 0; i < 4; i++) read_cache = (read_cache << 8) | ((read_buffer_pos + i < capacity) ? buffer[read_buffer_pos + i] : 0);
+		}
 		read_buffer_pos += 4;
 		num_read_cache_bits = 0;
 	}
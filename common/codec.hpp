@@ -1,66 +1,683 @@
 #pragma once
 
+#include <algorithm>
+#include <bit>
 #include <cstdint>
+#include <cstring>
+
+#include "bitstream.hpp"
 
 namespace codec
 {
 
-constexpr auto stream_end_symbol = 0xFF;
+// Pairs with a run length of 0 never occur as runs and escape other tokens
+constexpr auto escape_run_len = 0;
 
-auto encode_slice(const uint8_t* in_buffer, uint8_t* enc_buffer, int width, int height) -> int
+// (literal_escape, 0), n as a run length, then n raw pixels
+constexpr auto literal_escape = 0x00;
+
+// (stream_end_escape, 0) ends the slice
+constexpr auto stream_end_escape = 0x01;
+constexpr auto stream_end_size = 2;
+
+// (repeat_escape, 0), n repeats the whole column n columns back in the slice
+constexpr auto repeat_escape = 0x02;
+constexpr auto repeat_size = 3;
+constexpr auto max_repeat_distance = 2; // Farther columns rarely repeat, 4 saves 0.25% more bytes
+
+// (copy_escape, 0), then a run length: copies that many pixels from the same rows of the previous column
+constexpr auto copy_escape = 0x03;
+
+// Runs of up to 254 pixels are (value, length) pairs, and longer runs (value, wide_run_len) followed by their length
+// in 16 bits little endian, so columns of any height are runs and a slice never looks like it ended early
+constexpr auto wide_run_len = 0xFF;
+constexpr auto max_run_len = 0xFFFF;
+
+constexpr auto get_run_size(int run_len) -> int
 {
-	auto dst_ptr = enc_buffer;
-	for (auto i = 0; i < height; i++)
+	return (run_len < wide_run_len) ? 2 : 4;
+}
+
+// Rows of the tallest frames coded
+constexpr auto max_column_size = 1080;
+
+// Literals of columns of wide_run_len pixels or more always write their length in the wide form,
+// so that the header has a fixed size before the pixels of the column are known
+constexpr auto get_literal_header_size(int column_size) -> int
+{
+	return 1 + get_run_size(column_size);
+}
+
+// Encoded bytes of a column of column_size pixels at most, as columns fall back to a literal
+constexpr auto get_max_column_size(int column_size) -> int
+{
+	return column_size + get_literal_header_size(column_size);
+}
+
+// Encoded bytes of num_columns columns of column_size pixels at most, including the end marker
+constexpr auto get_max_encoded_size(int num_columns, int column_size) -> int
+{
+	return num_columns * get_max_column_size(column_size) + stream_end_size;
+}
+
+// Bytes of the column history of run_encoder_t, a slot for the current column and every column it may repeat
+constexpr auto get_column_history_size(int column_size) -> int
+{
+	return (max_repeat_distance + 1) * get_max_column_size(column_size);
+}
+
+// Length of the run at src_ptr, after its value, and move src_ptr past it
+inline auto read_run_len(const uint8_t*& src_ptr) -> int
+{
+	const auto run_len = *src_ptr++;
+	if (run_len != wide_run_len) return run_len;
+
+	const auto wide_len = src_ptr[0] | (src_ptr[1] << 8);
+	src_ptr += 2;
+	return wide_len;
+}
+
+// Codec of an encoded slice, sent with its packets
+enum class codec_id_t : uint8_t
+{
+	rle     = 0, // (value, length) byte pairs, see run_encoder_t
+	entropy = 1, // Runs in variable-length codes, see entropy_coder_t
+};
+
+// Entropy coding of the runs of a slice through bitstream_t, shared by the encoder and the decoder
+// Colors are coded as their position in a move-to-front list, so the few colors of the sky, a wall and the ground
+// take a few bits each, and run lengths in Exp-Golomb codes whose order follows the mean of recent lengths as in JPEG-LS
+// Every column is a byte-aligned bitstream: a 1 (a 0 ends the slice), a raw bit, and then either column_size 8-bit pixels
+// or its runs as (color position, length - 1), where the position is one less after the first run of the column,
+// as a run never has the color of the run before it
+// Columns are stored raw when their codes would not be shorter, and update the model with their runs all the same
+// The model is reset at every slice, so slices decode on their own
+struct entropy_coder_t
+{
+	static constexpr auto num_colors = 256;
+
+	// A run takes at most 17 bits for its color and 21 for its length, and bitstream_t writes 32-bit words
+	static constexpr auto max_run_size = 5;
+	static constexpr auto max_coded_column_size = max_column_size + 1 + max_run_size + 4;
+
+	uint8_t colors[num_colors];
+	int len_sum  {0};
+	int num_lens {0};
+
+	// Coded column until it replaces the runs it was coded from
+	uint8_t column_bytes[max_coded_column_size];
+
+	auto reset() -> void
 	{
-		// Reset RLE for every row
-		auto run_val = 0;
-		auto run_len = 0;
+		for (auto i = 0; i < num_colors; i++) colors[i] = i;
+		len_sum  = 4;
+		num_lens = 1;
+	}
+
+	// Smallest order k with num_lens * 2^k >= len_sum, about log2 of the mean length
+	auto get_len_order() const -> int
+	{
+		auto k = 0;
+		while ((num_lens << k) < len_sum) k++;
+		return k;
+	}
+
+	// Update the model with a run and return the position its color had
+	auto update(int value, int len) -> int
+	{
+		// Shift the colors before it down while looking for it
+		auto pos = 0;
+		auto color = colors[0];
+		colors[0] = value;
+		while (color != value) std::swap(color, colors[++pos]);
+
+		// Halving keeps the mean following the lengths of the last few dozen runs
+		len_sum += len - 1;
+		if (++num_lens == 32)
+		{
+			len_sum  >>= 1;
+			num_lens >>= 1;
+		}
+		return pos;
+	}
+
+	// Exp-Golomb code of order k: q = (value >> k) + 1 in 2 * floor(log2(q)) + 1 bits, so with as many leading zeros
+	// as it has bits after its first 1, followed by the k low bits of value
+	static auto write_exp_golomb(bitstream_t& bits, uint32_t value, int order) -> void
+	{
+		const auto q = (value >> order) + 1;
+		const auto num_q_bits = std::bit_width(q) - 1;
+		bits.write((q << order) | (value & ((1U << order) - 1)), 2 * num_q_bits + 1 + order);
+	}
+
+	// Returns false if the code is longer than valid codes or does not end within the stream
+	static auto read_exp_golomb(bitstream_t& bits, int order, uint32_t& value) -> bool
+	{
+		// Valid codes have at most 16 leading zeros
+		const auto num_q_bits = bits.read_unary();
+		if (num_q_bits < 0 || num_q_bits > 16 || bits.size() < num_q_bits + order) return false;
+		const auto q = (1U << num_q_bits) | bits.read(num_q_bits);
+		value = ((q - 1) << order) | bits.read(order);
+		return true;
+	}
+
+	// Call fn(value, len) for every run of a column of run pairs or a literal in [src_ptr, src_end)
+	template <typename fn_t>
+	static auto for_each_run(const uint8_t* src_ptr, const uint8_t* src_end, fn_t&& fn) -> void
+	{
+		if (src_ptr[0] == literal_escape && src_ptr[1] == escape_run_len)
+		{
+			src_ptr += 2;
+			const auto size = read_run_len(src_ptr);
+			for (auto i = 0; i < size;)
+			{
+				auto len = 1;
+				while (i + len < size && src_ptr[i + len] == src_ptr[i]) len++;
+				fn(src_ptr[i], len);
+				i += len;
+			}
+			return;
+		}
+		while (src_ptr < src_end)
+		{
+			const auto value = *src_ptr++;
+			fn(value, read_run_len(src_ptr));
+		}
+	}
 
-		for (auto j = 0; j < width; j++)
+	// Replace the runs of a column in [column_ptr, column_end), written by run_encoder_t, with their codes
+	// Returns the end of the coded column, which takes column_size + 1 bytes at most
+	auto encode_column(uint8_t* column_ptr, uint8_t* column_end, int column_size) -> uint8_t*
+	{
+		const auto raw_size = 2 + 8 * column_size;
+
+		bitstream_t bits {column_bytes, max_coded_column_size};
+		bits.write(1);
+		bits.write(0);
+
+		auto is_raw = false;
+		auto is_first = true;
+		for_each_run(column_ptr, column_end, [&](int value, int len)
 		{
-			const auto value = *in_buffer++;
-			if (run_len == 0)
+			const auto order = get_len_order();
+			const auto pos = update(value, len);
+			if (is_raw) return;
+
+			write_exp_golomb(bits, is_first ? pos : pos - 1, 0);
+			write_exp_golomb(bits, len - 1, order);
+			is_first = false;
+			is_raw = bits.size() >= raw_size;
+		});
+		if (is_raw)
+		{
+			bits.clear();
+			bits.write(1);
+			bits.write(1);
+			for_each_run(column_ptr, column_end, [&bits](int value, int len)
 			{
-				run_val = value;
-				run_len = 1;
+				for (auto i = 0; i < len; i++) bits.write(value, 8);
+			});
+		}
+		bits.flush();
+
+		const auto size = bits.size_bytes();
+		std::memcpy(column_ptr, column_bytes, size);
+		return column_ptr + size;
+	}
+
+	// Columns start with a 1, so a 0 bit ends the slice
+	static auto is_slice_end(const uint8_t* src_ptr) -> bool
+	{
+		return (src_ptr[0] & 0x80) == 0;
+	}
+
+	// Decode the column at src_ptr, which ends before src_end, into dst_ptr and move src_ptr past it
+	// Returns false if the column is corrupt, checking that bits remain before every read
+	auto decode_column(const uint8_t*& src_ptr, const uint8_t* src_end, uint8_t* dst_ptr, int column_size) -> bool
+	{
+		const auto num_bytes = static_cast<int>(std::min<int64_t>(column_size + 1, src_end - src_ptr));
+		bitstream_t bits {const_cast<uint8_t*>(src_ptr), num_bytes};
+		bits.assign(num_bytes);
+
+		bits.read();
+		if (bits.read() == 1)
+		{
+			if (bits.size() < 8 * column_size) return false;
+			for (auto i = 0; i < column_size; i++) dst_ptr[i] = bits.read(8);
+			for (auto i = 0; i < column_size;)
+			{
+				auto len = 1;
+				while (i + len < column_size && dst_ptr[i + len] == dst_ptr[i]) len++;
+				update(dst_ptr[i], len);
+				i += len;
 			}
-			else if (value == run_val)
+		}
+		else
+		{
+			for (auto i = 0; i < column_size;)
 			{
-				run_len++;
+				const auto order = get_len_order();
+				auto pos_code = uint32_t {0};
+				auto len_code = uint32_t {0};
+				if (!read_exp_golomb(bits, 0, pos_code) || !read_exp_golomb(bits, order, len_code)) return false;
+
+				// Bounded, so a corrupt stream stays within the column
+				const auto pos = std::min<uint32_t>(pos_code + (i > 0 ? 1 : 0), num_colors - 1);
+				const auto len = static_cast<int>(std::min<uint32_t>(len_code + 1, column_size - i));
+				const auto value = colors[pos];
+				update(value, len);
+				std::memset(dst_ptr + i, value, len);
+				i += len;
 			}
-			else
+		}
+
+		src_ptr += (8 * num_bytes - bits.size() + 7) / 8;
+		return true;
+	}
+};
+
+// Streaming run-length encoder writing (value, length) pairs
+// Consecutive pixels and runs of the same value are merged until flush(), which ends a column
+// A column whose runs would take more bytes than its raw pixels is stored as a literal instead,
+// so a column of column_size pixels never takes more than get_max_column_size() bytes
+// With an entropy coder, every finished column is coded in place of its runs for codec_id_t::entropy
+// With a column history, a finished column that repeats one of the last max_repeat_distance columns of the slice
+// is replaced with a repeat, and otherwise spans of its runs that the previous column has at the same rows with copies
+struct run_encoder_t
+{
+	uint8_t* dst_ptr {nullptr};
+	int column_size {0}; // Pixels per column, literals for up to max_column_size (0 = runs only, unbounded)
+	entropy_coder_t* entropy {nullptr};
+
+	// get_column_history_size(column_size) bytes holding the runs of the last columns as they were before matching
+	uint8_t* history {nullptr};
+	int history_sizes[max_repeat_distance + 1] {};
+	int num_columns {0};
+
+	int run_val {0};
+	int run_len {0};
+
+	uint8_t* column_ptr {nullptr}; // First byte of the current column, set when its first run is written
+	bool is_literal {false};
+
+	auto put(int value) -> void
+	{
+		if (run_len == 0)
+		{
+			run_val = value;
+			run_len = 1;
+		}
+		else if (value == run_val)
+		{
+			run_len++;
+		}
+		else
+		{
+			write_run();
+			run_val = value;
+			run_len = 1;
+		}
+	}
+
+	auto put_run(int value, int len) -> void
+	{
+		if (len <= 0) return;
+		if (run_len > 0 && value != run_val) write_run();
+		run_val = value;
+		run_len += len;
+	}
+
+	// Add last run and end the column
+	auto flush() -> void
+	{
+		if (run_len > 0) write_run();
+		if (is_literal) write_literal_size();
+		if (entropy && column_ptr) dst_ptr = entropy->encode_column(column_ptr, dst_ptr, column_size);
+		else if (history && column_ptr) match_column();
+		column_ptr = nullptr;
+		is_literal = false;
+	}
+
+	// Terminate stream with the end escape, or a column starting with a 0 bit when entropy coded
+	auto finish() -> uint8_t*
+	{
+		flush();
+		if (entropy)
+		{
+			*dst_ptr++ = 0;
+			return dst_ptr;
+		}
+		*dst_ptr++ = stream_end_escape;
+		*dst_ptr++ = escape_run_len;
+		return dst_ptr;
+	}
+
+	auto write_run() -> void
+	{
+		if (!column_ptr) column_ptr = dst_ptr;
+
+		// Runs cannot get shorter than the pixels they hold, so once they outgrow the raw column it is stored raw
+		if (!is_literal && column_size > 0 && column_size <= max_column_size &&
+			(dst_ptr - column_ptr) + get_run_size(run_len) > get_max_column_size(column_size)) make_literal();
+
+		if (is_literal)
+		{
+			std::memset(dst_ptr, run_val, run_len);
+			dst_ptr += run_len;
+		}
+		else
+		{
+			// Runs longer than max_run_len are split, which only happens to unbounded columns
+			for (; run_len > max_run_len; run_len -= max_run_len)
 			{
 				*dst_ptr++ = run_val;
-				*dst_ptr++ = run_len;
-				run_val = value;
-				run_len = 1;
+				dst_ptr = write_run_len(dst_ptr, max_run_len);
 			}
+			*dst_ptr++ = run_val;
+			dst_ptr = write_run_len(dst_ptr, run_len);
+		}
+		run_len = 0;
+	}
+
+	// Write the length of a run or a copy, see read_run_len(), and return the end of it
+	static auto write_run_len(uint8_t* dst, int len) -> uint8_t*
+	{
+		if (len < wide_run_len)
+		{
+			*dst++ = len;
+			return dst;
+		}
+		*dst++ = wide_run_len;
+		*dst++ = len & 0xFF;
+		*dst++ = len >> 8;
+		return dst;
+	}
+
+	// Keep the runs of the finished column in the history and replace them with a repeat or copies where that is shorter
+	auto match_column() -> void
+	{
+		constexpr auto num_slots = max_repeat_distance + 1;
+		const auto slot_size = get_max_column_size(column_size);
+		const auto get_slot = [this](int distance) { return (num_columns + num_slots - distance) % num_slots; };
+
+		const auto size = static_cast<int>(dst_ptr - column_ptr);
+		const auto runs = history + get_slot(0) * slot_size;
+		std::memcpy(runs, column_ptr, size);
+		history_sizes[get_slot(0)] = size;
+
+		// Runs are canonical, so columns of the same pixels have the same runs
+		const auto num_prev = std::min(num_columns, max_repeat_distance);
+		for (auto distance = 1; distance <= num_prev && size > repeat_size; distance++)
+		{
+			const auto slot = get_slot(distance);
+			if (history_sizes[slot] != size || std::memcmp(history + slot * slot_size, runs, size) != 0) continue;
+
+			dst_ptr = column_ptr;
+			*dst_ptr++ = repeat_escape;
+			*dst_ptr++ = escape_run_len;
+			*dst_ptr++ = distance;
+			num_columns++;
+			return;
+		}
+
+		if (num_prev > 0 && !is_literal) copy_runs(runs, size, history + get_slot(1) * slot_size, history_sizes[get_slot(1)]);
+		num_columns++;
+	}
+
+	// Rewrite the runs [runs, runs + size) of the column from its start, with every span of runs
+	// that the previous column has at the same rows as a copy when it is shorter
+	auto copy_runs(const uint8_t* runs, int size, const uint8_t* prev_ptr, int prev_size) -> void
+	{
+		if (prev_ptr[0] == literal_escape && prev_ptr[1] == escape_run_len) return;
+
+		const auto prev_end = prev_ptr + prev_size;
+		auto prev_val = *prev_ptr++;
+		auto prev_len = read_run_len(prev_ptr);
+		auto prev_pos = 0;
+
+		// Written through a local, as stores through uint8_t* would reload the members after every byte
+		auto out_ptr = column_ptr;
+		const uint8_t* span_ptr = nullptr; // First run of the current span of matching runs
+		auto span_len = 0;
+		const auto end_span = [&](const uint8_t* span_end)
+		{
+			// The copy takes its escape and a run length
+			if (span_end - span_ptr > 1 + get_run_size(span_len))
+			{
+				*out_ptr++ = copy_escape;
+				*out_ptr++ = escape_run_len;
+				out_ptr = write_run_len(out_ptr, span_len);
+			}
+			else
+			{
+				std::memcpy(out_ptr, span_ptr, span_end - span_ptr);
+				out_ptr += span_end - span_ptr;
+			}
+			span_len = 0;
+		};
+
+		auto pos = 0;
+		for (auto src_ptr = runs; src_ptr < runs + size;)
+		{
+			const auto run_ptr = src_ptr;
+			const auto value = *src_ptr++;
+			const auto len = read_run_len(src_ptr);
+
+			while (prev_pos + prev_len <= pos && prev_ptr < prev_end)
+			{
+				prev_pos += prev_len;
+				prev_val = *prev_ptr++;
+				prev_len = read_run_len(prev_ptr);
+			}
+			pos += len;
+
+			if (prev_pos == pos - len && prev_len == len && prev_val == value)
+			{
+				if (span_len == 0) span_ptr = run_ptr;
+				span_len += len;
+				continue;
+			}
+			if (span_len > 0) end_span(run_ptr);
+			*out_ptr++ = value;
+			out_ptr = write_run_len(out_ptr, len);
+		}
+		if (span_len > 0) end_span(runs + size);
+		dst_ptr = out_ptr;
+	}
+
+	// Pixels of a column being rewritten as a literal, shared by the encoders of the render task as its stack is too small
+	static inline uint8_t literal_pixels[max_column_size];
+
+	// Rewrite the runs of the current column as a literal, which the rest of the column is appended to
+	// Its size is filled in by flush()
+	auto make_literal() -> void
+	{
+		auto num_pixels = 0;
+		for (const uint8_t* src_ptr = column_ptr; src_ptr < dst_ptr;)
+		{
+			const auto value = *src_ptr++;
+			const auto len = read_run_len(src_ptr);
+			std::memset(literal_pixels + num_pixels, value, len);
+			num_pixels += len;
+		}
+
+		dst_ptr = column_ptr + get_literal_header_size(column_size);
+		column_ptr[0] = literal_escape;
+		column_ptr[1] = escape_run_len;
+		std::memcpy(dst_ptr, literal_pixels, num_pixels);
+		dst_ptr += num_pixels;
+		is_literal = true;
+	}
+
+	// Write the number of pixels of the literal into its header, in the form get_literal_header_size() set aside
+	auto write_literal_size() -> void
+	{
+		const auto size = static_cast<int>(dst_ptr - column_ptr) - get_literal_header_size(column_size);
+		if (column_size < wide_run_len)
+		{
+			column_ptr[2] = size;
+			return;
 		}
-		// Add last run
-		*dst_ptr++ = run_val;
-		*dst_ptr++ = run_len;
+		column_ptr[2] = wide_run_len;
+		column_ptr[3] = size & 0xFF;
+		column_ptr[4] = size >> 8;
+	}
+};
+
+auto encode_slice(const uint8_t* in_buffer, uint8_t* enc_buffer, int width, int height) -> int
+{
+	run_encoder_t encoder {enc_buffer, width};
+	for (auto i = 0; i < height; i++)
+	{
+		// Reset RLE for every row
+		for (auto j = 0; j < width; j++) encoder.put(*in_buffer++);
+		encoder.flush();
 	}
+	return encoder.finish() - enc_buffer;
+}
 
-	// Terminate stream with special symbol
-	*dst_ptr++ = stream_end_symbol;
-	*dst_ptr++ = stream_end_symbol;
+// Number of pixels in the enc_size bytes of an encoded slice of columns of column_size pixels, without decoding it
+// Returns -1 if the slice is corrupt: it does not end within enc_size bytes, or repeats or copies pixels it does not have yet
+auto get_decoded_size(const uint8_t* enc_buffer, int enc_size, int column_size) -> int
+{
+	auto src_ptr = enc_buffer;
+	const auto src_end = enc_buffer + enc_size;
+	const auto read_len = [&src_ptr, src_end]() -> int
+	{
+		if (src_ptr == src_end || (src_ptr[0] == wide_run_len && src_end - src_ptr < 3)) return -1;
+		return read_run_len(src_ptr);
+	};
 
-	return dst_ptr - enc_buffer;
+	auto size = 0;
+	for (;;)
+	{
+		if (src_ptr == src_end) return -1;
+		const auto run_val = *src_ptr++;
+		const auto run_len = read_len();
+		if (run_len < 0) return -1;
+		if (run_len != escape_run_len)
+		{
+			size += run_len;
+			continue;
+		}
+
+		if (run_val == stream_end_escape) return size;
+		if (run_val == repeat_escape)
+		{
+			if (src_ptr == src_end) return -1;
+			const auto distance = *src_ptr++;
+			if (distance == 0 || size < distance * column_size) return -1;
+			size += column_size;
+		}
+		else if (run_val == copy_escape)
+		{
+			const auto len = read_len();
+			if (len < 0 || len > column_size || size < column_size) return -1;
+			size += len;
+		}
+		else
+		{
+			// Literal
+			const auto len = read_len();
+			if (len < 0 || src_end - src_ptr < len) return -1;
+			size += len;
+			src_ptr += len;
+		}
+	}
 }
 
-auto decode_slice(const uint8_t* enc_buffer, uint8_t* out_buffer) -> int
+// Runs are written with 16-byte stores of the broadcast value, using GCC vector extensions
+// A short run is one store that spills into the pixels of the next runs, which overwrite it,
+// and a long run is stored 16 bytes at a time with the last store ending at the end of the run
+// Stores stay within the slice, whose size is found first, as slices are decoded in any order next to each other
+// Repeats and copies read columns of the slice that are already decoded
+// The slice is checked by get_decoded_size() first, so nothing is written for a corrupt slice
+auto decode_rle_slice(const uint8_t* enc_buffer, int enc_size, uint8_t* out_buffer, int column_size, int max_columns) -> int
 {
+	typedef uint8_t pixels_t __attribute__((vector_size(16)));
+	constexpr auto vec_size = static_cast<int>(sizeof(pixels_t));
+
 	auto src_ptr = enc_buffer;
 	auto dst_ptr = out_buffer;
+
+	const auto size = get_decoded_size(enc_buffer, enc_size, column_size);
+	if (size < 0 || size % column_size != 0 || size > max_columns * column_size) return -1;
+
+	// Last position with room for a whole store
+	const auto vec_end = size - vec_size;
 	for (;;)
 	{
 		const auto run_val = *src_ptr++;
-		const auto run_len = *src_ptr++;
-		if (run_val == stream_end_symbol && run_len == stream_end_symbol) break;
-		for (auto i = 0; i < run_len; i++) *dst_ptr++ = run_val;
+		const auto run_len = read_run_len(src_ptr);
+		if (run_len == escape_run_len)
+		{
+			if (run_val == stream_end_escape) break;
+			if (run_val == repeat_escape)
+			{
+				const auto distance = *src_ptr++;
+				std::memcpy(dst_ptr, dst_ptr - distance * column_size, column_size);
+				dst_ptr += column_size;
+				continue;
+			}
+			if (run_val == copy_escape)
+			{
+				const auto size = read_run_len(src_ptr);
+				std::memcpy(dst_ptr, dst_ptr - column_size, size);
+				dst_ptr += size;
+				continue;
+			}
+
+			// Literal
+			const auto size = read_run_len(src_ptr);
+			std::memcpy(dst_ptr, src_ptr, size);
+			src_ptr += size;
+			dst_ptr += size;
+			continue;
+		}
+
+		if (dst_ptr - out_buffer > vec_end)
+		{
+			// Last pixels of the slice
+			for (auto i = 0; i < run_len; i++) dst_ptr[i] = run_val;
+		}
+		else
+		{
+			const auto pixels = pixels_t {} + run_val;
+			std::memcpy(dst_ptr, &pixels, vec_size);
+			if (run_len > vec_size)
+			{
+				for (auto i = vec_size; i < run_len - vec_size; i += vec_size) std::memcpy(dst_ptr + i, &pixels, vec_size);
+				std::memcpy(dst_ptr + run_len - vec_size, &pixels, vec_size);
+			}
+		}
+		dst_ptr += run_len;
 	}
-	//const auto t = dst_ptr - out_buffer; if (t != 19200) std::clog << t << '\n';
-	return src_ptr - enc_buffer;
+	return size / column_size;
+}
+
+auto decode_entropy_slice(const uint8_t* enc_buffer, int enc_size, uint8_t* out_buffer, int column_size, int max_columns) -> int
+{
+	entropy_coder_t coder;
+	coder.reset();
+
+	auto src_ptr = enc_buffer;
+	const auto src_end = enc_buffer + enc_size;
+	for (auto num_columns = 0;; num_columns++)
+	{
+		if (src_ptr == src_end) return -1;
+		if (entropy_coder_t::is_slice_end(src_ptr)) return num_columns;
+		if (num_columns == max_columns) return -1;
+		if (!coder.decode_column(src_ptr, src_end, out_buffer + num_columns * column_size, column_size)) return -1;
+	}
+}
+
+// Decode the enc_size bytes of a slice of columns of column_size pixels in the codec it was sent with
+// Returns the number of columns, or -1 if the slice is corrupt or has more than max_columns columns,
+// in which case out_buffer may hold some of its columns but nothing past max_columns columns
+auto decode_slice(const uint8_t* enc_buffer, int enc_size, uint8_t* out_buffer, codec_id_t codec_id, int column_size, int max_columns) -> int
+{
+	if (codec_id == codec_id_t::entropy) return decode_entropy_slice(enc_buffer, enc_size, out_buffer, column_size, max_columns);
+	return decode_rle_slice(enc_buffer, enc_size, out_buffer, column_size, max_columns);
 }
 
 } // namespace codec
@@ -2,6 +2,8 @@
 
 #include <cstdint>
 
+#include "codec.hpp"
+
 constexpr auto make_addr(int a, int b, int c, int d) -> uint32_t
 {
 	return (a << 24) | (b << 16) | (c << 8) | d;
@@ -23,10 +25,95 @@ constexpr auto pkt_buffer_size	= 1440;
 
 constexpr auto screen_buffer_size = screen_width * screen_height;
 constexpr auto slice_buffer_size  = screen_buffer_size / num_slices;
+
+// Slices are resized per frame to balance their render cost, up to twice the average width
+constexpr auto get_max_slice_width(int width) -> int { return 2 * width / num_slices; }
+
+constexpr auto max_slice_width       = get_max_slice_width(screen_width);
+constexpr auto max_slice_buffer_size = max_slice_width * screen_height;
+
+constexpr auto max_enc_slice_buffer_size = codec::get_max_encoded_size(max_slice_width, screen_height);
 constexpr auto all_slice_bitmask  = (1U << num_slices ) - 1U;
 
 } // namespace config::common
 
+namespace config::server
+{
+
+// Number of adjacent columns traced together by the packet DDA (1 = scalar)
+#if defined(ESP_PLATFORM)
+constexpr auto ray_packet_size = 1;
+#else
+constexpr auto ray_packet_size = 8;
+#endif
+
+// Packets buffered between the render and stream tasks, as the render task streams slices while rendering them
+#if defined(ESP_PLATFORM)
+constexpr auto num_pkt_slots = 8;
+#else
+constexpr auto num_pkt_slots = 32;
+
+// Send the packets queued for a slice with one sendmsg() using UDP GSO, falls back to one packet per call without kernel support
+constexpr auto use_udp_gso = true;
+#endif
+
+// Token bucket pacing of the stream task, trading a little latency for bursts that fit Wi-Fi buffers (rate 0 = unpaced)
+#if defined(ESP_PLATFORM)
+constexpr auto pacing_rate       = 2'500'000; // Bytes per second
+constexpr auto pacing_burst_size = 8 * config::common::pkt_buffer_size;
+#else
+constexpr auto pacing_rate       = 0;
+constexpr auto pacing_burst_size = 16 * config::common::pkt_buffer_size;
+#endif
+
+// Sample prefiltered mip levels for distant walls
+constexpr auto use_mipmaps = true;
+
+// Texture rows cached in RAM, 64 bytes per way: 32 x 4 keeps about 96% of the rows of a walkthrough between frames, 16 x 4 about 74%
+constexpr auto tex_cache_num_sets = 32;
+constexpr auto tex_cache_num_ways = 4;
+
+// Prefetch the texture row of the next column while rendering a column
+// Off on the ESP32, where __builtin_prefetch emits nothing for the Xtensa cores and only the cache lookup would remain
+#if defined(ESP_PLATFORM)
+constexpr auto use_tex_prefetch = false;
+#else
+constexpr auto use_tex_prefetch = true;
+#endif
+
+// Codec of the slices: 0 = run-length pairs, 1 = entropy-coded runs (fewer bytes for more render task time)
+constexpr auto slice_codec = 0;
+
+// Send run-length columns as repeats of an earlier column of the slice, or their runs as copies from the previous column
+// About 28% fewer bytes for 60 to 70% more render and encode time on the host, so only on by default there
+#if defined(ESP_PLATFORM)
+constexpr auto use_column_matches = false;
+#else
+constexpr auto use_column_matches = true;
+#endif
+
+// Cast rays in Q16.16 fixed point instead of float
+constexpr auto use_fixed_point = false;
+
+// Floor and ceiling: 0 = flat colors, 1 = textured floor, 2 = textured floor and ceiling
+constexpr auto floor_mode = 0;
+constexpr auto floor_texture_id   = 3; // greystone
+constexpr auto ceiling_texture_id = 6; // wood
+
+// Draw the sprites of the map over walls, floor and ceiling
+constexpr auto use_sprites = true;
+
+// Skip empty cells along rays using the distance field of the map
+constexpr auto use_distance_field = true;
+
+// Trace every few columns and interpolate the columns between two rays that hit the same wall face
+constexpr auto use_wall_coherence = true;
+
+// Choose slice widths per frame from the render cost of each column in the previous frame
+constexpr auto use_adaptive_slices = true;
+
+} // namespace config::server
+
 namespace config::client
 {
 
@@ -39,6 +126,7 @@ constexpr server_info_t server_infos[] = {
 };
 
 constexpr auto name			= "ESP32 Remote Render";
+constexpr auto map_path		= ""; // Map file pushed to the servers at startup and with M (empty: built-in map)
 constexpr auto fov			= 60;
 constexpr auto target_fps	= 30;
 constexpr auto scale_width	= 2;
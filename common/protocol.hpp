@@ -4,6 +4,8 @@
 #include <cstring>
 #include <ostream>
 
+#include "config.hpp"
+
 namespace protocol
 {
 
@@ -11,24 +13,38 @@ struct pkt_info_t
 {
 	uint8_t slice_end : 1;
 	uint8_t has_data  : 1;
-	uint8_t reserved  : 2;
+	uint8_t codec_id  : 2;	// codec::codec_id_t of the slice
 	uint8_t slice_id  : 4;	// max 16 slices per frame
 	uint8_t pkt_id {0};		// max 256 packets per slice
+	uint16_t slice_start {0}; // First column of the slice, as slice widths vary per frame
+	uint16_t payload_size {0}; // Encoded bytes following the header, then frame info on the last packet of a frame
 };
 
+// Packets of a slice at most: full packets of its largest encoding, the rest, and a packet for the frame info
+constexpr auto max_slice_pkts =
+	config::common::max_enc_slice_buffer_size / static_cast<int>(config::common::pkt_buffer_size - sizeof(pkt_info_t)) + 2;
+static_assert(max_slice_pkts <= 256, "pkt_id has 8 bits");
+
 auto read(const uint8_t* buffer, pkt_info_t& obj) -> uint8_t*
 {
 	obj.slice_end = (buffer[0] >> 7) & 1;
 	obj.has_data  = (buffer[0] >> 6) & 1;
+	obj.codec_id  = (buffer[0] >> 4) & 3;
 	obj.slice_id  = (buffer[0] & 0x0F);
 	obj.pkt_id    = (buffer[1] & 0xFF);
+	obj.slice_start = buffer[2] | (buffer[3] << 8);
+	obj.payload_size = buffer[4] | (buffer[5] << 8);
 	return const_cast<uint8_t*>(buffer) + sizeof(obj);
 }
 
 auto write(const pkt_info_t& obj, uint8_t* buffer) -> uint8_t*
 {
-	*buffer++ = ((obj.slice_end & 1) << 7) | ((obj.has_data & 1) << 6) | (obj.slice_id & 0x0F);
+	*buffer++ = ((obj.slice_end & 1) << 7) | ((obj.has_data & 1) << 6) | ((obj.codec_id & 3) << 4) | (obj.slice_id & 0x0F);
 	*buffer++ = obj.pkt_id & 0xFF;
+	*buffer++ = obj.slice_start & 0xFF;
+	*buffer++ = obj.slice_start >> 8;
+	*buffer++ = obj.payload_size & 0xFF;
+	*buffer++ = obj.payload_size >> 8;
 	return buffer;
 }
 
@@ -37,28 +53,53 @@ auto operator<< (std::ostream& os, const pkt_info_t& obj) -> std::ostream&
 	os
 		<< static_cast<int>(obj.slice_end)	<< ' '
 		<< static_cast<int>(obj.has_data)	<< ' '
+		<< static_cast<int>(obj.codec_id)	<< ' '
 		<< static_cast<int>(obj.slice_id)	<< ' '
-		<< static_cast<int>(obj.pkt_id);
+		<< static_cast<int>(obj.pkt_id)		<< ' '
+		<< static_cast<int>(obj.slice_start)	<< ' '
+		<< static_cast<int>(obj.payload_size);
 	return os;
 }
 
 auto write_pkt_info(
 	int slice_end,
 	int has_data,
+	int codec_id,
 	int slice_id,
 	int pkt_id,
+	int slice_start,
+	int payload_size,
 	uint8_t* buffer) -> uint8_t*
 {
-	*buffer++ = ((slice_end & 1) << 7) | ((has_data & 1) << 6) | (slice_id & 0x0F);
+	*buffer++ = ((slice_end & 1) << 7) | ((has_data & 1) << 6) | ((codec_id & 3) << 4) | (slice_id & 0x0F);
 	*buffer++ = pkt_id & 0xFF;
+	*buffer++ = slice_start & 0xFF;
+	*buffer++ = (slice_start >> 8) & 0xFF;
+	*buffer++ = payload_size & 0xFF;
+	*buffer++ = (payload_size >> 8) & 0xFF;
 	return buffer;
 }
 
+// Breakdown of the render time of a frame
+struct render_stats_t
+{
+	uint32_t floor_time_us    {0};
+	uint32_t num_floor_pixels {0};
+	uint32_t num_dda_steps    {0}; // Cells visited by all rays
+	uint32_t num_traced_columns       {0};
+	uint32_t num_interpolated_columns {0}; // Columns between two rays hitting the same wall face
+	uint32_t num_tex_cache_hits   {0};
+	uint32_t num_tex_cache_misses {0}; // Texture rows copied from flash
+};
+
 struct frame_info_t
 {
 	uint64_t timestamp      {0};
 	uint32_t render_time_us {0};
 	uint32_t stream_time_us {0};
+	uint32_t pacing_delay_us {0}; // Time packets were held back by the pacer
+	uint32_t num_paced_pkts  {0}; // Sends that had to wait for the pacer
+	render_stats_t render_stats;
 };
 
 auto read(const uint8_t* buffer, frame_info_t& obj) -> uint8_t*
@@ -73,6 +114,39 @@ auto write(const frame_info_t& obj, uint8_t* buffer) -> uint8_t*
 	return buffer + sizeof(obj);
 }
 
+constexpr auto max_map_chunk_size = 1024;
+
+// Header of a datagram with part of a map file pushed by the client, followed by its bytes
+// Every chunk but the last one holds max_map_chunk_size bytes
+struct map_chunk_t
+{
+	static constexpr uint32_t magic_value = 0x50414D52; // "RMAP"
+
+	uint32_t magic     {magic_value};
+	uint32_t file_size {0};
+	uint32_t offset    {0};
+};
+
+auto read(const uint8_t* buffer, map_chunk_t& obj) -> uint8_t*
+{
+	std::memcpy(&obj, buffer, sizeof(obj));
+	return const_cast<uint8_t*>(buffer) + sizeof(obj);
+}
+
+auto write(const map_chunk_t& obj, uint8_t* buffer) -> uint8_t*
+{
+	std::memcpy(buffer, &obj, sizeof(obj));
+	return buffer + sizeof(obj);
+}
+
+auto is_map_chunk(const uint8_t* buffer, int size) -> bool
+{
+	map_chunk_t obj;
+	if (size < static_cast<int>(sizeof(obj))) return false;
+	read(buffer, obj);
+	return obj.magic == map_chunk_t::magic_value;
+}
+
 struct payload_t
 {
 	// TODO: Use C++17 std::span
@@ -0,0 +1,330 @@
+// Render/stream throughput benchmark for the host build
+// Renders a fixed camera path through the same render and packetization path as the server, without sockets
+// Usage: server_bench [--frames N] [--packet N] [--mip 0|1] [--fixed 0|1] [--floor 0|1|2] [--sprites 0|1] [--verify 0|1]
+//                     [--map file] [--skip 0|1] [--coherence 0|1] [--adaptive 0|1] [--width N] [--height N] [--codec 0|1]
+//                     [--match 0|1]
+// --verify compares the decoded pixels of every frame against the plain float render path
+// (no fixed point, skipping or wall coherence)
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "common/codec.hpp"
+#include "common/config.hpp"
+#include "common/protocol.hpp"
+#include "frame_shape.hpp"
+#include "map_file.hpp"
+#include "raycaster.hpp"
+#include "slice_layout.hpp"
+#include "stream.hpp"
+#include "types.hpp"
+
+constexpr auto default_num_frames = 1000;
+
+auto get_time_us() -> int64_t
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Nearest empty cell center to a position, searching outwards in square rings
+auto find_open_position(float pos_x, float pos_y) -> std::array<float, 2>
+{
+	const auto x0 = std::clamp(static_cast<int>(pos_x), 0, world_map.size_x - 1);
+	const auto y0 = std::clamp(static_cast<int>(pos_y), 0, world_map.size_y - 1);
+	if (world_map.get(x0, y0) == 0) return {pos_x, pos_y};
+
+	for (auto r = 1; r < std::max(world_map.size_x, world_map.size_y); r++)
+	{
+		for (auto x = x0 - r; x <= x0 + r; x++)
+		{
+			for (auto y = y0 - r; y <= y0 + r; y++)
+			{
+				const auto is_ring = (x == x0 - r || x == x0 + r || y == y0 - r || y == y0 + r);
+				if (is_ring && world_map.is_inside(x, y) && world_map.get(x, y) == 0) return {x + 0.5F, y + 0.5F};
+			}
+		}
+	}
+	return {pos_x, pos_y};
+}
+
+// Spin the camera on the spot at a few open cells of the map
+// The positions of the built-in map are scaled to the size of a loaded map
+auto create_pose(int frame_num, int num_frames) -> pose_t
+{
+	constexpr float positions[][2] = {
+		{22.0F, 11.05F},
+		{ 9.5F,  5.5F },
+		{ 3.5F, 10.5F },
+		{15.5F, 19.5F},
+	};
+	constexpr auto num_positions = static_cast<int>(std::size(positions));
+	constexpr auto fov_scale = 0.57735F; // tan(30 deg)
+
+	const auto frames_per_position = std::max(num_frames / num_positions, 1);
+	const auto& position = positions[(frame_num / frames_per_position) % num_positions];
+	const auto angle = 6.2831853F * (frame_num % frames_per_position) / frames_per_position;
+
+	const auto scale_x = static_cast<float>(world_map.size_x) / default_map_size_x;
+	const auto scale_y = static_cast<float>(world_map.size_y) / default_map_size_y;
+	const auto [pos_x, pos_y] = (scale_x == 1.0F && scale_y == 1.0F) ?
+		std::array<float, 2> {position[0], position[1]} :
+		find_open_position(position[0] * scale_x, position[1] * scale_y);
+
+	pose_t pose;
+	pose.num     = frame_num;
+	pose.pos_x   = pos_x;
+	pose.pos_y   = pos_y;
+	pose.dir_x   = std::cos(angle);
+	pose.dir_y   = std::sin(angle);
+	pose.plane_x = -pose.dir_y * fov_scale;
+	pose.plane_y = +pose.dir_x;
+	return pose;
+}
+
+auto main(int argc, char** argv) -> int
+{
+	auto num_frames = default_num_frames;
+	auto verify = false;
+	auto use_adaptive_slices = false; // Layouts from measured costs would make the hash vary between runs
+	auto width  = config::common::screen_width;
+	auto height = config::common::screen_height;
+	auto slice_codec = static_cast<codec::codec_id_t>(config::server::slice_codec);
+	const char* map_path = nullptr;
+	for (auto i = 1; i + 1 < argc; i += 2)
+	{
+		const auto value = std::atoi(argv[i + 1]);
+		if      (std::strcmp(argv[i], "--frames") == 0) num_frames = value;
+		else if (std::strcmp(argv[i], "--packet") == 0) render_options.ray_packet_size = value;
+		else if (std::strcmp(argv[i], "--mip")    == 0) render_options.use_mipmaps = value != 0;
+		else if (std::strcmp(argv[i], "--fixed")  == 0) render_options.use_fixed_point = value != 0;
+		else if (std::strcmp(argv[i], "--floor")  == 0) render_options.floor_mode = static_cast<floor_mode_t>(value);
+		else if (std::strcmp(argv[i], "--sprites")== 0) render_options.use_sprites = value != 0;
+		else if (std::strcmp(argv[i], "--verify") == 0) verify = value != 0;
+		else if (std::strcmp(argv[i], "--map")    == 0) map_path = argv[i + 1];
+		else if (std::strcmp(argv[i], "--skip")   == 0) render_options.use_distance_field = value != 0;
+		else if (std::strcmp(argv[i], "--coherence") == 0) render_options.use_wall_coherence = value != 0;
+		else if (std::strcmp(argv[i], "--adaptive")  == 0) use_adaptive_slices = value != 0;
+		else if (std::strcmp(argv[i], "--width")  == 0) width = value;
+		else if (std::strcmp(argv[i], "--height") == 0) height = value;
+		else if (std::strcmp(argv[i], "--codec")  == 0) slice_codec = static_cast<codec::codec_id_t>(value);
+		else if (std::strcmp(argv[i], "--match")  == 0) render_options.use_column_matches = value != 0;
+		else
+		{
+			std::fprintf(stderr, "Unknown option %s\n", argv[i]);
+			return -1;
+		}
+	}
+	if (!frame_shapes_t::contains(width, height))
+	{
+		std::fprintf(stderr, "Renderer is not compiled for %dx%d\n", width, height);
+		return -1;
+	}
+	const auto slice_width = width / config::common::num_slices;
+	const auto frame_size  = width * height;
+
+	encoded_slice_t slice;
+	slice.width  = width;
+	slice.height = height;
+	slice.buffer = reinterpret_cast<uint8_t*>(malloc(config::common::max_enc_slice_buffer_size));
+
+	init_renderer(width);
+	if (map_path && !load_map_file(map_path))
+	{
+		std::fprintf(stderr, "Failed to load map %s\n", map_path);
+		return -1;
+	}
+	get_ticks_per_us(); // Calibrate outside of the timed loop
+
+	slice_layout_t slice_layout;
+	slice_layout.init(width);
+
+	// Packets are reassembled into the encoded slice like the client does
+	struct bench_pkt_queue_t
+	{
+		packet_t pkt;
+		std::vector<uint8_t> slice_bytes = std::vector<uint8_t>(config::common::max_enc_slice_buffer_size + max_pkt_payload_size);
+		int64_t num_pkts {0};
+		int64_t num_pkt_bytes {0};
+
+		auto get_packet() -> packet_t* { return &pkt; }
+
+		auto commit_packet() -> void
+		{
+			protocol::pkt_info_t pkt_info;
+			protocol::read(pkt.header, pkt_info);
+			auto dst = slice_bytes.data() + pkt_info.pkt_id * max_pkt_payload_size;
+			for (auto i = 0; i < 2; i++)
+			{
+				std::memcpy(dst, pkt.payload[i], pkt.payload_size[i]);
+				dst += pkt.payload_size[i];
+			}
+
+			iovec iov[max_pkt_iovecs];
+			const auto num_iovecs = get_pkt_iovecs(pkt, iov);
+			for (auto i = 0; i < num_iovecs; i++) num_pkt_bytes += iov[i].iov_len;
+			num_pkts++;
+		}
+	};
+
+	bench_pkt_queue_t pkt_queue;
+	std::vector<uint8_t> frame_pixels (frame_size);
+	std::vector<uint8_t> enc_ring_buffer (enc_ring_buffer_size);
+	slice_streamer_t<bench_pkt_queue_t> streamer {pkt_queue, enc_ring_buffer.data()};
+	protocol::frame_info_t frame_info;
+
+	auto render_elapsed = int64_t {0};
+	auto stream_elapsed = int64_t {0};
+	auto decode_ticks   = int64_t {0}; // Summed in ticks, as slices decode in a few microseconds
+	auto num_enc_bytes  = int64_t {0};
+	auto max_slice_size = 0;
+	auto floor_time_us    = int64_t {0};
+	auto num_floor_pixels = int64_t {0};
+	auto num_dda_steps    = int64_t {0};
+	auto num_traced_columns       = int64_t {0};
+	auto num_interpolated_columns = int64_t {0};
+	auto num_tex_cache_hits   = int64_t {0};
+	auto num_tex_cache_misses = int64_t {0};
+	auto max_slice_elapsed = int64_t {0}; // Slowest slice of every frame, against the mean in render_elapsed
+	auto enc_hash       = uint32_t {2166136261U}; // FNV-1a of all encoded columns, to compare render modes
+	auto pixel_hash     = uint32_t {2166136261U}; // FNV-1a of all decoded frames, to compare codecs
+
+	for (auto frame_num = 0; frame_num < num_frames; frame_num++)
+	{
+		render_command_t cmd;
+		cmd.pose = create_pose(frame_num, num_frames);
+
+		render_stats = {};
+
+		if (use_adaptive_slices) slice_layout.update(column_costs, width);
+
+		auto max_slice_time = int64_t {0};
+		for (auto slice_id = 0; slice_id < config::common::num_slices; slice_id++)
+		{
+			encoded_slice_t streamed_slice;
+			streamed_slice.width  = width;
+			streamed_slice.height = height;
+			streamed_slice.codec  = slice_codec;
+			streamed_slice.buffer = streamer.begin_slice(slice_id, slice_layout.get_start(slice_id), slice_codec);
+
+			// Packetizing is timed on its own and not counted as render time
+			auto stream_ticks = uint32_t {0};
+
+			const auto start_time = get_time_us();
+			render_encode_slice(cmd, slice_layout.get_start(slice_id), slice_layout.get_stop(slice_id), streamed_slice,
+				[&streamer, &stream_ticks](codec::run_encoder_t& encoder)
+				{
+					// Most columns do not fill a packet, so only time the ones that do
+					const auto is_wrapped = encoder.dst_ptr > streamer.ring + enc_ring_size;
+					if (!is_wrapped && streamer.get_num_pending(encoder.dst_ptr) <= static_cast<int>(max_pkt_payload_size)) return;
+					const auto start_ticks = get_ticks();
+					encoder.dst_ptr = streamer.drain(encoder.dst_ptr);
+					stream_ticks += get_ticks() - start_ticks;
+				});
+			const auto start_ticks = get_ticks();
+			streamer.finish(streamed_slice.end, frame_info);
+			stream_ticks += get_ticks() - start_ticks;
+
+			const auto stream_time = static_cast<int64_t>(stream_ticks / get_ticks_per_us());
+			const auto slice_time = get_time_us() - start_time - stream_time;
+			render_elapsed += slice_time;
+			stream_elapsed += stream_time;
+			max_slice_time = std::max(max_slice_time, slice_time);
+
+			// Decoded from the reassembled packets like the client does
+			const auto decode_start_ticks = get_ticks();
+			const auto slice_start = slice_layout.get_start(slice_id);
+			codec::decode_slice(pkt_queue.slice_bytes.data(), streamer.size, frame_pixels.data() + slice_start * height, slice_codec, height,
+				width - slice_start);
+			decode_ticks += get_ticks() - decode_start_ticks;
+
+			num_enc_bytes += streamer.size;
+			max_slice_size = std::max(max_slice_size, streamer.size);
+
+			// Columns are encoded independently, so the hash skips the end marker of the slice
+			// Floor stepping and wall coherence still start over at every slice, so layouts can differ by rounding
+			const auto end_marker_size = (slice_codec == codec::codec_id_t::entropy) ? 1 : codec::stream_end_size;
+			for (auto i = 0; i < streamer.size - end_marker_size; i++) enc_hash = (enc_hash ^ pkt_queue.slice_bytes[i]) * 16777619U;
+		}
+		for (const auto pixel : frame_pixels) pixel_hash = (pixel_hash ^ pixel) * 16777619U;
+
+		max_slice_elapsed += max_slice_time;
+		floor_time_us    += render_stats.floor_time_us;
+		num_floor_pixels += render_stats.num_floor_pixels;
+		num_dda_steps    += render_stats.num_dda_steps;
+		num_traced_columns       += render_stats.num_traced_columns;
+		num_interpolated_columns += render_stats.num_interpolated_columns;
+		num_tex_cache_hits   += render_stats.num_tex_cache_hits;
+		num_tex_cache_misses += render_stats.num_tex_cache_misses;
+	}
+
+	const auto per_frame = 1.0 / std::max(num_frames, 1);
+	std::printf("Frames  %d (%dx%d, %d slices) | Ray packet %d | Mip %d | Fixed %d | Floor %d | Sprites %d\n",
+		num_frames, width, height, config::common::num_slices,
+		render_options.ray_packet_size, render_options.use_mipmaps, render_options.use_fixed_point,
+		static_cast<int>(render_options.floor_mode), render_options.use_sprites);
+	std::printf("Map     %dx%d | %d sprites\n", world_map.size_x, world_map.size_y, world_map.num_sprites);
+	std::printf("Render  %8.1f us/frame\n", render_elapsed * per_frame);
+	std::printf("Slices  %8.2f slowest/mean render time | Adaptive %d\n",
+		static_cast<double>(max_slice_elapsed) * config::common::num_slices / std::max(render_elapsed, int64_t {1}), use_adaptive_slices);
+	std::printf("Floor   %8.1f us/frame | %8.1f pixels/frame\n", floor_time_us * per_frame, num_floor_pixels * per_frame);
+	std::printf("DDA     %8.1f steps/frame | Skip %d\n", num_dda_steps * per_frame, render_options.use_distance_field);
+	std::printf("Columns %8.1f traced/frame | %8.1f interpolated/frame | Coherence %d\n",
+		num_traced_columns * per_frame, num_interpolated_columns * per_frame, render_options.use_wall_coherence);
+	std::printf("Texture %8.1f hits/frame | %8.1f misses/frame | Hit rate %5.1f%% | %d sets x %d ways\n",
+		num_tex_cache_hits * per_frame, num_tex_cache_misses * per_frame,
+		100.0 * num_tex_cache_hits / std::max(num_tex_cache_hits + num_tex_cache_misses, int64_t {1}),
+		config::server::tex_cache_num_sets, config::server::tex_cache_num_ways);
+	std::printf("Stream  %8.1f us/frame\n", stream_elapsed * per_frame);
+	std::printf("Decode  %8.1f us/frame\n", static_cast<double>(decode_ticks) / get_ticks_per_us() * per_frame);
+	std::printf("Encoded %8.1f bytes/frame | CR %4.2f | Max slice %d bytes | Codec %d\n",
+		num_enc_bytes * per_frame, num_enc_bytes * per_frame / frame_size, max_slice_size, static_cast<int>(slice_codec));
+	std::printf("Packets %8.1f pkts/frame | %8.1f bytes/frame\n",
+		pkt_queue.num_pkts * per_frame, pkt_queue.num_pkt_bytes * per_frame);
+	std::printf("Hash    %08x | Pixels %08x\n", enc_hash, pixel_hash);
+
+	if (verify)
+	{
+		const auto options = render_options;
+		slice.codec = slice_codec;
+		std::vector<uint8_t> pixels (slice_width * height);
+		std::vector<uint8_t> ref_pixels (slice_width * height);
+
+		auto num_diff_pixels = int64_t {0};
+		for (auto frame_num = 0; frame_num < num_frames; frame_num++)
+		{
+			render_command_t cmd;
+			cmd.pose = create_pose(frame_num, num_frames);
+
+			for (auto slice_id = 0; slice_id < config::common::num_slices; slice_id++)
+			{
+				render_options = options;
+				render_encode_slice(cmd, slice_id * slice_width, (slice_id + 1) * slice_width, slice);
+				codec::decode_slice(slice.buffer, slice.size, pixels.data(), slice.codec, height, slice_width);
+
+				render_options = options;
+				render_options.use_fixed_point = false;
+				render_options.use_distance_field = false;
+				render_options.use_wall_coherence = false;
+				render_encode_slice(cmd, slice_id * slice_width, (slice_id + 1) * slice_width, slice);
+				codec::decode_slice(slice.buffer, slice.size, ref_pixels.data(), slice.codec, height, slice_width);
+
+				for (auto i = 0; i < slice_width * height; i++) num_diff_pixels += pixels[i] != ref_pixels[i];
+			}
+		}
+		render_options = options;
+
+		std::printf("Verify  %8.4f %% pixels differ from the float path\n",
+			100.0 * num_diff_pixels * per_frame / frame_size);
+	}
+
+	free(slice.buffer);
+
+	return 0;
+}
@@ -0,0 +1,244 @@
+// Host (Linux) build of the render/stream server
+// Runs the same render and stream pipeline as the ESP32 firmware over POSIX UDP sockets
+// Usage: server_host [port] [map file]
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/udp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "common/config.hpp"
+#include "common/protocol.hpp"
+#include "pacer.hpp"
+#include "raycaster.hpp"
+#include "slice_layout.hpp"
+#include "spsc_ring.hpp"
+#include "stream.hpp"
+#include "types.hpp"
+#include "map_file.hpp"
+#include "notify.hpp"
+
+constexpr auto default_port = config::client::stream_port;
+
+task_notify_t render_task_notify;
+task_notify_t stream_task_notify;
+
+render_command_t cmd;
+protocol::frame_info_t frame_info;
+
+// Received datagrams: render commands or chunks of a map pushed by the client
+uint8_t recv_buffer[config::common::pkt_buffer_size];
+map_receiver_t map_receiver;
+
+// Encoded slices, read by the network thread straight from here when sending their packets
+uint8_t enc_ring[enc_ring_buffer_size];
+slice_layout_t slice_layout;
+
+// Packets queued by the render thread for the network thread
+pkt_ring_t pkt_ring;
+pacer_t pacer;
+
+auto get_time_us() -> int64_t
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Send the num_pkts oldest packets of the ring without copying them
+// With GSO they are gathered into a single sendmsg(), which only works as long as all but the last one are full
+auto send_packets(int sock, const sockaddr_in& addr, int num_pkts, bool use_gso) -> bool
+{
+	static_assert(config::server::num_pkt_slots <= 64, "UDP GSO sends at most 64 segments");
+
+	iovec iov[config::server::num_pkt_slots * max_pkt_iovecs];
+	msghdr msg {};
+	msg.msg_name    = const_cast<sockaddr_in*>(&addr);
+	msg.msg_namelen = sizeof(addr);
+	msg.msg_iov     = iov;
+
+	for (auto i = 0; i < num_pkts; i++)
+	{
+		const auto num_iovecs = get_pkt_iovecs(*pkt_ring.get_read_slot(i), iov + msg.msg_iovlen);
+		msg.msg_iovlen += num_iovecs;
+		if (use_gso && i + 1 < num_pkts) continue;
+
+		if (sendmsg(sock, &msg, 0) < 0) return false;
+		msg.msg_iovlen = 0;
+	}
+	return true;
+}
+
+auto render_task() -> void
+{
+	run_render_task(cmd, frame_info, slice_layout, pkt_ring, enc_ring,
+		[](uint32_t bits) { render_task_notify.wait_bits(bits); },
+		[] { stream_task_notify.set_bits(pkt_ready_bit); },
+		get_time_us);
+}
+
+auto stream_task(int port) -> void
+{
+	for (;;)
+	{
+		sockaddr_in client_addr;
+		socklen_t socklen = sizeof(client_addr);
+		std::memset(&client_addr, 0, sizeof(client_addr));
+		client_addr.sin_family      = AF_INET;
+		client_addr.sin_addr.s_addr = htonl(INADDR_ANY);
+		client_addr.sin_port        = htons(port);
+
+		const auto sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+		if (sock < 0)
+		{
+			std::cerr << "Unable to create socket: errno " << errno << '\n';
+			break;
+		}
+		std::clog << "Socket created\n";
+
+		// Set timeout
+		const auto timeout = timeval { .tv_sec = 10, .tv_usec = 0 };
+		setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+		constexpr auto priority = 6 << 7;
+		setsockopt(sock, IPPROTO_IP, IP_TOS, &priority, sizeof(priority));
+
+		// Sends larger than a packet are cut into datagrams of pkt_buffer_size bytes by the kernel
+		constexpr auto gso_size = config::common::pkt_buffer_size;
+		auto use_gso = config::server::use_udp_gso && setsockopt(sock, SOL_UDP, UDP_SEGMENT, &gso_size, sizeof(gso_size)) == 0;
+		std::clog << "UDP GSO " << (use_gso ? "on" : "off") << '\n';
+
+		pacer.init(config::server::pacing_rate, config::server::pacing_burst_size, get_time_us());
+
+		if (bind(sock, reinterpret_cast<const sockaddr*>(&client_addr), sizeof(client_addr)) < 0)
+		{
+			std::cerr << "Failed to bind socket! errno=" << errno << '\n';
+			close(sock);
+			break;
+		}
+		std::clog << "Socket bound to port " << port << '\n';
+
+		for (;;)
+		{
+			const int recv_nbytes = recvfrom(
+				sock,
+				recv_buffer, sizeof(recv_buffer), 0,
+				reinterpret_cast<sockaddr*>(&client_addr), &socklen);
+
+			if (protocol::is_map_chunk(recv_buffer, recv_nbytes))
+			{
+				// The render thread is idle between frames, so the map can be replaced here
+				if (map_receiver.receive(recv_buffer, recv_nbytes))
+				{
+					if (world_map.load(map_receiver.data, map_receiver.size))
+					{
+						std::clog << "Loaded " << world_map.size_x << 'x' << world_map.size_y << " map\n";
+					}
+					else
+					{
+						std::cerr << "Failed to load map of " << map_receiver.size << " bytes\n";
+					}
+					map_receiver.reset();
+				}
+			}
+			else if (recv_nbytes == sizeof(cmd))
+			{
+				std::memcpy(&cmd, recv_buffer, sizeof(cmd));
+				frame_info.timestamp = cmd.pose.ts;
+
+				// Notify render thread to start a new frame when a new pose is received
+				render_task_notify.set_bits(frame_start_bit);
+
+				auto stream_elapsed = 0U;
+				pacer.reset_stats();
+
+				for (;;)
+				{
+					// Wait for render thread to queue the next packet
+					while (pkt_ring.get_read_size() == 0) stream_task_notify.wait_bits(pkt_ready_bit);
+
+					// Full packets go out together with the packet after them as GSO segments,
+					// as long as they fit in the pacer's burst
+					auto num_pkts = 1;
+					auto send_size = pkt_ring.get_read_slot(0)->get_size();
+					if (use_gso)
+					{
+						const auto num_queued = pkt_ring.get_read_size();
+						const auto max_send_size = (pacer.rate > 0) ? pacer.burst_size : INT64_MAX;
+						while (num_pkts < num_queued && pkt_ring.get_read_slot(num_pkts - 1)->get_size() == config::common::pkt_buffer_size)
+						{
+							const auto pkt_size = pkt_ring.get_read_slot(num_pkts)->get_size();
+							if (send_size + pkt_size > max_send_size) break;
+							send_size += pkt_size;
+							num_pkts++;
+						}
+					}
+
+					pacer.wait(send_size, get_time_us, [](int64_t us) { std::this_thread::sleep_for(std::chrono::microseconds(us)); });
+
+					stream_elapsed -= get_time_us();
+
+					// Without kernel support for GSO (EIO), send every packet on its own from now on
+					if (!send_packets(sock, client_addr, num_pkts, use_gso) && use_gso && errno == EIO)
+					{
+						std::cerr << "UDP GSO failed, sending one packet per call\n";
+						use_gso = false;
+						send_packets(sock, client_addr, num_pkts, false);
+					}
+
+					stream_elapsed += get_time_us();
+
+					protocol::pkt_info_t pkt_info;
+					protocol::read(pkt_ring.get_read_slot(num_pkts - 1)->header, pkt_info);
+
+					pkt_ring.commit_read(num_pkts);
+					render_task_notify.set_bits(slot_free_bit);
+
+					if (is_frame_end(pkt_info)) break;
+				} // for(pkt)
+
+				frame_info.stream_time_us  = stream_elapsed;
+				frame_info.pacing_delay_us = pacer.delay_us;
+				frame_info.num_paced_pkts  = pacer.num_delayed;
+			}
+			else
+			{
+				std::cerr << "Failed to receive upstream pose! errno=" << errno << '\n';
+				break;
+			}
+		} // inner loop
+
+		std::cerr << "Shutting down socket and restarting...\n";
+		shutdown(sock, 0);
+		close(sock);
+	} // outer loop
+}
+
+auto main(int argc, char** argv) -> int
+{
+	const auto port = (argc > 1) ? std::atoi(argv[1]) : default_port;
+
+
+	init_renderer(config::common::screen_width);
+	slice_layout.init(config::common::screen_width);
+
+	if (argc > 2 && !load_map_file(argv[2]))
+	{
+		std::cerr << "Failed to load map " << argv[2] << '\n';
+		return EXIT_FAILURE;
+	}
+
+	std::thread {render_task}.detach();
+
+	// Only returns if the socket cannot be created or bound
+	stream_task(port);
+
+	// Skip static destructors while the render thread is still blocked on its notification
+	std::quick_exit(EXIT_FAILURE);
+}
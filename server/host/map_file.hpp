@@ -0,0 +1,17 @@
+#pragma once
+
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "map.hpp"
+
+// Replace world_map with a map file from disk, see maps/generate_map.py
+auto load_map_file(const char* path) -> bool
+{
+	std::ifstream file {path, std::ios::binary};
+	if (!file) return false;
+
+	const std::vector<uint8_t> data {std::istreambuf_iterator<char> {file}, std::istreambuf_iterator<char> {}};
+	return world_map.load(data.data(), static_cast<int>(data.size()));
+}
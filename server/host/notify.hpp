@@ -0,0 +1,73 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+// Stand-in for FreeRTOS direct-to-task notifications on the host
+class task_notify_t
+{
+public:
+
+	// Like xTaskNotifyGive()
+	auto give() -> void
+	{
+		{
+			std::lock_guard lock {mutex};
+			value++;
+			is_pending = true;
+		}
+		cv.notify_one();
+	}
+
+	// Like xTaskNotify(..., eSetValueWithOverwrite)
+	auto notify(uint32_t value_) -> void
+	{
+		{
+			std::lock_guard lock {mutex};
+			value = value_;
+			is_pending = true;
+		}
+		cv.notify_one();
+	}
+
+	// Like ulTaskNotifyTake(pdTRUE, portMAX_DELAY)
+	auto take() -> uint32_t
+	{
+		std::unique_lock lock {mutex};
+		cv.wait(lock, [this](){ return is_pending; });
+		is_pending = false;
+		return std::exchange(value, 0);
+	}
+
+	// Like xTaskNotify(..., eSetBits)
+	auto set_bits(uint32_t bits) -> void
+	{
+		{
+			std::lock_guard lock {mutex};
+			value |= bits;
+			is_pending = true;
+		}
+		cv.notify_one();
+	}
+
+	// Wait until any of the bits is set and clear them, leaving the other bits for later waits
+	// Like ulTaskNotifyValueClear() in a loop with xTaskNotifyWait()
+	auto wait_bits(uint32_t bits) -> uint32_t
+	{
+		std::unique_lock lock {mutex};
+		cv.wait(lock, [this, bits](){ return (value & bits) != 0; });
+		const auto ready_bits = value & bits;
+		value &= ~bits;
+		is_pending = value != 0;
+		return ready_bits;
+	}
+
+private:
+
+	std::mutex mutex;
+	std::condition_variable cv;
+	uint32_t value {0};
+	bool is_pending {false};
+};
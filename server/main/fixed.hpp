@@ -0,0 +1,90 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+// Q16.16 fixed-point number
+struct fp32_t
+{
+    static constexpr auto frac_bits = 16;
+    static constexpr auto one = int32_t {1} << frac_bits;
+
+    int32_t value {0};
+
+    constexpr fp32_t() = default;
+    constexpr explicit fp32_t(float x) : value {static_cast<int32_t>(x * one + (x < 0 ? -0.5F : 0.5F))} {}
+    constexpr explicit fp32_t(int x) : value {x * one} {}
+
+    static constexpr auto from_raw(int32_t x) -> fp32_t { fp32_t r; r.value = x; return r; }
+
+    constexpr auto to_float() const -> float { return static_cast<float>(value) / one; }
+
+    // Floor, like casting a non-negative float to int
+    constexpr explicit operator int() const { return value >> frac_bits; }
+
+    constexpr auto operator+(const fp32_t& x) const -> fp32_t { return from_raw(value + x.value); }
+    constexpr auto operator-(const fp32_t& x) const -> fp32_t { return from_raw(value - x.value); }
+    constexpr auto operator*(const fp32_t& x) const -> fp32_t
+    {
+        return from_raw(static_cast<int32_t>((static_cast<int64_t>(value) * x.value) >> frac_bits));
+    }
+    constexpr auto operator-() const -> fp32_t { return from_raw(-value); }
+
+    constexpr auto operator+=(const fp32_t& x) -> fp32_t& { value += x.value; return *this; }
+
+    constexpr auto operator==(const fp32_t& x) const -> bool { return value == x.value; }
+    constexpr auto operator< (const fp32_t& x) const -> bool { return value <  x.value; }
+    constexpr auto operator> (const fp32_t& x) const -> bool { return value >  x.value; }
+};
+
+constexpr auto abs(fp32_t x) -> fp32_t { return x.value < 0 ? -x : x; }
+
+constexpr auto ceil_to_int(fp32_t x) -> int { return (x.value + fp32_t::one - 1) >> fp32_t::frac_bits; }
+
+constexpr auto fp32_max = fp32_t::from_raw(INT32_MAX);
+
+namespace detail
+{
+
+constexpr auto recip_table_bits = 8;
+
+// 2^30 / m for mantissas m in [1, 2) at the middle of each table interval
+constexpr auto make_recip_table()
+{
+    std::array<uint32_t, 1 << recip_table_bits> table {};
+    for (auto i = 0U; i < table.size(); i++)
+    {
+        const auto m = 1.0 + (i + 0.5) / table.size();
+        table[i] = static_cast<uint32_t>((1U << 30) / m);
+    }
+    return table;
+}
+
+constexpr auto recip_table = make_recip_table();
+
+} // namespace detail
+
+// 1 / x for x > 0 without a divide
+// Table lookup on the normalized mantissa followed by one Newton-Raphson step (~17 bits)
+// Saturates to fp32_max when the result does not fit
+constexpr auto recip(fp32_t x) -> fp32_t
+{
+    const auto v  = static_cast<uint32_t>(x.value);
+    const auto lz = __builtin_clz(v);
+
+    // x = M * 2^(15 - lz) with mantissa M = m / 2^31 in [1, 2)
+    const auto m = v << lz;
+
+    // r ~ 2^30 / M, refined with r = r * (2 - M * r)
+    const auto r0 = static_cast<uint64_t>(detail::recip_table[(m >> (31 - detail::recip_table_bits)) & ((1U << detail::recip_table_bits) - 1)]);
+    const auto e  = (uint64_t {1} << 31) - ((m * r0) >> 31);
+    const auto r  = (r0 * e) >> 30;
+
+    // 1 / x = r / 2^30 * 2^(lz - 15), as Q16.16
+    const auto shift = static_cast<int>(lz) - 29;
+    if (shift >= 0)
+    {
+        return (shift > 1 || r > (uint64_t {INT32_MAX} >> shift)) ? fp32_max : fp32_t::from_raw(static_cast<int32_t>(r << shift));
+    }
+    return fp32_t::from_raw(static_cast<int32_t>(r >> -shift));
+}
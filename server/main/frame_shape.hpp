@@ -0,0 +1,93 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+
+#include "common/codec.hpp"
+#include "common/config.hpp"
+#include "fixed.hpp"
+#include "textures/textures.hpp"
+
+// Frame dimensions the renderer is compiled for, with the tables that only depend on them
+// render_encode_slice() is instantiated per shape, so widths and heights are constants in the column loops
+template <int width_, int height_>
+struct frame_shape_t
+{
+    static constexpr auto width  = width_;
+    static constexpr auto height = height_;
+
+    // Literals and entropy-coded columns are built in buffers of the codec
+    static_assert(height <= codec::max_column_size);
+
+    static constexpr auto max_slice_width = config::common::get_max_slice_width(width);
+
+    // Hits are at least 0.1 away, so walls are at most 10 frames tall
+    static constexpr auto max_wall_len = 10 * height;
+
+    // Distance to the floor (ceiling) seen by every row below (above) the horizon, signed
+    // The horizon row is always covered by a wall and has no distance
+    static constexpr auto view_distances = []
+    {
+        std::array<float, height> table {};
+        for (auto i = 0; i < height; i++) table[i] = (2 * i == height) ? 0.0F : height / (2.0F * i - height);
+        return table;
+    }();
+
+    // Texels per pixel of a wall of every length, in float and in Q16.16
+    // Exactly texture_height / wall_len and recip(wall_len) * texture_height, which the renderer would otherwise compute per column
+    static constexpr auto tex_v_steps = []
+    {
+        std::array<float, max_wall_len + 1> table {};
+        for (auto i = 1; i <= max_wall_len; i++) table[i] = static_cast<float>(texture_height) / i;
+        return table;
+    }();
+
+    static constexpr auto tex_v_steps_fixed = []
+    {
+        std::array<fp32_t, max_wall_len + 1> table {};
+        for (auto i = 1; i <= max_wall_len; i++) table[i] = recip(fp32_t {i}) * fp32_t {texture_height};
+        return table;
+    }();
+
+    static auto get_tex_v_step(int wall_len) -> float
+    {
+        return (wall_len <= max_wall_len) ? tex_v_steps[wall_len] : static_cast<float>(texture_height) / wall_len;
+    }
+
+    static auto get_tex_v_step_fixed(int wall_len) -> fp32_t
+    {
+        return (wall_len <= max_wall_len) ? tex_v_steps_fixed[wall_len] : recip(fp32_t {wall_len}) * fp32_t {texture_height};
+    }
+};
+
+// Frame shapes compiled into the renderer, each one costs code and tables
+template <typename... shapes_t>
+struct frame_shape_list_t
+{
+    static constexpr auto max_width  = std::max({shapes_t::width...});
+    static constexpr auto max_height = std::max({shapes_t::height...});
+    static constexpr auto max_slice_width = std::max({shapes_t::max_slice_width...});
+
+    static constexpr auto contains(int width, int height) -> bool
+    {
+        return ((width == shapes_t::width && height == shapes_t::height) || ...);
+    }
+
+    // Call fn(shape_t {}) with the shape of the given dimensions, returns false if there is none
+    template <typename fn_t>
+    static auto dispatch(int width, int height, fn_t&& fn) -> bool
+    {
+        return ((width == shapes_t::width && height == shapes_t::height && (fn(shapes_t {}), true)) || ...);
+    }
+};
+
+using screen_shape_t = frame_shape_t<config::common::screen_width, config::common::screen_height>;
+
+// The host also renders at half resolution
+#if defined(ESP_PLATFORM)
+using frame_shapes_t = frame_shape_list_t<screen_shape_t>;
+#else
+using frame_shapes_t = frame_shape_list_t<
+    screen_shape_t,
+    frame_shape_t<config::common::screen_width / 2, config::common::screen_height / 2>>;
+#endif
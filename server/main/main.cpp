@@ -15,6 +15,7 @@
 #include "esp_event.h"
 #include "esp_log.h"
 #include "esp_timer.h"
+#include "esp_rom_sys.h"
 #include "nvs_flash.h"
 #include "esp_netif.h"
 #include "protocol_examples_common.h"
@@ -26,7 +27,11 @@
 
 #include "common/config.hpp"
 #include "common/protocol.hpp"
+#include "pacer.hpp"
 #include "raycaster.hpp"
+#include "slice_layout.hpp"
+#include "spsc_ring.hpp"
+#include "stream.hpp"
 #include "types.hpp"
 
 #define PORT CONFIG_EXAMPLE_PORT
@@ -36,40 +41,42 @@ static const char *TAG = "server";
 TaskHandle_t render_task_handle {nullptr};
 TaskHandle_t stream_task_handle {nullptr};
 
+// Wait until any of the bits is notified to the calling task and clear them, leaving the other bits for later waits
+// Bits set before the wait are found in the notification value, bits set later wake up the wait
+auto wait_notify_bits(uint32_t bits) -> void
+{
+    while (!(ulTaskNotifyValueClear(nullptr, bits) & bits)) xTaskNotifyWait(0, 0, nullptr, portMAX_DELAY);
+}
+
 render_command_t cmd;
 protocol::frame_info_t frame_info;
 
-// Double-buffered slice for simultaneous render and stream
-encoded_slice_t slice[2];
-
-auto render_task(void* params) -> void
-{
-    constexpr auto slice_width = config::common::screen_width / config::common::num_slices;
-
-    for (;;)
-    {
-		// Wait for network thread to start a new frame
-		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+// Received datagrams: render commands or chunks of a map pushed by the client
+uint8_t recv_buffer[config::common::pkt_buffer_size];
+map_receiver_t map_receiver;
 
-        auto index = 0U;
-        auto render_elapsed = 0U;
+// Encoded slices, read by the stream task straight from here when sending their packets
+uint8_t enc_ring[enc_ring_buffer_size];
+slice_layout_t slice_layout;
 
-        for (auto slice_id = 0; slice_id < config::common::num_slices; slice_id++)
-        {
-            render_elapsed -= esp_timer_get_time();
-            render_encode_slice(cmd, slice_id * slice_width, (slice_id + 1) * slice_width, slice[index]);
-            render_elapsed += esp_timer_get_time();
+// Packets queued by the render task for the stream task
+pkt_ring_t pkt_ring;
+pacer_t pacer;
 
-			// FIXME: Hack to ensure render thread is always slower than network thread
-			vTaskDelay(pdMS_TO_TICKS(2));
-
-			// Notify network thread to stream rendered slice and swap slice buffers
-			xTaskNotify(stream_task_handle, index, eSetValueWithOverwrite);
-			index = !index;
-        }
+// Pacing waits are mostly shorter than a tick, those spin instead of sleeping
+auto sleep_us(int64_t us) -> void
+{
+    constexpr auto tick_us = portTICK_PERIOD_MS * 1000;
+    if (us >= tick_us) vTaskDelay(us / tick_us);
+    else esp_rom_delay_us(us);
+}
 
-        frame_info.render_time_us = render_elapsed;
-    }
+auto render_task(void* params) -> void
+{
+    run_render_task(cmd, frame_info, slice_layout, pkt_ring, enc_ring,
+        wait_notify_bits,
+        [] { xTaskNotify(stream_task_handle, pkt_ready_bit, eSetBits); },
+        esp_timer_get_time);
 
     vTaskDelete(nullptr);
 }
@@ -81,8 +88,6 @@ auto stream_task(void* params) -> void
     struct sockaddr_in6 client_addr;
     socklen_t socklen = sizeof(client_addr);
 
-    uint8_t pkt_buffer[config::common::pkt_buffer_size];
-
     for (;;)
     {
         if (addr_family == AF_INET)
@@ -135,6 +140,8 @@ auto stream_task(void* params) -> void
         constexpr auto flag = 1;
         setsockopt(sock, SOL_SOCKET, SO_DONTROUTE, &flag, sizeof(flag));
 
+        pacer.init(config::server::pacing_rate, config::server::pacing_burst_size, esp_timer_get_time());
+
         //constexpr auto rcvbuf_size = sizeof(render_command_t);
         //setsockopt(sock, SOL_SOCKET, SO_RCVBUF, &rcvbuf_size, sizeof(rcvbuf_size));
 
@@ -146,77 +153,73 @@ auto stream_task(void* params) -> void
         }
         ESP_LOGI(TAG, "Socket bound to port %d", PORT);
 
-        const auto frame_info_ptr = pkt_buffer + config::common::pkt_buffer_size - sizeof(frame_info);
-
         for (;;)
         {
             const int recv_nbytes = recvfrom(
 				sock,
-				&cmd, sizeof(cmd), 0,
+				recv_buffer, sizeof(recv_buffer), 0,
 				reinterpret_cast<struct sockaddr*>(&client_addr), &socklen);
 
-            frame_info.timestamp = cmd.pose.ts;
-
-            if (recv_nbytes == sizeof(cmd))
+            if (protocol::is_map_chunk(recv_buffer, recv_nbytes))
+            {
+                // The render task is idle between frames, so the map can be replaced here
+                if (map_receiver.receive(recv_buffer, recv_nbytes))
+                {
+                    if (world_map.load(map_receiver.data, map_receiver.size))
+                    {
+                        ESP_LOGI(TAG, "Loaded %dx%d map", world_map.size_x, world_map.size_y);
+                    }
+                    else
+                    {
+                        ESP_LOGE(TAG, "Failed to load map of %d bytes", map_receiver.size);
+                    }
+                    map_receiver.reset();
+                }
+            }
+            else if (recv_nbytes == sizeof(cmd))
             {
+                std::memcpy(&cmd, recv_buffer, sizeof(cmd));
+                frame_info.timestamp = cmd.pose.ts;
+
 				// Notify render thread to start a new frame when a new pose is received
-				xTaskNotifyGive(render_task_handle);
+				xTaskNotify(render_task_handle, frame_start_bit, eSetBits);
 
                 auto stream_elapsed = 0U;
+                pacer.reset_stats();
 
-                for (auto slice_id = 0; slice_id < config::common::num_slices; slice_id++)
+                for (;;)
                 {
-					// Wait for render thread to signal that the rendered slice is ready for streaming
-					const auto index = ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+					// Wait for render thread to queue the next packet
+					const packet_t* pkt = nullptr;
+					while (!(pkt = pkt_ring.get_read_slot())) wait_notify_bits(pkt_ready_bit);
+
+                    pacer.wait(pkt->get_size(), esp_timer_get_time, sleep_us);
 
                     stream_elapsed -= esp_timer_get_time();
 
-                    auto slice_ptr = slice[index].buffer;
-                    const auto slice_end = slice[index].buffer + slice[index].size;
+                    // Header, payload and trailer are gathered from where they are, the payload is not copied
+                    iovec iov[max_pkt_iovecs];
+                    msghdr msg {};
+                    msg.msg_name    = &client_addr;
+                    msg.msg_namelen = sizeof(client_addr);
+                    msg.msg_iov     = iov;
+                    msg.msg_iovlen  = get_pkt_iovecs(*pkt, iov);
+                    sendmsg(sock, &msg, 0);
 
-                    auto pkt_id = 0;
-                    auto is_slice_end = false;
-                    while (slice_ptr < slice_end)
-                    {
-                        // Split encoded slice buffer into as many full packets as possible
-                        constexpr auto max_pkt_payload_size = config::common::pkt_buffer_size - sizeof(protocol::pkt_info_t);
-                        constexpr auto min_pkt_payload_size = max_pkt_payload_size - sizeof(protocol::frame_info_t);
-                        const auto rem_size = slice_end - slice_ptr;
-                        const auto payload_size = std::min<int>(rem_size, max_pkt_payload_size);
-                        is_slice_end = rem_size <= min_pkt_payload_size;
-
-						auto pkt_ptr = pkt_buffer;
-                        pkt_ptr = protocol::write_pkt_info(is_slice_end, 1, slice_id, pkt_id, pkt_ptr);
-						pkt_ptr = protocol::write_payload(slice_ptr, payload_size, pkt_ptr);
-
-                        // Add frame info to last packet if there is space
-                        const auto frame_end = (slice_id == (config::common::num_slices - 1));
-                        if (frame_end && is_slice_end) protocol::write(frame_info, frame_info_ptr);
-
-                        sendto(
-							sock,
-							pkt_buffer, config::common::pkt_buffer_size, 0,
-							reinterpret_cast<sockaddr *>(&client_addr), sizeof(client_addr));
-
-                        pkt_id++;
-                        slice_ptr += payload_size;
-                    }
+                    stream_elapsed += esp_timer_get_time();
 
-                    // Send frame info as an additional packet if ther was no space in the last packet
-                    if (!is_slice_end)
-                    {
-                        protocol::write_pkt_info(1, 0, config::common::num_slices - 1, pkt_id, pkt_buffer);
-                        protocol::write(frame_info, frame_info_ptr);
-                        sendto(
-							sock,
-							pkt_buffer, config::common::pkt_buffer_size, 0,
-							reinterpret_cast<sockaddr *>(&client_addr), sizeof(client_addr));
-                    }
+                    protocol::pkt_info_t pkt_info;
+                    protocol::read(pkt->header, pkt_info);
 
-                    stream_elapsed += esp_timer_get_time();
-                } // for(slice_id)
+                    pkt_ring.commit_read();
+                    xTaskNotify(render_task_handle, slot_free_bit, eSetBits);
+
+                    if (is_frame_end(pkt_info)) break;
+                } // for(pkt)
 
-                frame_info.stream_time_us = stream_elapsed;
+                frame_info.stream_time_us  = stream_elapsed;
+                frame_info.pacing_delay_us = pacer.delay_us;
+                frame_info.num_paced_pkts  = pacer.num_delayed;
             }
             else
             {
@@ -252,15 +255,8 @@ void app_main(void)
      */
     ESP_ERROR_CHECK(example_connect());
 
-    slice[0].width  = config::common::screen_width;
-    slice[0].height = config::common::screen_height;
-    slice[0].buffer = reinterpret_cast<uint8_t*>(malloc(config::common::slice_buffer_size));
-
-    slice[1].width  = config::common::screen_width;
-    slice[1].height = config::common::screen_height;
-    slice[1].buffer = reinterpret_cast<uint8_t*>(malloc(config::common::slice_buffer_size));
-
-    init_renderer(config::common::screen_width, config::common::screen_height);
+    init_renderer(config::common::screen_width);
+    slice_layout.init(config::common::screen_width);
 
     xTaskCreatePinnedToCore(render_task, "render_task", 4096, nullptr, 5, &render_task_handle, 1);
 
@@ -0,0 +1,354 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+
+#include "types.hpp"
+#include "common/protocol.hpp"
+#include "textures/textures.hpp"
+
+// Built-in map, used until a map file is loaded
+constexpr auto default_map_size_x = 24;
+constexpr auto default_map_size_y = 24;
+
+constexpr uint8_t default_map[default_map_size_x][default_map_size_y] = {
+    {8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 4, 4, 6, 4, 4, 6, 4, 6, 4, 4, 4, 6, 4},
+    {8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4},
+    {8, 0, 3, 3, 0, 0, 0, 0, 0, 8, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6},
+    {8, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6},
+    {8, 0, 3, 3, 0, 0, 0, 0, 0, 8, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4},
+    {8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 4, 0, 0, 0, 0, 0, 6, 6, 6, 0, 6, 4, 6},
+    {8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 4, 4, 4, 4, 4, 4, 6, 0, 0, 0, 0, 0, 6},
+    {7, 7, 7, 7, 0, 7, 7, 7, 7, 0, 8, 0, 8, 0, 8, 0, 8, 4, 0, 4, 0, 6, 0, 6},
+    {7, 7, 0, 0, 0, 0, 0, 0, 7, 8, 0, 8, 0, 8, 0, 8, 8, 6, 0, 0, 0, 0, 0, 6},
+    {7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 6, 0, 0, 0, 0, 0, 4},
+    {7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 6, 0, 6, 0, 6, 0, 6},
+    {7, 7, 0, 0, 0, 0, 0, 0, 7, 8, 0, 8, 0, 8, 0, 8, 8, 6, 4, 6, 0, 6, 6, 6},
+    {7, 7, 7, 7, 0, 7, 7, 7, 7, 8, 8, 4, 0, 6, 8, 4, 8, 3, 3, 3, 0, 3, 3, 3},
+    {2, 2, 2, 2, 0, 2, 2, 2, 2, 4, 6, 4, 0, 0, 6, 0, 6, 3, 0, 0, 0, 0, 0, 3},
+    {2, 2, 0, 0, 0, 0, 0, 2, 2, 4, 0, 0, 0, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0, 3},
+    {2, 0, 0, 0, 0, 0, 0, 0, 2, 4, 0, 0, 0, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0, 3},
+    {1, 0, 0, 0, 0, 0, 0, 0, 1, 4, 4, 4, 4, 4, 6, 0, 6, 3, 3, 0, 0, 0, 3, 3},
+    {2, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 1, 2, 2, 2, 6, 6, 0, 0, 5, 0, 5, 0, 5},
+    {2, 2, 0, 0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 2, 2, 0, 5, 0, 5, 0, 0, 0, 5, 5},
+    {2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 5, 0, 5, 0, 5, 0, 5, 0, 5},
+    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5},
+    {2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 5, 0, 5, 0, 5, 0, 5, 0, 5},
+    {2, 2, 0, 0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 2, 2, 0, 5, 0, 5, 0, 0, 0, 5, 5},
+    {2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 5, 5, 5, 5, 5, 5, 5, 5, 5},
+};
+
+constexpr auto barrel_texture_id = 8;
+
+constexpr sprite_t default_sprites[] = {
+    {20.5F, 11.5F, 0.75F, barrel_texture_id},
+    {18.5F,  4.5F, 0.75F, barrel_texture_id},
+    {10.0F,  4.5F, 0.75F, barrel_texture_id},
+    {10.0F, 12.5F, 0.75F, barrel_texture_id},
+    { 3.5F,  6.5F, 0.75F, barrel_texture_id},
+    { 3.5F, 20.5F, 0.75F, barrel_texture_id},
+    { 3.5F, 14.5F, 0.75F, barrel_texture_id},
+    {14.5F, 20.5F, 0.75F, barrel_texture_id},
+    {18.5F, 10.5F, 0.75F, barrel_texture_id},
+    {18.5F, 11.5F, 0.75F, barrel_texture_id},
+    {18.5F, 12.5F, 0.75F, barrel_texture_id},
+    {21.5F,  1.5F, 0.75F, barrel_texture_id},
+    {15.5F,  1.5F, 0.75F, barrel_texture_id},
+    {16.0F,  1.8F, 0.75F, barrel_texture_id},
+    {16.2F,  1.2F, 0.75F, barrel_texture_id},
+    { 3.5F,  2.5F, 0.75F, barrel_texture_id},
+    { 9.5F, 15.5F, 0.75F, barrel_texture_id},
+    {10.0F, 15.1F, 0.75F, barrel_texture_id},
+    {10.5F, 15.8F, 0.75F, barrel_texture_id},
+};
+
+// Map file, little endian, generated by maps/generate_map.py:
+//  - map_file_header_t
+//  - num_sprites x sprite_t
+//  - Cells in the tiled order of map_t, as (value, length) byte pairs with lengths in [1, 255]
+struct map_file_header_t
+{
+    static constexpr uint32_t magic_value = 0x504D4352; // "RCMP"
+    static constexpr uint8_t version_value = 1;
+
+    uint32_t magic       {magic_value};
+    uint8_t  version     {version_value};
+    uint8_t  tile_bits   {0};
+    uint16_t num_sprites {0};
+    uint32_t size_x      {0};
+    uint32_t size_y      {0};
+};
+
+// Grid of map cells stored in square tiles of tile_size x tile_size cells
+// A tile is one 64 byte cache line, so a ray (or a packet of rays) touches few lines per step
+// in any direction, even on 1024x1024+ maps where a row of the plain [x][y] layout spans kilobytes
+struct map_t
+{
+    static constexpr auto tile_bits = 3;
+    static constexpr auto tile_size = 1 << tile_bits;
+    static constexpr auto tile_mask = tile_size - 1;
+    static constexpr auto max_size  = 1 << 14; // Keeps max_map_file_size within int
+
+    int size_x {0};
+    int size_y {0};
+    int num_tiles_y {0};
+    uint8_t* cells {nullptr};
+
+    // Chessboard distance of every cell to the nearest wall or to the outside of the map, saturated to 255
+    // Every cell closer than its distance to an empty cell is empty too, so rays can skip them
+    uint8_t* distances {nullptr};
+
+    sprite_t* sprites {nullptr};
+    int num_sprites {0};
+
+    auto is_inside(int x, int y) const -> bool
+    {
+        return static_cast<unsigned>(x) < static_cast<unsigned>(size_x) && static_cast<unsigned>(y) < static_cast<unsigned>(size_y);
+    }
+
+    auto get_index(int x, int y) const -> int
+    {
+        const auto tile_id = (x >> tile_bits) * num_tiles_y + (y >> tile_bits);
+        return (tile_id << (2 * tile_bits)) | ((x & tile_mask) << tile_bits) | (y & tile_mask);
+    }
+
+    auto get(int x, int y) const -> uint8_t { return cells[get_index(x, y)]; }
+
+    auto get_distance(int x, int y) const -> int { return distances[get_index(x, y)]; }
+
+    static constexpr auto get_num_cells(int size_x, int size_y) -> int
+    {
+        return ((size_x + tile_mask) >> tile_bits) * ((size_y + tile_mask) >> tile_bits) << (2 * tile_bits);
+    }
+
+    auto load_default() -> bool
+    {
+        if (!allocate(default_map_size_x, default_map_size_y, std::size(default_sprites))) return false;
+
+        for (auto x = 0; x < size_x; x++)
+        {
+            for (auto y = 0; y < size_y; y++) cells[get_index(x, y)] = default_map[x][y];
+        }
+        std::copy(std::begin(default_sprites), std::end(default_sprites), sprites);
+        compute_distances();
+        return true;
+    }
+
+    // Replaces the map with a map file
+    // Returns false and keeps the current map if the file is invalid or does not fit in memory
+    // Maps come from the client, so every cell and sprite is checked before the renderer indexes textures with it
+    auto load(const uint8_t* data, int size) -> bool
+    {
+        map_file_header_t header;
+        if (size < static_cast<int>(sizeof(header))) return false;
+        std::memcpy(&header, data, sizeof(header));
+
+        if (header.magic != map_file_header_t::magic_value ||
+            header.version != map_file_header_t::version_value ||
+            header.tile_bits != tile_bits ||
+            header.size_x < 1 || header.size_x > max_size ||
+            header.size_y < 1 || header.size_y > max_size)
+        {
+            return false;
+        }
+
+        auto src = data + sizeof(header);
+        const auto src_end = data + size;
+
+        const auto sprites_size = header.num_sprites * static_cast<int>(sizeof(sprite_t));
+        if (src_end - src < sprites_size) return false;
+
+        map_t map;
+        if (!map.allocate(header.size_x, header.size_y, header.num_sprites)) return false;
+
+        std::memcpy(map.sprites, src, sprites_size);
+        src += sprites_size;
+
+        const auto num_cells = get_num_cells(map.size_x, map.size_y);
+        auto num_decoded = 0;
+        for (; src + 1 < src_end && num_decoded < num_cells; src += 2)
+        {
+            const auto len = std::min<int>(src[1], num_cells - num_decoded);
+            std::memset(map.cells + num_decoded, src[0], len);
+            num_decoded += len;
+        }
+
+        if (num_decoded != num_cells || src != src_end || !map.is_valid())
+        {
+            map.release();
+            return false;
+        }
+
+        map.compute_distances();
+
+        release();
+        *this = map;
+        return true;
+    }
+
+    // Cells are empty or one of the textures and the border is closed, so every ray from inside the map hits a wall
+    // Sprites have a texture, a finite position in the map and a finite size up to max_size,
+    // so that their projection to columns and rows stays within int
+    auto is_valid() const -> bool
+    {
+        for (auto x = 0; x < size_x; x++)
+        {
+            for (auto y = 0; y < size_y; y++)
+            {
+                const auto cell = get(x, y);
+                const auto is_border = (x == 0 || y == 0 || x == size_x - 1 || y == size_y - 1);
+                if (cell > num_textures || (is_border && cell == 0)) return false;
+            }
+        }
+
+        return std::all_of(sprites, sprites + num_sprites, [this](const sprite_t& sprite)
+        {
+            if (!std::isfinite(sprite.pos_x) || !std::isfinite(sprite.pos_y) || !std::isfinite(sprite.size)) return false;
+            return sprite.tex_id >= 0 && sprite.tex_id < num_textures &&
+                sprite.pos_x >= 0.0F && sprite.pos_x <= size_x &&
+                sprite.pos_y >= 0.0F && sprite.pos_y <= size_y &&
+                sprite.size > 0.0F && sprite.size <= max_size;
+        });
+    }
+
+    // Two-pass chamfer transform with unit steps to all 8 neighbors, exact for the chessboard distance
+    auto compute_distances() -> void
+    {
+        constexpr auto max_distance = 255;
+
+        for (auto x = 0; x < size_x; x++)
+        {
+            for (auto y = 0; y < size_y; y++)
+            {
+                const auto to_outside = std::min({x + 1, y + 1, size_x - x, size_y - y, max_distance});
+                auto distance = (get(x, y) > 0) ? 0 : to_outside;
+                if (x > 0)
+                {
+                    distance = std::min(distance, get_distance(x - 1, y) + 1);
+                    if (y > 0)          distance = std::min(distance, get_distance(x - 1, y - 1) + 1);
+                    if (y < size_y - 1) distance = std::min(distance, get_distance(x - 1, y + 1) + 1);
+                }
+                if (y > 0) distance = std::min(distance, get_distance(x, y - 1) + 1);
+                distances[get_index(x, y)] = distance;
+            }
+        }
+
+        for (auto x = size_x - 1; x >= 0; x--)
+        {
+            for (auto y = size_y - 1; y >= 0; y--)
+            {
+                auto distance = get_distance(x, y);
+                if (x < size_x - 1)
+                {
+                    distance = std::min(distance, get_distance(x + 1, y) + 1);
+                    if (y > 0)          distance = std::min(distance, get_distance(x + 1, y - 1) + 1);
+                    if (y < size_y - 1) distance = std::min(distance, get_distance(x + 1, y + 1) + 1);
+                }
+                if (y < size_y - 1) distance = std::min(distance, get_distance(x, y + 1) + 1);
+                distances[get_index(x, y)] = distance;
+            }
+        }
+    }
+
+    auto allocate(int size_x_, int size_y_, int num_sprites_) -> bool
+    {
+        map_t map;
+        map.size_x = size_x_;
+        map.size_y = size_y_;
+        map.num_tiles_y = (size_y_ + tile_mask) >> tile_bits;
+        map.num_sprites = num_sprites_;
+        map.cells     = reinterpret_cast<uint8_t*>(malloc(get_num_cells(size_x_, size_y_)));
+        map.distances = reinterpret_cast<uint8_t*>(malloc(get_num_cells(size_x_, size_y_)));
+        map.sprites   = reinterpret_cast<sprite_t*>(malloc(std::max(num_sprites_, 1) * sizeof(sprite_t)));
+        if (!map.cells || !map.distances || !map.sprites)
+        {
+            map.release();
+            return false;
+        }
+
+        release();
+        *this = map;
+        return true;
+    }
+
+    auto release() -> void
+    {
+        free(cells);
+        free(distances);
+        free(sprites);
+        *this = {};
+    }
+};
+
+map_t world_map;
+
+// Largest map file load() accepts: every sprite and every cell in a run of its own
+constexpr auto max_map_file_size =
+    static_cast<int64_t>(sizeof(map_file_header_t) + UINT16_MAX * sizeof(sprite_t)) +
+    2 * static_cast<int64_t>(map_t::get_num_cells(map_t::max_size, map_t::max_size));
+static_assert(max_map_file_size <= INT32_MAX, "Map files are received and loaded with int sizes");
+
+// Reassembles a map file pushed by the client as protocol::map_chunk_t datagrams, received in any order
+// Chunks of an earlier, different file are dropped when the file size changes
+struct map_receiver_t
+{
+    uint8_t* data {nullptr};
+    int size {0};
+    int num_chunks {0};
+    int num_received {0};
+    uint8_t* is_received {nullptr};
+
+    // Returns true once every chunk of the file has been received
+    auto receive(const uint8_t* pkt, int pkt_size) -> bool
+    {
+        protocol::map_chunk_t chunk;
+        if (pkt_size < static_cast<int>(sizeof(chunk))) return false;
+        const auto payload = protocol::read(pkt, chunk);
+        const auto payload_size = pkt_size - static_cast<int>(sizeof(chunk));
+
+        if (chunk.magic != protocol::map_chunk_t::magic_value) return false;
+
+        // The file size is only allocated once it is known to fit a map
+        if (chunk.file_size == 0 || chunk.file_size > max_map_file_size) return false;
+
+        if (static_cast<int>(chunk.file_size) != size)
+        {
+            reset();
+            data = reinterpret_cast<uint8_t*>(malloc(chunk.file_size));
+            num_chunks = (chunk.file_size + protocol::max_map_chunk_size - 1) / protocol::max_map_chunk_size;
+            is_received = reinterpret_cast<uint8_t*>(calloc(std::max(num_chunks, 1), 1));
+            if (!data || !is_received)
+            {
+                reset();
+                return false;
+            }
+            size = chunk.file_size;
+        }
+
+        const auto chunk_id = chunk.offset / protocol::max_map_chunk_size;
+        const auto chunk_size = std::min<int>(protocol::max_map_chunk_size, size - chunk.offset);
+        if (chunk.offset % protocol::max_map_chunk_size != 0 || static_cast<int>(chunk_id) >= num_chunks || payload_size != chunk_size)
+        {
+            return false;
+        }
+
+        if (!is_received[chunk_id])
+        {
+            std::memcpy(data + chunk.offset, payload, chunk_size);
+            is_received[chunk_id] = 1;
+            num_received++;
+        }
+        return num_received == num_chunks;
+    }
+
+    auto reset() -> void
+    {
+        free(data);
+        free(is_received);
+        *this = {};
+    }
+};
@@ -0,0 +1,67 @@
+#!/usr/bin/python
+
+# Generates a random map file for the server, see map_file_header_t in map.hpp
+
+import argparse
+import numpy as np
+import pathlib
+import struct
+
+MAP_MAGIC = 0x504D4352 # "RCMP"
+MAP_VERSION = 1
+TILE_BITS = 3 # map_t::tile_bits
+NUM_WALL_TEXTURES = 8
+BARREL_TEXTURE_ID = 8
+
+parser = argparse.ArgumentParser()
+parser.add_argument("map_path", type=pathlib.Path, help="path to output map file")
+parser.add_argument("--size", type=int, default=1024, help="map width and height in cells")
+parser.add_argument("--density", type=float, default=0.05, help="fraction of 2x2 blocks that are walls")
+parser.add_argument("--num-sprites", type=int, default=256, help="number of barrels")
+parser.add_argument("--seed", type=int, default=0)
+args = parser.parse_args()
+
+rng = np.random.default_rng(args.seed)
+size = args.size
+
+# Random 2x2 wall blocks inside a closed border, cells indexed [x][y] like default_map
+blocks = rng.random(((size + 1) // 2, (size + 1) // 2)) < args.density
+textures = rng.integers(1, NUM_WALL_TEXTURES + 1, size=blocks.shape)
+cells = np.where(blocks, textures, 0).repeat(2, axis=0).repeat(2, axis=1)[:size, :size].astype(np.uint8)
+
+border = rng.integers(1, NUM_WALL_TEXTURES + 1, size=(size, size)).astype(np.uint8)
+cells[0, :] = border[0, :]
+cells[-1, :] = border[-1, :]
+cells[:, 0] = border[:, 0]
+cells[:, -1] = border[:, -1]
+
+# Barrels at the centers of random empty cells
+empty_x, empty_y = np.nonzero(cells == 0)
+picks = rng.choice(len(empty_x), size=min(args.num_sprites, len(empty_x)), replace=False)
+sprites = [(empty_x[i] + 0.5, empty_y[i] + 0.5, 0.75, BARREL_TEXTURE_ID) for i in picks]
+
+# Tiled layout: tiles in [x][y] order, cells in [x][y] order within a tile
+tile_size = 1 << TILE_BITS
+num_tiles = (size + tile_size - 1) // tile_size
+padded = np.zeros((num_tiles * tile_size, num_tiles * tile_size), dtype=np.uint8)
+padded[:size, :size] = cells
+tiled = padded.reshape(num_tiles, tile_size, num_tiles, tile_size).transpose(0, 2, 1, 3).ravel()
+
+# Run-length encode as (value, length) byte pairs
+run_starts = np.concatenate(([0], np.nonzero(np.diff(tiled))[0] + 1))
+run_lengths = np.diff(np.concatenate((run_starts, [len(tiled)])))
+rle = bytearray()
+for start, length in zip(run_starts, run_lengths):
+    value = int(tiled[start])
+    while length > 0:
+        n = min(int(length), 255)
+        rle += bytes((value, n))
+        length -= n
+
+with open(args.map_path, "wb") as f:
+    f.write(struct.pack("<IBBHII", MAP_MAGIC, MAP_VERSION, TILE_BITS, len(sprites), size, size))
+    for sprite in sprites:
+        f.write(struct.pack("<fffi", *sprite))
+    f.write(rle)
+
+print(f"Saved {size}x{size} map with {len(sprites)} sprites to {args.map_path} ({16 + 16 * len(sprites) + len(rle)} bytes)")
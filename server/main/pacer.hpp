@@ -0,0 +1,72 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+// Token bucket pacing the packets of the stream task, so a slice does not leave as one burst
+// that overflows the socket buffers of the access point and the client
+// Tokens are bytes, refilled at rate bytes per second up to burst_size, and a packet waits until there are enough for it
+// Clocks and waits are passed in, as the ESP32 and the host have their own
+struct pacer_t
+{
+    static constexpr auto us_per_s = int64_t {1'000'000};
+
+    int64_t rate {0}; // Bytes per second, 0 = unpaced
+    int64_t burst_size {0};
+
+    // Tokens in bytes * us_per_s, so refills do not round away fractions of a byte
+    int64_t tokens {0};
+    int64_t last_time_us {0};
+
+    // Time spent waiting for tokens and the number of sends that waited, since the last reset_stats()
+    int64_t delay_us {0};
+    int num_delayed {0};
+
+    auto init(int64_t rate_, int64_t burst_size_, int64_t now_us) -> void
+    {
+        rate = rate_;
+        burst_size = burst_size_;
+        tokens = burst_size * us_per_s;
+        last_time_us = now_us;
+    }
+
+    auto reset_stats() -> void
+    {
+        delay_us = 0;
+        num_delayed = 0;
+    }
+
+    // Time until there are tokens for size bytes
+    auto get_delay_us(int size, int64_t now_us) -> int64_t
+    {
+        tokens = std::min(tokens + (now_us - last_time_us) * rate, burst_size * us_per_s);
+        last_time_us = now_us;
+
+        const auto missing = size * us_per_s - tokens;
+        return (missing <= 0) ? 0 : (missing + rate - 1) / rate;
+    }
+
+    // Wait until size bytes can be sent and take their tokens
+    // Sends larger than burst_size wait for a full bucket and leave it in debt
+    template <typename clock_t, typename sleep_t>
+    auto wait(int size, clock_t&& get_time_us, sleep_t&& sleep_us) -> void
+    {
+        if (rate == 0) return;
+
+        const auto paced_size = static_cast<int>(std::min<int64_t>(size, burst_size));
+        const auto start_us = get_time_us();
+        auto now_us = start_us;
+        for (auto wait_us = get_delay_us(paced_size, now_us); wait_us > 0; wait_us = get_delay_us(paced_size, now_us))
+        {
+            sleep_us(wait_us);
+            now_us = get_time_us();
+        }
+        tokens -= size * us_per_s;
+
+        if (now_us > start_us)
+        {
+            delay_us += now_us - start_us;
+            num_delayed++;
+        }
+    }
+};
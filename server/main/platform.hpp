@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+
+// Cheap tick counter for profiling inner render loops, where esp_timer_get_time() is too coarse
+// Tick differences wrap safely as long as a measured interval is shorter than 2^32 ticks
+
+#if defined(ESP_PLATFORM)
+
+#include "esp_cpu.h"
+#include "sdkconfig.h"
+
+inline auto get_ticks() -> uint32_t { return esp_cpu_get_cycle_count(); }
+
+inline auto get_ticks_per_us() -> uint32_t { return CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ; }
+
+#elif defined(__x86_64__) || defined(__i386__)
+
+#include <chrono>
+#include <x86intrin.h>
+
+inline auto get_ticks() -> uint32_t { return static_cast<uint32_t>(__rdtsc()); }
+
+// TSC rate measured once against the steady clock
+inline auto get_ticks_per_us() -> uint32_t
+{
+    static const auto ticks_per_us = []()
+    {
+        const auto t0 = std::chrono::steady_clock::now();
+        const auto c0 = __rdtsc();
+        while (std::chrono::steady_clock::now() - t0 < std::chrono::milliseconds(10));
+        const auto c1 = __rdtsc();
+        const auto t1 = std::chrono::steady_clock::now();
+        const auto us = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+        return static_cast<uint32_t>((c1 - c0) / us);
+    }();
+    return ticks_per_us;
+}
+
+#else
+
+#include <chrono>
+
+inline auto get_ticks() -> uint32_t
+{
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+inline auto get_ticks_per_us() -> uint32_t { return 1000; }
+
+#endif
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "map.hpp"
+#include "types.hpp"
+
+// SoA lanes using GCC vector extensions
+// Lowered to SSE/AVX on the host and to plain scalar code on targets without SIMD
+template <int num_lanes>
+struct lanes_t
+{
+    typedef float   f32 __attribute__((vector_size(num_lanes * sizeof(float))));
+    typedef int32_t i32 __attribute__((vector_size(num_lanes * sizeof(int32_t))));
+};
+
+// Walk the map grid along num_lanes adjacent rays together (packet DDA)
+// Lanes are masked out as they hit walls and the packet finishes when all lanes are done
+// Produces the same hits as cast_ray() lane for lane
+// Returns the number of cells visited by all lanes
+template <int num_lanes>
+auto cast_ray_packet(
+    const pose_t& pose,
+    const float* ray_dirs_x,
+    const float* ray_dirs_y,
+    bool use_distance_field,
+    ray_hit_t* hits) -> int
+{
+    using f32 = typename lanes_t<num_lanes>::f32;
+    using i32 = typename lanes_t<num_lanes>::i32;
+
+    f32 ray_dir_x;
+    f32 ray_dir_y;
+    std::memcpy(&ray_dir_x, ray_dirs_x, sizeof(ray_dir_x));
+    std::memcpy(&ray_dir_y, ray_dirs_y, sizeof(ray_dir_y));
+
+    const auto pos_map_x = static_cast<int>(pose.pos_x);
+    const auto pos_map_y = static_cast<int>(pose.pos_y);
+
+    i32 map_x = i32 {} + pos_map_x;
+    i32 map_y = i32 {} + pos_map_y;
+
+    const f32 zero = f32 {};
+    const f32 huge = zero + 1e30F;
+    const f32 one  = zero + 1.0F;
+
+    // abs(1 / ray_dir) without a libm call per lane
+    const f32 inv_dir_x = one / ray_dir_x;
+    const f32 inv_dir_y = one / ray_dir_y;
+    const f32 delta_dist_x = (ray_dir_x == 0) ? huge : ((inv_dir_x < 0) ? -inv_dir_x : inv_dir_x);
+    const f32 delta_dist_y = (ray_dir_y == 0) ? huge : ((inv_dir_y < 0) ? -inv_dir_y : inv_dir_y);
+
+    const i32 is_neg_x = ray_dir_x < 0;
+    const i32 is_neg_y = ray_dir_y < 0;
+
+    const i32 step_x = is_neg_x ? (i32 {} - 1) : (i32 {} + 1);
+    const i32 step_y = is_neg_y ? (i32 {} - 1) : (i32 {} + 1);
+
+    f32 side_dist_x = is_neg_x ?
+        (zero + (pose.pos_x - pos_map_x)) * delta_dist_x :
+        (zero + (pos_map_x + 1.0F - pose.pos_x)) * delta_dist_x;
+    f32 side_dist_y = is_neg_y ?
+        (zero + (pose.pos_y - pos_map_y)) * delta_dist_y :
+        (zero + (pos_map_y + 1.0F - pose.pos_y)) * delta_dist_y;
+
+    i32 is_front_side = i32 {} - 1;
+    i32 is_active     = i32 {} - 1;
+    i32 cell          = i32 {};
+    i32 distance      = i32 {} + 1;
+
+    auto num_steps = 0;
+
+    for (;;)
+    {
+        // Map lookups are gathers, so test active lanes one by one
+        auto num_active = 0;
+        auto num_skipping = 0;
+        for (auto i = 0; i < num_lanes; i++)
+        {
+            distance[i] = 1;
+            if (!is_active[i]) continue;
+
+            const auto x = map_x[i];
+            const auto y = map_y[i];
+            if (!world_map.is_inside(x, y))
+            {
+                is_active[i] = 0;
+                continue;
+            }
+
+            const auto cell_id = world_map.get_index(x, y);
+            cell[i] = world_map.cells[cell_id];
+            if (cell[i] > 0)
+            {
+                is_active[i] = 0;
+                continue;
+            }
+            num_active++;
+
+            if (use_distance_field)
+            {
+                distance[i] = world_map.distances[cell_id];
+                num_skipping += distance[i] > 1;
+            }
+        }
+        if (num_active == 0) break;
+        num_steps += num_active;
+
+        // Jump lanes far from walls across the empty square around their cell, see skip_empty_cells()
+        i32 is_skip = i32 {};
+        if (num_skipping > 0)
+        {
+            is_skip = (distance > 1) & is_active;
+
+            const f32 radius = __builtin_convertvector(distance - 1, f32);
+            const f32 exit_dist_x = side_dist_x + radius * delta_dist_x;
+            const f32 exit_dist_y = side_dist_y + radius * delta_dist_y;
+            const i32 is_exit_x = exit_dist_x < exit_dist_y;
+
+            // Grid lines along y at or before an exit along x, and along x strictly before an exit along y
+            // Clamped before the conversion, as the unselected lanes can be far out of the int range
+            const f32 max_steps = radius + 1.0F;
+            f32 n_y = (exit_dist_x - side_dist_y) / delta_dist_y;
+            f32 n_x = (exit_dist_y - side_dist_x) / delta_dist_x;
+            n_y = (n_y < -1.0F) ? (zero - 1.0F) : ((n_y > max_steps) ? max_steps : n_y);
+            n_x = (n_x < -1.0F) ? (zero - 1.0F) : ((n_x > max_steps) ? max_steps : n_x);
+            const i32 trunc_y = __builtin_convertvector(n_y, i32);
+            const i32 trunc_x = __builtin_convertvector(n_x, i32);
+            const i32 steps_y = (n_y < 0) ? i32 {} : trunc_y + 1;
+            const i32 steps_x = (n_x <= 0) ? i32 {} : trunc_x - (__builtin_convertvector(trunc_x, f32) != n_x);
+
+            i32 num_steps_x = is_exit_x ? distance : ((steps_x < distance - 1) ? steps_x : distance - 1);
+            i32 num_steps_y = is_exit_x ? ((steps_y < distance - 1) ? steps_y : distance - 1) : distance;
+            num_steps_x &= is_skip;
+            num_steps_y &= is_skip;
+
+            map_x += num_steps_x * step_x;
+            map_y += num_steps_y * step_y;
+            side_dist_x += __builtin_convertvector(num_steps_x, f32) * delta_dist_x;
+            side_dist_y += __builtin_convertvector(num_steps_y, f32) * delta_dist_y;
+            is_front_side = is_skip ? ~is_exit_x : is_front_side;
+        }
+
+        // Step every other active lane along x or y, whichever side is closer
+        const i32 is_step = is_active & ~is_skip;
+        const i32 is_step_x = (side_dist_x < side_dist_y) & is_step;
+        const i32 is_step_y = ~(side_dist_x < side_dist_y) & is_step;
+
+        side_dist_x = is_step_x ? side_dist_x + delta_dist_x : side_dist_x;
+        side_dist_y = is_step_y ? side_dist_y + delta_dist_y : side_dist_y;
+        map_x += step_x & is_step_x;
+        map_y += step_y & is_step_y;
+        is_front_side = (is_front_side & ~is_step) | is_step_y;
+    }
+
+    const f32 hit_dist = is_front_side ? (side_dist_y - delta_dist_y) : (side_dist_x - delta_dist_x);
+    for (auto i = 0; i < num_lanes; i++)
+    {
+        hits[i].dist = std::max(hit_dist[i], 0.1F);
+        hits[i].cell = cell[i];
+        hits[i].is_front_side = is_front_side[i] != 0;
+        hits[i].map_x = map_x[i];
+        hits[i].map_y = map_y[i];
+    }
+    return num_steps;
+}
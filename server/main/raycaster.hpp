@@ -1,60 +1,140 @@
 #pragma once
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 
 #include "types.hpp"
+#include "fixed.hpp"
+#include "frame_shape.hpp"
+#include "map.hpp"
+#include "platform.hpp"
+#include "ray_packet.hpp"
 #include "common/codec.hpp"
+#include "common/protocol.hpp"
 #include "textures/textures.hpp"
 
-template <int size_ = 64, int stride_ = size_>
+// Set-associative cache of texture rows in RAM, as textures are in flash on the ESP32 and stored as palette indices
+// Rows of every texture and mip level are spread over the sets by row number, so the adjacent rows of a wall do not evict each other,
+// and are replaced least recently used first within a set
+// update() selects the row read through data, run_ends and num_runs, prefetch() starts loading the row of the next column
+template <int size_ = 64, int stride_ = size_,
+    int num_sets_ = config::server::tex_cache_num_sets, int num_ways_ = config::server::tex_cache_num_ways>
 struct texture_cache_t
 {
-    static constexpr auto size   = size_;
-    static constexpr auto stride = stride_;
+    static constexpr auto size     = size_;
+    static constexpr auto stride   = stride_;
+    static constexpr auto num_sets = num_sets_;
+    static constexpr auto num_ways = num_ways_;
 
-    int tex_id {-1};
-    int row_id {-1};
-    uint8_t data[size] = {0};
+    static_assert((num_sets & (num_sets - 1)) == 0, "Sets are selected by the low bits of the row");
 
-    auto update(int tex_id_, int row_id_) -> void
+    struct entry_t
     {
-        if (tex_id_ != tex_id || row_id_ != row_id)
+        int key {-1};
+        uint32_t last_use {0};
+        const uint8_t* run_ends {nullptr};
+        int num_runs {0};
+        uint8_t data[size] = {0};
+    };
+
+    entry_t entries[num_sets][num_ways];
+    uint32_t num_uses {0};
+
+    // Selected row
+    int key {-1};
+    const uint8_t* data {nullptr};
+
+    // Runs of equal texels in the selected row of level 0, see generate_texture.py
+    const uint8_t* run_ends {nullptr};
+    int num_runs {0};
+
+    // Lookups since the last reset_stats(), for render_stats_t
+    uint32_t num_hits {0};
+    uint32_t num_misses {0};
+
+    // Mip rows are shorter and indexed in level 0 texels, so row_id >> mip_level
+    static constexpr auto get_key(int tex_id, int row_id, int mip_level) -> int
+    {
+        return ((tex_id * (num_texture_mip_levels + 1) + mip_level) * texture_width) + (row_id >> mip_level);
+    }
+
+    // First texel of a row in the packed texels of its texture
+    static auto get_row_offset(int row_id, int mip_level) -> int
+    {
+        if (mip_level == 0) return row_id * stride;
+        return get_texture_mip_offset(mip_level) + (row_id >> mip_level) * (size >> mip_level);
+    }
+
+    auto find(int key_) -> entry_t*
+    {
+        for (auto& entry : entries[key_ & (num_sets - 1)])
         {
-            std::memcpy(data, texture_map[tex_id_] + row_id_ * stride, size);
-            tex_id = tex_id_;
-            row_id = row_id_;
+            if (entry.key == key_) return &entry;
         }
+        return nullptr;
     }
-};
 
-constexpr auto map_size_x = 24;
-constexpr auto map_size_y = 24;
-
-constexpr uint8_t world_map[map_size_x][map_size_y] = {
-    {8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 4, 4, 6, 4, 4, 6, 4, 6, 4, 4, 4, 6, 4},
-    {8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4},
-    {8, 0, 3, 3, 0, 0, 0, 0, 0, 8, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6},
-    {8, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6},
-    {8, 0, 3, 3, 0, 0, 0, 0, 0, 8, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4},
-    {8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 4, 0, 0, 0, 0, 0, 6, 6, 6, 0, 6, 4, 6},
-    {8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 4, 4, 4, 4, 4, 4, 6, 0, 0, 0, 0, 0, 6},
-    {7, 7, 7, 7, 0, 7, 7, 7, 7, 0, 8, 0, 8, 0, 8, 0, 8, 4, 0, 4, 0, 6, 0, 6},
-    {7, 7, 0, 0, 0, 0, 0, 0, 7, 8, 0, 8, 0, 8, 0, 8, 8, 6, 0, 0, 0, 0, 0, 6},
-    {7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 6, 0, 0, 0, 0, 0, 4},
-    {7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 6, 0, 6, 0, 6, 0, 6},
-    {7, 7, 0, 0, 0, 0, 0, 0, 7, 8, 0, 8, 0, 8, 0, 8, 8, 6, 4, 6, 0, 6, 6, 6},
-    {7, 7, 7, 7, 0, 7, 7, 7, 7, 8, 8, 4, 0, 6, 8, 4, 8, 3, 3, 3, 0, 3, 3, 3},
-    {2, 2, 2, 2, 0, 2, 2, 2, 2, 4, 6, 4, 0, 0, 6, 0, 6, 3, 0, 0, 0, 0, 0, 3},
-    {2, 2, 0, 0, 0, 0, 0, 2, 2, 4, 0, 0, 0, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0, 3},
-    {2, 0, 0, 0, 0, 0, 0, 0, 2, 4, 0, 0, 0, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0, 3},
-    {1, 0, 0, 0, 0, 0, 0, 0, 1, 4, 4, 4, 4, 4, 6, 0, 6, 3, 3, 0, 0, 0, 3, 3},
-    {2, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 1, 2, 2, 2, 6, 6, 0, 0, 5, 0, 5, 0, 5},
-    {2, 2, 0, 0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 2, 2, 0, 5, 0, 5, 0, 0, 0, 5, 5},
-    {2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 5, 0, 5, 0, 5, 0, 5, 0, 5},
-    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5},
-    {2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 5, 0, 5, 0, 5, 0, 5, 0, 5},
-    {2, 2, 0, 0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 2, 2, 0, 5, 0, 5, 0, 0, 0, 5, 5},
-    {2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 5, 5, 5, 5, 5, 5, 5, 5, 5},
+    auto reset_stats() -> void
+    {
+        num_hits   = 0;
+        num_misses = 0;
+    }
+
+    auto update(int tex_id_, int row_id_, int mip_level_ = 0) -> void
+    {
+        const auto key_ = get_key(tex_id_, row_id_, mip_level_);
+        if (key_ == key)
+        {
+            num_hits++;
+            return;
+        }
+
+        auto* entry = find(key_);
+        if (entry)
+        {
+            num_hits++;
+        }
+        else
+        {
+            num_misses++;
+            auto& set = entries[key_ & (num_sets - 1)];
+            entry = std::min_element(set, set + num_ways, [](const auto& a, const auto& b) { return a.last_use < b.last_use; });
+
+            unpack_texels(tex_id_, get_row_offset(row_id_, mip_level_), size >> mip_level_, entry->data);
+            if (mip_level_ == 0)
+            {
+                const auto run_offsets = texture_run_offsets_map[tex_id_];
+                entry->run_ends = texture_run_ends_map[tex_id_] + run_offsets[row_id_];
+                entry->num_runs = run_offsets[row_id_ + 1] - run_offsets[row_id_];
+            }
+            else
+            {
+                entry->run_ends = nullptr;
+                entry->num_runs = 0;
+            }
+            entry->key = key_;
+        }
+        entry->last_use = ++num_uses;
+
+        key = key_;
+        data = entry->data;
+        run_ends = entry->run_ends;
+        num_runs = entry->num_runs;
+    }
+
+    // Start loading a row that a later update() is going to select, unless it is cached
+    // A no-op apart from the lookup on the ESP32, as __builtin_prefetch emits nothing on Xtensa (see use_tex_prefetch)
+    auto prefetch(int tex_id_, int row_id_, int mip_level_) -> void
+    {
+        const auto key_ = get_key(tex_id_, row_id_, mip_level_);
+        if (key_ == key || find(key_)) return;
+
+        // Packed rows are at most size bytes
+        const auto bit = get_row_offset(row_id_, mip_level_) * texture_index_bits_map[tex_id_];
+        const auto row = texture_texels_map[tex_id_] + (bit >> 3);
+        for (auto i = 0; i < size; i += 32) __builtin_prefetch(row + i);
+    }
 };
 
 [[maybe_unused]]
@@ -73,318 +153,1032 @@ inline constexpr auto gray_to_rgb233(uint8_t x)
     return (msb2 << 6) | (msb3 << 3) | msb3;
 }
 
-//float zbuffer[320]; // TODO: Paramterize
-float view_distances[240]; // TODO: Paramterize
+constexpr auto max_frame_width  = frame_shapes_t::max_width;
+constexpr auto max_frame_height = frame_shapes_t::max_height;
 
-auto init_renderer(int frame_buffer_width, int frame_buffer_height) -> void
+float zbuffer[max_frame_width];
+
+render_options_t render_options;
+
+// Accumulated by render_encode_slice(), reset by the caller at the start of a frame
+protocol::render_stats_t render_stats;
+
+// Render ticks of every column of the last frame, for slice_layout_t
+uint32_t column_costs[max_frame_width];
+
+auto init_renderer(int frame_buffer_width) -> void
 {
-    for (auto i = 0; i < frame_buffer_height; i++)
-	{
-		view_distances[i] = frame_buffer_height / (2.0F * i - frame_buffer_height);
-	}
-    //for (auto i = 0; i < frame_buffer_width; i++) zbuffer[i] = 1e9F;
+    if (!world_map.cells) world_map.load_default();
+
+    for (auto i = 0; i < frame_buffer_width; i++) zbuffer[i] = 1e9F;
 }
 
-auto render_encode_slice(
-    const render_command_t& cmd,
-    int slice_start,
-    int slice_stop,
-    encoded_slice_t& frame) -> void
+inline auto ceil_to_int(float x) -> int { return static_cast<int>(std::ceil(x)); }
+
+// Jump a ray across the empty square of cells within distance - 1 of its cell (see map_t::distances)
+// Leaves the DDA state in the first cell past the square, the cell that stepping one by one would reach
+// Grid lines crossed at the same distance are stepped along y first, like the DDA
+inline auto skip_empty_cells(
+    int distance,
+    float delta_dist_x,
+    float delta_dist_y,
+    float abs_dir_x,
+    float abs_dir_y,
+    int step_x,
+    int step_y,
+    int& map_x,
+    int& map_y,
+    float& side_dist_x,
+    float& side_dist_y,
+    bool& is_front_side) -> void
 {
-    texture_cache_t<texture_height> tex_cache;
+    const auto radius = static_cast<float>(distance - 1);
 
-	auto dst_ptr = frame.buffer;
+    // Distance along the ray to the last grid line of the square on either axis
+    const auto exit_dist_x = side_dist_x + radius * delta_dist_x;
+    const auto exit_dist_y = side_dist_y + radius * delta_dist_y;
 
-    const auto x_scale = cmd.tile.x_scale / frame.width;
-    for (auto x = slice_start, i = 0; x < slice_stop; x++, i++)
+    auto num_steps_x = distance;
+    auto num_steps_y = distance;
+    if (exit_dist_x < exit_dist_y)
     {
-        //const float cam_x = static_cast<float>(2 * x) / frame.width - 1.0F;
-        const float cam_x = x * x_scale + cmd.tile.x_offset;
-        const float ray_dir_x = cmd.pose.dir_x + cmd.pose.plane_x * cam_x;
-        const float ray_dir_y = cmd.pose.dir_y + cmd.pose.plane_y * cam_x;
+        // Grid lines along y at or before the exit, 1 / delta_dist_y apart
+        const auto n = (exit_dist_x - side_dist_y) * abs_dir_y;
+        num_steps_y = (exit_dist_x < side_dist_y) ? 0 : std::min(static_cast<int>(n) + 1, distance - 1);
+        is_front_side = false;
+    }
+    else
+    {
+        // Grid lines along x strictly before the exit
+        const auto n = (exit_dist_y - side_dist_x) * abs_dir_x;
+        num_steps_x = (exit_dist_y <= side_dist_x) ? 0 : std::min(ceil_to_int(n), distance - 1);
+        is_front_side = true;
+    }
 
-        auto map_x = static_cast<int>(cmd.pose.pos_x);
-        auto map_y = static_cast<int>(cmd.pose.pos_y);
+    map_x += num_steps_x * step_x;
+    map_y += num_steps_y * step_y;
+    side_dist_x += num_steps_x * delta_dist_x;
+    side_dist_y += num_steps_y * delta_dist_y;
+}
+
+// Same as skip_empty_cells() in fixed point
+// Exit distances use 64 bits as radius * delta_dist overflows Q16.16 for rays almost parallel to an axis
+inline auto skip_empty_cells(
+    int distance,
+    fp32_t delta_dist_x,
+    fp32_t delta_dist_y,
+    int step_x,
+    int step_y,
+    int& map_x,
+    int& map_y,
+    fp32_t& side_dist_x,
+    fp32_t& side_dist_y,
+    bool& is_front_side) -> void
+{
+    const auto radius = static_cast<int64_t>(distance - 1);
 
-        const auto delta_dist_x = (ray_dir_x == 0) ? 1e30F : std::abs(1.0F / ray_dir_x);
-        const auto delta_dist_y = (ray_dir_y == 0) ? 1e30F : std::abs(1.0F / ray_dir_y);
+    const auto exit_dist_x = side_dist_x.value + radius * delta_dist_x.value;
+    const auto exit_dist_y = side_dist_y.value + radius * delta_dist_y.value;
+
+    auto num_steps_x = distance;
+    auto num_steps_y = distance;
+    if (exit_dist_x < exit_dist_y)
+    {
+        const auto n = exit_dist_x - side_dist_y.value;
+        num_steps_y = (n < 0) ? 0 : static_cast<int>(std::min<int64_t>(n / delta_dist_y.value + 1, distance - 1));
+        is_front_side = false;
+    }
+    else
+    {
+        const auto n = exit_dist_y - side_dist_x.value;
+        num_steps_x = (n <= 0) ? 0 : static_cast<int>(std::min<int64_t>((n + delta_dist_x.value - 1) / delta_dist_x.value, distance - 1));
+        is_front_side = true;
+    }
 
-        auto step_x = 0;
-        auto step_y = 0;
+    map_x += num_steps_x * step_x;
+    map_y += num_steps_y * step_y;
+    side_dist_x = fp32_t::from_raw(static_cast<int32_t>(side_dist_x.value + int64_t {num_steps_x} * delta_dist_x.value));
+    side_dist_y = fp32_t::from_raw(static_cast<int32_t>(side_dist_y.value + int64_t {num_steps_y} * delta_dist_y.value));
+}
 
-        auto side_dist_x = 0.0F;
-        auto side_dist_y = 0.0F;
+// Walk the map grid along a single ray until it hits a wall (DDA)
+auto cast_ray(const pose_t& pose, float ray_dir_x, float ray_dir_y) -> ray_hit_t
+{
+    auto map_x = static_cast<int>(pose.pos_x);
+    auto map_y = static_cast<int>(pose.pos_y);
 
-        if (ray_dir_x < 0)
+    const auto delta_dist_x = (ray_dir_x == 0) ? 1e30F : std::abs(1.0F / ray_dir_x);
+    const auto delta_dist_y = (ray_dir_y == 0) ? 1e30F : std::abs(1.0F / ray_dir_y);
+
+    auto step_x = 0;
+    auto step_y = 0;
+
+    auto side_dist_x = 0.0F;
+    auto side_dist_y = 0.0F;
+
+    if (ray_dir_x < 0)
+    {
+        step_x = -1;
+        side_dist_x = (pose.pos_x - map_x) * delta_dist_x;
+    }
+    else
+    {
+        step_x = 1;
+        side_dist_x = (map_x + 1.0F - pose.pos_x) * delta_dist_x;
+    }
+    if (ray_dir_y < 0)
+    {
+        step_y = -1;
+        side_dist_y = (pose.pos_y - map_y) * delta_dist_y;
+    }
+    else
+    {
+        step_y = 1;
+        side_dist_y = (map_y + 1.0F - pose.pos_y) * delta_dist_y;
+    }
+
+    const auto use_distance_field = render_options.use_distance_field;
+
+    auto is_front_side = true;
+    auto hit = 0;
+    auto num_steps = 0;
+    while (world_map.is_inside(map_x, map_y))
+    {
+        const auto cell_id = world_map.get_index(map_x, map_y);
+        hit = world_map.cells[cell_id];
+        if (hit > 0) break;
+        num_steps++;
+
+        const auto distance = use_distance_field ? world_map.distances[cell_id] : 1;
+        if (distance > 1)
         {
-            step_x = -1;
-            side_dist_x = (cmd.pose.pos_x - map_x) * delta_dist_x;
+            skip_empty_cells(
+                distance, delta_dist_x, delta_dist_y, std::abs(ray_dir_x), std::abs(ray_dir_y), step_x, step_y,
+                map_x, map_y, side_dist_x, side_dist_y, is_front_side);
+        }
+        else if (side_dist_x < side_dist_y)
+        {
+            side_dist_x += delta_dist_x;
+            map_x += step_x;
+            is_front_side = false;
         }
         else
         {
-            step_x = 1;
-            side_dist_x = (map_x + 1.0F - cmd.pose.pos_x) * delta_dist_x;
+            side_dist_y += delta_dist_y;
+            map_y += step_y;
+            is_front_side = true;
+        }
+    }
+
+    render_stats.num_dda_steps += num_steps;
+
+    const auto hit_dist = std::max(is_front_side ? (side_dist_y - delta_dist_y) : (side_dist_x - delta_dist_x), 0.1F);
+    return {hit_dist, hit, is_front_side, map_x, map_y};
+}
+
+// Trace num_rays adjacent rays, as packets where the target supports it
+auto cast_rays(
+    const pose_t& pose,
+    const float* ray_dirs_x,
+    const float* ray_dirs_y,
+    ray_hit_t* hits,
+    int num_rays) -> void
+{
+    switch (num_rays)
+    {
+        case 8: render_stats.num_dda_steps += cast_ray_packet<8>(pose, ray_dirs_x, ray_dirs_y, render_options.use_distance_field, hits); break;
+        case 4: render_stats.num_dda_steps += cast_ray_packet<4>(pose, ray_dirs_x, ray_dirs_y, render_options.use_distance_field, hits); break;
+        default:
+            for (auto i = 0; i < num_rays; i++) hits[i] = cast_ray(pose, ray_dirs_x[i], ray_dirs_y[i]);
+            break;
+    }
+}
+
+// Distance between the traced columns of a slice before bisection (power of two)
+constexpr auto wall_coherence_stride = 8;
+
+// Whether all rays between two rays reach the same face of the same cell
+// Nothing between them can occlude that face, as the wedge between the rays is narrower than a cell
+inline auto is_same_wall_face(const ray_hit_t& a, const ray_hit_t& b) -> bool
+{
+    return a.cell > 0 && b.cell > 0 && a.map_x == b.map_x && a.map_y == b.map_y && a.is_front_side == b.is_front_side;
+}
+
+// Hit of a ray on the wall face hit by a neighbouring ray, by intersecting the ray with the line of the face
+inline auto intersect_wall_face(const pose_t& pose, float ray_dir_x, float ray_dir_y, const ray_hit_t& face) -> ray_hit_t
+{
+    const auto dist = face.is_front_side ?
+        (face.map_y + (ray_dir_y < 0 ? 1.0F : 0.0F) - pose.pos_y) / ray_dir_y :
+        (face.map_x + (ray_dir_x < 0 ? 1.0F : 0.0F) - pose.pos_x) / ray_dir_x;
+
+    auto hit = face;
+    hit.dist = std::max(dist, 0.1F);
+    return hit;
+}
+
+// Trace num_rays adjacent rays using the coherence of walls across columns
+// Every wall_coherence_stride-th ray and the last ray are traced, then the gaps between traced rays are bisected:
+// a gap whose ends hit the same wall face is filled by intersect_wall_face(), any other gap traces its middle ray
+// The rays traced at each level of the bisection are batched into packets of up to ray_packet_size rays
+auto cast_rays_coherent(
+    const pose_t& pose,
+    const float* ray_dirs_x,
+    const float* ray_dirs_y,
+    ray_hit_t* hits,
+    int num_rays,
+    int ray_packet_size) -> void
+{
+    constexpr auto max_ray_packet_size = 8;
+    ray_packet_size = std::clamp(ray_packet_size, 1, max_ray_packet_size);
+
+    float batch_dirs_x[max_ray_packet_size];
+    float batch_dirs_y[max_ray_packet_size];
+    ray_hit_t batch_hits[max_ray_packet_size];
+    int batch_ids[max_ray_packet_size];
+    auto batch_size = 0;
+
+    const auto trace_batch = [&]()
+    {
+        if (batch_size == 0) return;
+        cast_rays(pose, batch_dirs_x, batch_dirs_y, batch_hits, batch_size);
+        for (auto i = 0; i < batch_size; i++) hits[batch_ids[i]] = batch_hits[i];
+        render_stats.num_traced_columns += batch_size;
+        batch_size = 0;
+    };
+    const auto trace = [&](int id)
+    {
+        batch_ids[batch_size] = id;
+        batch_dirs_x[batch_size] = ray_dirs_x[id];
+        batch_dirs_y[batch_size] = ray_dirs_y[id];
+        if (++batch_size == ray_packet_size) trace_batch();
+    };
+
+    const auto last = num_rays - 1;
+    if (last < 0) return;
+
+    for (auto i = 0; i < last; i += wall_coherence_stride) trace(i);
+    trace(last);
+    trace_batch();
+
+    // Rays at odd multiples of step, between rays resolved by the previous levels
+    for (auto step = wall_coherence_stride / 2; step > 0; step /= 2)
+    {
+        for (auto i = step; i < last; i += 2 * step)
+        {
+            const auto& left  = hits[i - step];
+            const auto& right = hits[std::min(i + step, last)];
+            if (is_same_wall_face(left, right))
+            {
+                hits[i] = intersect_wall_face(pose, ray_dirs_x[i], ray_dirs_y[i], left);
+                render_stats.num_interpolated_columns++;
+            }
+            else
+            {
+                trace(i);
+            }
         }
-        if (ray_dir_y < 0)
+        trace_batch();
+    }
+}
+
+// Side distances run at most one delta_dist past the point where a ray leaves the map.
+// The view direction is a unit vector and the camera plane is perpendicular to it, so rays
+// are at least unit long and leave any map within (max_size + 1) * sqrt(2) of the camera.
+constexpr auto max_delta_dist = fp32_t {8192};
+static_assert(1.4143F * (map_t::max_size + 1) + max_delta_dist.to_float() < fp32_max.to_float(),
+	"Side distances of cast_ray_fixed() overflow Q16.16 on the largest maps");
+
+// Walk the map grid along a single ray until it hits a wall (DDA), in fixed point
+// Mirrors cast_ray() with reciprocals from recip() instead of divides
+auto cast_ray_fixed(fp32_t pos_x, fp32_t pos_y, fp32_t ray_dir_x, fp32_t ray_dir_y, fp32_t& hit_dist) -> ray_hit_t
+{
+    auto map_x = static_cast<int>(pos_x);
+    auto map_y = static_cast<int>(pos_y);
+
+    const auto delta_dist_x = (ray_dir_x == fp32_t {}) ? max_delta_dist : std::min(recip(abs(ray_dir_x)), max_delta_dist);
+    const auto delta_dist_y = (ray_dir_y == fp32_t {}) ? max_delta_dist : std::min(recip(abs(ray_dir_y)), max_delta_dist);
+
+    auto step_x = 0;
+    auto step_y = 0;
+
+    auto side_dist_x = fp32_t {};
+    auto side_dist_y = fp32_t {};
+
+    if (ray_dir_x < fp32_t {})
+    {
+        step_x = -1;
+        side_dist_x = (pos_x - fp32_t {map_x}) * delta_dist_x;
+    }
+    else
+    {
+        step_x = 1;
+        side_dist_x = (fp32_t {map_x + 1} - pos_x) * delta_dist_x;
+    }
+    if (ray_dir_y < fp32_t {})
+    {
+        step_y = -1;
+        side_dist_y = (pos_y - fp32_t {map_y}) * delta_dist_y;
+    }
+    else
+    {
+        step_y = 1;
+        side_dist_y = (fp32_t {map_y + 1} - pos_y) * delta_dist_y;
+    }
+
+    const auto use_distance_field = render_options.use_distance_field;
+
+    auto is_front_side = true;
+    auto hit = 0;
+    auto num_steps = 0;
+    while (world_map.is_inside(map_x, map_y))
+    {
+        const auto cell_id = world_map.get_index(map_x, map_y);
+        hit = world_map.cells[cell_id];
+        if (hit > 0) break;
+        num_steps++;
+
+        const auto distance = use_distance_field ? world_map.distances[cell_id] : 1;
+        if (distance > 1)
         {
-            step_y = -1;
-            side_dist_y = (cmd.pose.pos_y - map_y) * delta_dist_y;
+            skip_empty_cells(
+                distance, delta_dist_x, delta_dist_y, step_x, step_y,
+                map_x, map_y, side_dist_x, side_dist_y, is_front_side);
+        }
+        else if (side_dist_x < side_dist_y)
+        {
+            side_dist_x += delta_dist_x;
+            map_x += step_x;
+            is_front_side = false;
         }
         else
         {
-            step_y = 1;
-            side_dist_y = (map_y + 1.0F - cmd.pose.pos_y) * delta_dist_y;
+            side_dist_y += delta_dist_y;
+            map_y += step_y;
+            is_front_side = true;
         }
+    }
+
+    render_stats.num_dda_steps += num_steps;
+
+    hit_dist = std::max(is_front_side ? (side_dist_y - delta_dist_y) : (side_dist_x - delta_dist_x), fp32_t {0.1F});
+    return {hit_dist.to_float(), hit, is_front_side, map_x, map_y};
+}
+
+// Minified walls sample the finest mip level with no more texels than the wall has pixels
+auto select_mip_level(int wall_len) -> int
+{
+    auto mip_level = 0;
+    if (render_options.use_mipmaps)
+    {
+        while (mip_level < num_texture_mip_levels && (texture_height >> mip_level) > wall_len) mip_level++;
+    }
+    return mip_level;
+}
 
-        auto is_front_side = true;
-        auto hit = 0;
-        while (
-			(0 <= map_x) && (map_x < map_size_x) &&
-			(0 <= map_y) && (map_y < map_size_y))
+// Row-coherent floor and ceiling casting
+// Every row below (above) the horizon sees the floor (ceiling) at the constant distance |shape_t::view_distances[row]|,
+// so its world position advances by a constant step from one column to the next.
+// The rows are set up once per slice and then stepped incrementally in Q16.16 as the columns are rasterized.
+struct floor_caster_t
+{
+    static constexpr auto max_height = max_frame_height;
+
+    int height {0};
+    int row_start {0};
+    bool has_ceiling {false};
+
+    // World position of every row at the current column and its step to the next column
+    int32_t pos_x[max_height];
+    int32_t pos_y[max_height];
+    int32_t step_x[max_height];
+    int32_t step_y[max_height];
+
+    // Texture and first texel of the mip level sampled by every row, with the texel shift of the level
+    uint8_t tex_ids[max_height];
+    uint16_t tex_offsets[max_height];
+    uint8_t tex_shift[max_height];
+    uint8_t tex_bits[max_height];
+
+    uint32_t num_ticks {0};
+    uint32_t num_pixels {0};
+
+    template <typename shape_t>
+    auto setup(const render_command_t& cmd, float x_scale, int slice_start, bool has_ceiling_) -> void
+    {
+        const auto t0 = get_ticks();
+
+        constexpr auto& view_distances = shape_t::view_distances;
+        height = shape_t::height;
+        has_ceiling = has_ceiling_;
+        row_start = has_ceiling ? 0 : height / 2;
+
+        const auto cam_x = slice_start * x_scale + cmd.tile.x_offset;
+        const auto ray_dir_x = cmd.pose.dir_x + cmd.pose.plane_x * cam_x;
+        const auto ray_dir_y = cmd.pose.dir_y + cmd.pose.plane_y * cam_x;
+        const auto ray_step_x = cmd.pose.plane_x * x_scale;
+        const auto ray_step_y = cmd.pose.plane_y * x_scale;
+        const auto ray_dir_len = std::max(std::abs(ray_dir_x), std::abs(ray_dir_y));
+
+        for (auto j = row_start; j < height; j++)
         {
-            hit = world_map[map_x][map_y];
-            if (hit > 0) break;
+            const auto tex_id = (2 * j < height) ? config::server::ceiling_texture_id : config::server::floor_texture_id;
 
-            if (side_dist_x < side_dist_y)
+            // The horizon row is always covered by a wall
+            const auto row_dist = (2 * j == height) ? 0.0F : std::abs(view_distances[j]);
+
+            pos_x[j]  = fp32_t {cmd.pose.pos_x + row_dist * ray_dir_x}.value;
+            pos_y[j]  = fp32_t {cmd.pose.pos_y + row_dist * ray_dir_y}.value;
+            step_x[j] = fp32_t {row_dist * ray_step_x}.value;
+            step_y[j] = fp32_t {row_dist * ray_step_y}.value;
+
+            // Finest mip level with no more texels than pixels, along the row and to the next row
+            const auto next_row_dist = (2 * (j + 1) == height) ? 0.0F : std::abs(view_distances[std::min(j + 1, height - 1)]);
+            const auto texels_per_pixel = texture_width * std::max(
+                row_dist * std::max(std::abs(ray_step_x), std::abs(ray_step_y)),
+                std::abs(next_row_dist - row_dist) * ray_dir_len);
+            auto mip_level = 0;
+            if (render_options.use_mipmaps)
             {
-                side_dist_x += delta_dist_x;
-                map_x += step_x;
-                is_front_side = false;
+                while (mip_level < num_texture_mip_levels && static_cast<float>(1 << mip_level) < texels_per_pixel) mip_level++;
             }
-            else
+
+            tex_ids[j]     = tex_id;
+            tex_offsets[j] = get_texture_mip_offset(mip_level);
+            tex_shift[j] = fp32_t::frac_bits - 6 + mip_level; // * texture_width >> mip_level
+            tex_bits[j]  = 6 - mip_level;
+        }
+
+        num_ticks += get_ticks() - t0;
+    }
+
+    // Textures are stored column by column, so texel (u, v) is at u * size + v
+    template <typename encoder_t>
+    auto encode_span(int row_start_, int row_stop, encoder_t& encoder) -> void
+    {
+        for (auto j = row_start_; j < row_stop; j++)
+        {
+            const auto mask = (1 << tex_bits[j]) - 1;
+            const auto u = (pos_x[j] >> tex_shift[j]) & mask;
+            const auto v = (pos_y[j] >> tex_shift[j]) & mask;
+            encoder.put(get_texel(tex_ids[j], tex_offsets[j] + ((u << tex_bits[j]) | v)));
+        }
+        num_pixels += std::max(row_stop - row_start_, 0);
+    }
+
+    template <typename encoder_t>
+    auto encode_ceiling(int wall_start, encoder_t& encoder) -> void
+    {
+        const auto t0 = get_ticks();
+        encode_span(0, wall_start, encoder);
+        num_ticks += get_ticks() - t0;
+    }
+
+    // Also steps every row to the next column, as the floor span ends the column
+    template <typename encoder_t>
+    auto encode_floor(int wall_end, encoder_t& encoder) -> void
+    {
+        const auto t0 = get_ticks();
+        encode_span(wall_end, height, encoder);
+        for (auto j = row_start; j < height; j++)
+        {
+            pos_x[j] += step_x[j];
+            pos_y[j] += step_y[j];
+        }
+        num_ticks += get_ticks() - t0;
+    }
+};
+
+floor_caster_t floor_caster;
+
+// Sprites projected into the current slice
+// Sprites outside of [slice_start, slice_stop) or behind the camera are culled once per slice
+// and the nearest max_sprites are kept, sorted by depth, to bound the cost of crowded views
+struct sprite_caster_t
+{
+    static constexpr auto max_sprites = 16;
+
+    struct projected_sprite_t
+    {
+        float depth {0};
+        int tex_id {0};
+
+        // Clipped to the slice and to the frame
+        int x_start {0};
+        int x_stop {0};
+        int row_start {0};
+        int row_stop {0};
+
+        // Unclipped screen position of the top left corner and texels per pixel
+        float left {0};
+        float top {0};
+        float tex_u_step {0};
+        float tex_v_step {0};
+    };
+
+    // Nearest first
+    projected_sprite_t sprites[max_sprites];
+    int num_sprites {0};
+
+    auto setup(const render_command_t& cmd, float x_scale, int slice_start, int slice_stop, int height) -> void
+    {
+        constexpr auto min_depth = 0.1F;
+
+        const auto& pose = cmd.pose;
+        const auto inv_det = 1.0F / (pose.plane_x * pose.dir_y - pose.dir_x * pose.plane_y);
+        const auto plane_len = std::sqrt(pose.plane_x * pose.plane_x + pose.plane_y * pose.plane_y);
+
+        num_sprites = 0;
+        for (auto sprite_id = 0; sprite_id < world_map.num_sprites; sprite_id++)
+        {
+            const auto& sprite = world_map.sprites[sprite_id];
+            // Sprite position in camera space, along the camera plane and along the view direction
+            const auto rel_x = sprite.pos_x - pose.pos_x;
+            const auto rel_y = sprite.pos_y - pose.pos_y;
+            const auto tfm_x = inv_det * (pose.dir_y * rel_x - pose.dir_x * rel_y);
+            const auto depth = inv_det * (pose.plane_x * rel_y - pose.plane_y * rel_x);
+            if (depth < min_depth) continue;
+
+            // Same projection as the rays, cam_x = x * x_scale + x_offset
+            const auto width = sprite.size / (plane_len * depth * x_scale);
+            const auto left = (tfm_x / depth - cmd.tile.x_offset) / x_scale - width / 2;
+            const auto x_start = std::max(ceil_to_int(left), slice_start);
+            const auto x_stop  = std::min(ceil_to_int(left + width), slice_stop);
+            if (x_start >= x_stop) continue;
+
+            // Standing on the floor, which is at height / 2 * (1 + 1 / depth)
+            const auto sprite_height = sprite.size * height / depth;
+            const auto bottom = height * 0.5F * (1.0F + 1.0F / depth);
+            const auto top = bottom - sprite_height;
+            const auto row_start = std::max(ceil_to_int(top), 0);
+            const auto row_stop  = std::min(ceil_to_int(bottom), height);
+            if (row_start >= row_stop) continue;
+
+            // Insert sorted by depth, dropping the farthest sprite when full
+            auto i = std::min(num_sprites, max_sprites - 1);
+            if (i == max_sprites - 1 && num_sprites == max_sprites && sprites[i].depth <= depth) continue;
+            for (; i > 0 && sprites[i - 1].depth > depth; i--) sprites[i] = sprites[i - 1];
+            sprites[i] = {
+                depth, sprite.tex_id, x_start, x_stop, row_start, row_stop,
+                left, top, texture_width / width, texture_height / sprite_height};
+            num_sprites = std::min(num_sprites + 1, max_sprites);
+        }
+    }
+
+    // Whether any sprite is in front of the wall of column x
+    auto is_visible(int x) const -> bool
+    {
+        for (auto i = 0; i < num_sprites; i++)
+        {
+            const auto& sprite = sprites[i];
+            if (sprite.x_start <= x && x < sprite.x_stop && sprite.depth < zbuffer[x]) return true;
+        }
+        return false;
+    }
+
+    // Paint the sprites in front of the wall of column x over its pixels, farthest first
+    // Texels equal to transparent_rgb233 are skipped
+    auto draw(int x, uint8_t* column) const -> void
+    {
+        constexpr auto transparent_rgb233 = 0;
+
+        for (auto i = num_sprites - 1; i >= 0; i--)
+        {
+            const auto& sprite = sprites[i];
+            if (x < sprite.x_start || x >= sprite.x_stop || sprite.depth >= zbuffer[x]) continue;
+
+            const auto tex_x = std::min(static_cast<int>((x - sprite.left) * sprite.tex_u_step), texture_width - 1);
+            uint8_t texels[texture_height];
+            unpack_texels(sprite.tex_id, tex_x * texture_height, texture_height, texels);
+
+            auto tex_v = (sprite.row_start - sprite.top) * sprite.tex_v_step;
+            for (auto j = sprite.row_start; j < sprite.row_stop; j++)
             {
-                side_dist_y += delta_dist_y;
-                map_y += step_y;
-                is_front_side = true;
+                const auto texel = texels[std::min(static_cast<int>(tex_v), texture_height - 1)];
+                tex_v += sprite.tex_v_step;
+                if (texel != transparent_rgb233) column[j] = texel;
             }
         }
+    }
+};
 
-		const auto hit_dist   = std::max(is_front_side ? (side_dist_y - delta_dist_y) : (side_dist_x - delta_dist_x), 0.1F);
-		const auto wall_len   = static_cast<int>(frame.height / hit_dist);
-		const auto wall_start = std::max((frame.height - wall_len) / 2, 0);
-		const auto wall_stop  = std::min((frame.height + wall_len) / 2, frame.height);
+sprite_caster_t sprite_caster;
 
-		auto tex_u = is_front_side ?
-			cmd.pose.pos_x + hit_dist * ray_dir_x :
-			cmd.pose.pos_y + hit_dist * ray_dir_y;
-		tex_u -= int(tex_u);
+// Writes the pixels of a column as is, for columns composited before encoding
+struct column_writer_t
+{
+    uint8_t* dst_ptr {nullptr};
 
-		auto tex_x = int(tex_u * texture_width);
-		if ((!is_front_side && ray_dir_x > 0) && (is_front_side && ray_dir_y < 0)) tex_x = texture_width - 1 - tex_x;
+    auto put(uint8_t value) -> void { *dst_ptr++ = value; }
 
-		const auto tex_id = hit - 1;
-		tex_cache.update(tex_id, tex_x);
+    auto put_run(uint8_t value, int len) -> void
+    {
+        if (len <= 0) return;
+        std::memset(dst_ptr, value, len);
+        dst_ptr += len;
+    }
 
-		const auto tex_v_step = static_cast<float>(texture_height) / wall_len;
-		auto tex_v = (wall_start - (frame.height - wall_len) / 2) * tex_v_step;
+    auto flush() -> void {}
+};
 
-		/*
-		// Vertical floor casting
-		auto floor_x = 0.0F;
-		auto floor_y = 0.0F;
-		if (!is_front_side && ray_dir_x > 0)
-		{
-			floor_x = map_x;
-			floor_y = map_y + tex_u;
-		}
-		else if (!is_front_side && ray_dir_x < 0)
-		{
-			floor_x = map_x + 1.0F;
-			floor_y = map_y + tex_u;
-		}
-		else if (is_front_side && ray_dir_x > 0)
+// Rasterize a column as spans: constant sky and ground runs are emitted directly
+// and only the textured wall span is walked pixel by pixel
+// Texture coordinates are in level 0 texels, as float or fp32_t
+template <int height, typename T, typename encoder_t>
+auto encode_column_spans(
+    int wall_len,
+    int mip_level,
+    T tex_v_step,
+    T pixels_per_texel,
+    const texture_cache_t<texture_height>& tex_cache,
+    floor_caster_t* floor_rows,
+    encoder_t& encoder) -> void
+{
+    constexpr auto sky_color_rgb233 = 0b00010011; // Sky blue
+    constexpr auto gnd_color_rgb233 = 0b00010000; // Leaf green
+    //constexpr auto gnd_color_rgb233 = 0b01001001; // Mud brown
+    //constexpr auto gnd_color_rgb233 = 0b01010010; // Gray
+
+	const auto wall_start = std::max((height - wall_len) / 2, 0);
+	const auto wall_stop  = std::min((height + wall_len) / 2, height);
+
+	auto tex_v = static_cast<T>(wall_start - (height - wall_len) / 2) * tex_v_step;
+
+	// Local copies, as the pointers would be reloaded after every byte the encoder writes
+	const auto* tex_data = tex_cache.data;
+	const auto* run_ends = tex_cache.run_ends;
+	const auto num_runs  = tex_cache.num_runs;
+
+	// Sky or ceiling span
+	if (floor_rows && floor_rows->has_ceiling) floor_rows->encode_ceiling(wall_start, encoder);
+	else encoder.put_run(sky_color_rgb233, wall_start);
+
+	// Wall span (includes the row at wall_stop)
+	const auto wall_end = std::min(wall_stop + 1, height);
+	if (wall_len > texture_height)
+	{
+		// Magnified wall: emit every run of equal texels as one scaled run of pixels
+		const auto num_pixels = wall_end - wall_start;
+
+		// Find the run holding the first texel
+		auto tex_y = std::min(static_cast<int>(tex_v), texture_height - 1);
+		auto run_id = 0;
+		while (run_ends[run_id] <= tex_y) run_id++;
+
+		for (auto k = 0; k < num_pixels; run_id++)
 		{
-			floor_x = map_x + tex_u;
-			floor_y = map_y;
+			// First pixel past the end of the run
+			// The last run also covers the extra row at wall_stop instead of wrapping to the first texel
+			const auto is_last_run = (run_id == num_runs - 1);
+			const auto k_end = is_last_run ? num_pixels :
+				std::min(ceil_to_int((static_cast<T>(run_ends[run_id]) - tex_v) * pixels_per_texel), num_pixels);
+			if (k_end > k)
+			{
+				encoder.put_run(tex_data[tex_y], k_end - k);
+				k = k_end;
+			}
+			tex_y = run_ends[run_id];
 		}
-		else
+	}
+	else
+	{
+		for (auto j = wall_start; j < wall_end; j++)
 		{
-			floor_x = map_x + tex_u;
-			floor_y = map_y + 1.0F;
+			const auto tex_y = static_cast<int>(tex_v) & (texture_height - 1);
+			tex_v += tex_v_step;
+			encoder.put(tex_data[tex_y >> mip_level]);
 		}
-		const auto inv_hit_dist = 1.0F / hit_dist;
-		*/
+	}
 
-		auto run_val = 0;
-		auto run_len = 0;
+	// Ground or floor span
+	if (floor_rows) floor_rows->encode_floor(wall_end, encoder);
+	else encoder.put_run(gnd_color_rgb233, height - wall_end);
 
-        for (auto j = 0; j < frame.height; j++)
-		{
-			auto color = 0;
-			if (j < wall_start)
-			{
-                constexpr auto sky_color_rgb233 = 0b00010011; // Sky blue
-				color = sky_color_rgb233;
-			}
-			else if (j > wall_stop)
-			{
-                constexpr auto gnd_color_rgb233 = 0b00010000; // Leaf green
-                //constexpr auto gnd_color_rgb233 = 0b01001001; // Mud brown
-                //constexpr auto gnd_color_rgb233 = 0b01010010; // Gray
-				color = gnd_color_rgb233;
-
-				/*
-				const auto wt0 = view_distances[j] * inv_hit_dist;
-				const auto wt1 = 1.0F - wt0;
-				const auto fx = wt0 * floor_x + wt1 * cmd.pose.pos_x;
-				const auto fy = wt0 * floor_y + wt1 * cmd.pose.pos_y;
-				const auto fu = static_cast<int>(fx * texture_width ) & 0x3F;
-				const auto fv = static_cast<int>(fy * texture_height) & 0x3F;
-                color = gnd_color_rgb233 * ((fu & 0xF) && (fv & 0xF)); // Checkerboard
-				//color = texture_map[3][fv + fu * texture_width]; // Texture mapping
-				*/
-			}
-			else
-			{
-                const auto tex_y = static_cast<int>(tex_v) & (texture_height - 1);
-                tex_v += tex_v_step;
-                color = tex_cache.data[tex_y];
-				//color = texture_map[hit - 1][tex_y + tex_x * texture_width];
-			}
+	encoder.flush();
+}
 
-			// Run-length encode rendered color
-			if (run_len == 0)
-			{
-				run_val = color;
-				run_len = 1;
-			}
-			else if (color == run_val)
-			{
-				run_len++;
-			}
-			else
-			{
-				*dst_ptr++ = run_val;
-				*dst_ptr++ = run_len;
-				run_val = color;
-				run_len = 1;
-			}
-		} //for(j)
+// Rasterize a column and record its depth
+// Columns with sprites in front of the wall are composited in a pixel buffer and then encoded
+template <typename shape_t, typename T>
+auto encode_column(
+    int x,
+    float hit_dist,
+    int wall_len,
+    int mip_level,
+    T tex_v_step,
+    T pixels_per_texel,
+    const texture_cache_t<texture_height>& tex_cache,
+    floor_caster_t* floor_rows,
+    codec::run_encoder_t& encoder) -> void
+{
+    zbuffer[x] = hit_dist;
 
-		// Add last run
-		*dst_ptr++ = run_val;
-		*dst_ptr++ = run_len;
-	} // for(i)
+    if (!sprite_caster.is_visible(x))
+    {
+        encode_column_spans<shape_t::height>(wall_len, mip_level, tex_v_step, pixels_per_texel, tex_cache, floor_rows, encoder);
+        return;
+    }
 
-	// Terminate stream with special symbol
-	*dst_ptr++ = codec::stream_end_symbol;
-	*dst_ptr++ = codec::stream_end_symbol;
+    uint8_t column[shape_t::height];
+    column_writer_t writer {column};
+    encode_column_spans<shape_t::height>(wall_len, mip_level, tex_v_step, pixels_per_texel, tex_cache, floor_rows, writer);
 
-	frame.size = dst_ptr - frame.buffer;
+    sprite_caster.draw(x, column);
+
+    for (auto j = 0; j < shape_t::height; j++) encoder.put(column[j]);
+    encoder.flush();
 }
 
-#if 0
-        if (hit > 0)
-        {
-            const auto perp_wall_dist = std::max(is_front_side ? (side_dist_y - delta_dist_y) : (side_dist_x - delta_dist_x), 0.1F);
+// Level 0 texel at the fractional part of a position along a wall
+inline auto get_texel_at(float tex_u) -> int { return int((tex_u - int(tex_u)) * texture_width); }
+inline auto get_texel_at(fp32_t tex_u) -> int { return ((tex_u.value & (fp32_t::one - 1)) * texture_width) >> fp32_t::frac_bits; }
 
-            const auto row_id_height = static_cast<int>(frame.height / perp_wall_dist);
+// Texture row of the wall hit by a ray, in level 0 texels, for both the float and the fixed point casters
+// Mirrored on faces seen towards +x or -y, so that textures are not reversed on opposite faces
+template <typename scalar_t>
+inline auto get_texture_column(scalar_t pos_x, scalar_t pos_y, scalar_t ray_dir_x, scalar_t ray_dir_y, scalar_t hit_dist, bool is_front_side) -> int
+{
+	const auto tex_u = is_front_side ?
+		pos_x + hit_dist * ray_dir_x :
+		pos_y + hit_dist * ray_dir_y;
 
-            const auto row_id_start = std::max((frame.height - row_id_height) / 2, 0);
-            const auto row_id_stop  = std::min((frame.height + row_id_height) / 2, frame.height);
+	auto tex_x = get_texel_at(tex_u);
+	if ((!is_front_side && ray_dir_x > scalar_t {}) || (is_front_side && ray_dir_y < scalar_t {})) tex_x = texture_width - 1 - tex_x;
+	return tex_x;
+}
 
-            for (auto j = 0; j <= row_id_start; j++)
-            {
-                constexpr auto base_sky_color_rgb233 = 0b00010011;
-                constexpr auto base_gnd_color_rgb233 = 0b00010000;
-                frame.buffer[j + i * frame.height] = base_sky_color_rgb233;
-                frame.buffer[(frame.height - 1 - j) + i * frame.height] = base_gnd_color_rgb233;
-                //frame.buffer[j + i * frame.height] = floor_colors[j];
-                //frame.buffer[(frame.height - 1 - j) + i * frame.height] = floor_colors[j];
-            }
+inline auto get_texture_column(const pose_t& pose, float ray_dir_x, float ray_dir_y, const ray_hit_t& ray_hit) -> int
+{
+	return get_texture_column(pose.pos_x, pose.pos_y, ray_dir_x, ray_dir_y, ray_hit.dist, ray_hit.is_front_side);
+}
 
-            auto tex_u = is_front_side ?
-                cmd.pose.pos_x + perp_wall_dist * ray_dir_x :
-                cmd.pose.pos_y + perp_wall_dist * ray_dir_y;
-            tex_u -= int(tex_u);
+// Start loading the texture row of a column that is rendered next
+template <typename shape_t>
+auto prefetch_column(
+    const pose_t& pose,
+    float ray_dir_x,
+    float ray_dir_y,
+    const ray_hit_t& ray_hit,
+    texture_cache_t<texture_height>& tex_cache) -> void
+{
+    if (!config::server::use_tex_prefetch || ray_hit.cell <= 0) return;
 
-            auto tex_x = int(tex_u * texture_width);
-            if ((!is_front_side && ray_dir_x > 0) && (is_front_side && ray_dir_y < 0)) tex_x = texture_width - 1 - tex_x;
+    const auto wall_len = std::max(static_cast<int>(shape_t::height / ray_hit.dist), 1);
+    tex_cache.prefetch(ray_hit.cell - 1, get_texture_column(pose, ray_dir_x, ray_dir_y, ray_hit), select_mip_level(wall_len));
+}
 
-            const auto tex_id = hit - 1;
-            tex_cache.update(tex_id, tex_x);
+template <typename shape_t>
+auto render_encode_column(
+    int x,
+    const pose_t& pose,
+    float ray_dir_x,
+    float ray_dir_y,
+    const ray_hit_t& ray_hit,
+    texture_cache_t<texture_height>& tex_cache,
+    floor_caster_t* floor_rows,
+    codec::run_encoder_t& encoder) -> void
+{
+    const auto hit_dist      = ray_hit.dist;
+    const auto hit           = ray_hit.cell;
 
-            const auto tex_v_step = static_cast<float>(texture_height) / row_id_height;
-            auto tex_v = (row_id_start - (frame.height - row_id_height) / 2) * tex_v_step;
+	const auto wall_len = std::max(static_cast<int>(shape_t::height / hit_dist), 1);
 
-            for (auto j = row_id_start; j < row_id_stop; j++)
-            {
-                const auto tex_y = int(tex_v) & (texture_height - 1);
-                tex_v += tex_v_step;
-
-                /*
-                const auto dist_x = std::abs((int)light.pos_x - map_x);
-                const auto dist_y = std::abs((int)light.pos_y - map_y);
-                const auto dist = std::min(std::max(dist_x, dist_y), 5);
-                */
-
-                //const auto wall_color = 192 * (tex_x % 16 && tex_y % 16);
-                //const auto wall_color = tex_x * 128 / texture_width + tex_y * 128 / texture_height;
-                //const auto wall_color = (tex_x * 256 / texture_width) ^ (tex_y * 256 / texture_height);
-
-                // Nearest-neighbor sampling
-                //const auto wall_color = texture_map[hit - 1][tex_y + tex_x * texture_height];
-                const auto wall_color = tex_cache.data[tex_y];
-                frame.buffer[j + i * frame.height] = wall_color;
-                //frame.buffer[j + i * frame.height] = wall_color >> (!is_front_side);
-                //frame.buffer[j + i * frame.height] = wall_color >> dist;
-
-                /*
-                // Birow_idar interpolation
-                const auto q11 = texture_map[hit - 1][std::min(tex_y + 0, 63) + std::min(tex_x + 0, 63) * texture_height];
-                const auto q21 = texture_map[hit - 1][std::min(tex_y + 1, 63) + std::min(tex_x + 0, 63) * texture_height];
-                const auto q12 = texture_map[hit - 1][std::max(tex_y + 0, 63) + std::max(tex_x + 1, 63) * texture_height];
-                const auto q22 = texture_map[hit - 1][std::max(tex_y + 1, 63) + std::max(tex_x + 1, 63) * texture_height];
-                const auto r1  = (q11 >> 1) + (q21 >> 1);
-                const auto r2  = (q12 >> 1) + (q22 >> 1);
-                const auto p   = (r1  >> 1) + (r2  >> 1);
-                frame.buffer[j + i * frame.height] = p >> (!is_front_side);
-                */
-
-                //zbuffer[x] = perp_wall_dist;
-            }
-        } // hit block
-        /*
-        else
-        {
-            zbuffer[x] = 1e9;
-        }
-        */
-    } // main loop
+	const auto tex_x = get_texture_column(pose, ray_dir_x, ray_dir_y, ray_hit);
+	const auto mip_level = select_mip_level(wall_len);
+
+	// Loaded maps are closed, only a camera outside the map sees no cell
+	const auto tex_id = std::max(hit - 1, 0);
+	tex_cache.update(tex_id, tex_x, mip_level);
+
+	const auto tex_v_step = shape_t::get_tex_v_step(wall_len);
+	const auto pixels_per_texel = static_cast<float>(wall_len) / texture_height;
+
+	encode_column<shape_t>(x, hit_dist, wall_len, mip_level, tex_v_step, pixels_per_texel, tex_cache, floor_rows, encoder);
+}
+
+// Same as render_encode_column() in Q16.16 fixed point, with reciprocals instead of divides
+template <typename shape_t>
+auto render_encode_column_fixed(
+    int x,
+    fp32_t pos_x,
+    fp32_t pos_y,
+    fp32_t ray_dir_x,
+    fp32_t ray_dir_y,
+    texture_cache_t<texture_height>& tex_cache,
+    floor_caster_t* floor_rows,
+    codec::run_encoder_t& encoder) -> void
+{
+    auto hit_dist = fp32_t {};
+    const auto ray_hit = cast_ray_fixed(pos_x, pos_y, ray_dir_x, ray_dir_y, hit_dist);
+
+	const auto wall_len = std::max(static_cast<int>(recip(hit_dist) * fp32_t {shape_t::height}), 1);
 
-    const auto sprite_x = light.pos_x - cmd.pose.pos_x;
-    const auto sprite_y = light.pos_y - cmd.pose.pos_y;
+	const auto tex_x = get_texture_column(pos_x, pos_y, ray_dir_x, ray_dir_y, hit_dist, ray_hit.is_front_side);
 
-    const auto inv_det = 1.0F / (cmd.pose.plane_x * cmd.pose.dir_y - cmd.pose.plane_y * cmd.pose.dir_x);
+	const auto mip_level = select_mip_level(wall_len);
 
-    const auto tfm_x = inv_det * (sprite_x * cmd.pose.dir_y   - sprite_y * cmd.pose.dir_x);
-    const auto tfm_y = inv_det * (sprite_y * cmd.pose.plane_x - sprite_x * cmd.pose.plane_y);
+	const auto tex_id = std::max(ray_hit.cell - 1, 0);
+	tex_cache.update(tex_id, tex_x, mip_level);
 
-    const auto sprite_screen_x = int((frame.width / 2) * (1.0F + tfm_x / tfm_y));
+	// wall_len < 2^15 keeps both in range
+	const auto tex_v_step = shape_t::get_tex_v_step_fixed(wall_len);
+	const auto pixels_per_texel = fp32_t::from_raw(wall_len << (fp32_t::frac_bits - 6)); // / texture_height
 
-    const auto sprite_height  = std::abs(int(frame.height / tfm_y)) >> 4;
-    const auto sprite_start_y = std::max((frame.height - sprite_height) / 2, 0);
-    const auto sprite_stop_y  = std::min((frame.height + sprite_height) / 2, frame.height);
+	encode_column<shape_t>(x, hit_dist.to_float(), wall_len, mip_level, tex_v_step, pixels_per_texel, tex_cache, floor_rows, encoder);
+}
+
+// Texture rows stay cached across slices and frames, as textures do not change
+texture_cache_t<texture_height> texture_cache;
+
+// Model of entropy-coded slices, reset at every slice
+codec::entropy_coder_t entropy_coder;
 
-    const auto sprite_width   = std::abs(int(frame.width / tfm_y)) >> 4;
-    const auto sprite_start_x = std::max(sprite_screen_x - sprite_width / 2, 0);
-    const auto sprite_stop_x  = std::min(sprite_screen_x + sprite_width / 2, frame.width);
+// Runs of the last columns of a run-length slice, which the next columns are matched against
+uint8_t column_history[codec::get_column_history_size(max_frame_height)];
 
-    const auto slice_width = slice_stop - slice_start;
-    const auto i_start = (sprite_start_x - slice_start);
-    //for (auto x = sprite_start_x; x < std::min(sprite_stop_x, slice_stop); x++)
-    for (auto i = i_start; i < i_stop; i++)
+// Rays and hits of the columns of a slice, for cast_rays_coherent()
+float column_ray_dirs_x[frame_shapes_t::max_slice_width];
+float column_ray_dirs_y[frame_shapes_t::max_slice_width];
+ray_hit_t column_hits[frame_shapes_t::max_slice_width];
+
+// Render and encode the columns [slice_start, slice_stop) of a frame of shape_t into frame.buffer,
+// with slices of up to shape_t::max_slice_width columns
+// on_column(encoder) is called after every column and may take the encoded bytes away by moving encoder.dst_ptr,
+// so that a slice can be streamed while it is being rendered, and frame.end is where the encoder stopped
+template <typename shape_t, typename column_sink_t>
+auto render_encode_slice(
+    shape_t,
+    const render_command_t& cmd,
+    int slice_start,
+    int slice_stop,
+    encoded_slice_t& frame,
+    column_sink_t&& on_column) -> void
+{
+    auto& tex_cache = texture_cache;
+    tex_cache.reset_stats();
+
+    codec::run_encoder_t encoder {frame.buffer, shape_t::height};
+    if (frame.codec == codec::codec_id_t::entropy)
     {
-        //if (tfm_y > 0 && slice_start <= x && x < slice_stop && tfm_y < zbuffer[x])
-        if (tfm_y > 0 && tfm_y < zbuffer[x])
+        entropy_coder.reset();
+        encoder.entropy = &entropy_coder;
+    }
+    else if (render_options.use_column_matches)
+    {
+        encoder.history = column_history;
+    }
+
+    const auto x_scale = cmd.tile.x_scale / shape_t::width;
+
+    floor_caster_t* floor_rows = nullptr;
+    if (render_options.floor_mode != floor_mode_t::flat)
+    {
+        floor_rows = &floor_caster;
+        floor_rows->num_ticks  = 0;
+        floor_rows->num_pixels = 0;
+        floor_rows->setup<shape_t>(cmd, x_scale, slice_start, render_options.floor_mode == floor_mode_t::floor_ceiling);
+    }
+
+    sprite_caster.num_sprites = 0;
+    if (render_options.use_sprites)
+    {
+        sprite_caster.setup(cmd, x_scale, slice_start, slice_stop, shape_t::height);
+    }
+
+    if (render_options.use_fixed_point)
+    {
+        const auto pos_x   = fp32_t {cmd.pose.pos_x};
+        const auto pos_y   = fp32_t {cmd.pose.pos_y};
+        const auto dir_x   = fp32_t {cmd.pose.dir_x};
+        const auto dir_y   = fp32_t {cmd.pose.dir_y};
+        const auto plane_x = fp32_t {cmd.pose.plane_x};
+        const auto plane_y = fp32_t {cmd.pose.plane_y};
+
+        // Camera plane coordinate scale in Q0.32, since Q16.16 would lose too much over a frame
+        const auto x_scale_q32 = static_cast<int64_t>(x_scale * 4294967296.0F);
+        const auto x_offset    = fp32_t {cmd.tile.x_offset};
+
+        for (auto x = slice_start; x < slice_stop; x++)
         {
-            //for (auto y = sprite_start_y; y < sprite_stop_y; y++)
-            for (auto j = sprite_start_y; j < sprite_stop_y; j++)
+            const auto cam_x = x_offset + fp32_t::from_raw(static_cast<int32_t>((x * x_scale_q32) >> 16));
+            const auto ray_dir_x = dir_x + plane_x * cam_x;
+            const auto ray_dir_y = dir_y + plane_y * cam_x;
+            const auto start_ticks = get_ticks();
+            render_encode_column_fixed<shape_t>(x, pos_x, pos_y, ray_dir_x, ray_dir_y, tex_cache, floor_rows, encoder);
+            column_costs[x] = get_ticks() - start_ticks;
+            on_column(encoder);
+        }
+        render_stats.num_traced_columns += slice_stop - slice_start;
+    }
+    else if (render_options.use_wall_coherence)
+    {
+        const auto num_columns = slice_stop - slice_start;
+        for (auto i = 0; i < num_columns; i++)
+        {
+            const float cam_x = (slice_start + i) * x_scale + cmd.tile.x_offset;
+            column_ray_dirs_x[i] = cmd.pose.dir_x + cmd.pose.plane_x * cam_x;
+            column_ray_dirs_y[i] = cmd.pose.dir_y + cmd.pose.plane_y * cam_x;
+        }
+        // Tracing is shared by all columns, so its cost is spread evenly
+        const auto trace_ticks = get_ticks();
+        cast_rays_coherent(cmd.pose, column_ray_dirs_x, column_ray_dirs_y, column_hits, num_columns, render_options.ray_packet_size);
+        const auto trace_cost = (get_ticks() - trace_ticks) / std::max(num_columns, 1);
+
+        for (auto i = 0; i < num_columns; i++)
+        {
+            const auto start_ticks = get_ticks();
+            if (i + 1 < num_columns)
             {
-                frame.buffer[j + i * frame.height] = 0xFF;
+                prefetch_column<shape_t>(cmd.pose, column_ray_dirs_x[i + 1], column_ray_dirs_y[i + 1], column_hits[i + 1], tex_cache);
             }
+            render_encode_column<shape_t>(
+                slice_start + i, cmd.pose, column_ray_dirs_x[i], column_ray_dirs_y[i], column_hits[i],
+                tex_cache, floor_rows, encoder);
+            column_costs[slice_start + i] = get_ticks() - start_ticks + trace_cost;
+            on_column(encoder);
         }
     }
+    else
+    {
+        constexpr auto max_ray_packet_size = 8;
+        const auto ray_packet_size = std::clamp(render_options.ray_packet_size, 1, max_ray_packet_size);
+
+        float ray_dirs_x[max_ray_packet_size];
+        float ray_dirs_y[max_ray_packet_size];
+        ray_hit_t ray_hits[max_ray_packet_size];
+
+        for (auto x = slice_start; x < slice_stop; x += ray_packet_size)
+        {
+            // Trace a whole packet of adjacent columns, even past the end of the slice
+            for (auto i = 0; i < ray_packet_size; i++)
+            {
+                //const float cam_x = static_cast<float>(2 * x) / frame.width - 1.0F;
+                const float cam_x = (x + i) * x_scale + cmd.tile.x_offset;
+                ray_dirs_x[i] = cmd.pose.dir_x + cmd.pose.plane_x * cam_x;
+                ray_dirs_y[i] = cmd.pose.dir_y + cmd.pose.plane_y * cam_x;
+            }
+            const auto trace_ticks = get_ticks();
+            cast_rays(cmd.pose, ray_dirs_x, ray_dirs_y, ray_hits, ray_packet_size);
+
+            const auto num_columns = std::min(ray_packet_size, slice_stop - x);
+            const auto trace_cost = (get_ticks() - trace_ticks) / num_columns;
+            render_stats.num_traced_columns += num_columns;
+            for (auto i = 0; i < num_columns; i++)
+            {
+                const auto start_ticks = get_ticks();
+                if (i + 1 < num_columns)
+                {
+                    prefetch_column<shape_t>(cmd.pose, ray_dirs_x[i + 1], ray_dirs_y[i + 1], ray_hits[i + 1], tex_cache);
+                }
+                render_encode_column<shape_t>(
+                    x + i, cmd.pose, ray_dirs_x[i], ray_dirs_y[i], ray_hits[i], tex_cache, floor_rows, encoder);
+                column_costs[x + i] = get_ticks() - start_ticks + trace_cost;
+                on_column(encoder);
+            }
+        } // for(x)
+    }
+
+    render_stats.num_tex_cache_hits   += tex_cache.num_hits;
+    render_stats.num_tex_cache_misses += tex_cache.num_misses;
+
+    if (floor_rows)
+    {
+        render_stats.floor_time_us    += floor_rows->num_ticks / get_ticks_per_us();
+        render_stats.num_floor_pixels += floor_rows->num_pixels;
+    }
+
+    frame.start = slice_start;
+    frame.end   = encoder.finish();
+}
+
+// Render and encode the columns [slice_start, slice_stop) into frame.buffer, specialized for the shape of the frame
+// Frames of a shape that is not in frame_shapes_t are encoded as empty slices
+template <typename column_sink_t>
+auto render_encode_slice(
+    const render_command_t& cmd,
+    int slice_start,
+    int slice_stop,
+    encoded_slice_t& frame,
+    column_sink_t&& on_column) -> void
+{
+    const auto is_rendered = frame_shapes_t::dispatch(frame.width, frame.height, [&](auto shape)
+    {
+        render_encode_slice(shape, cmd, slice_start, slice_stop, frame, on_column);
+    });
+    if (is_rendered) return;
+
+    codec::run_encoder_t encoder {frame.buffer};
+    if (frame.codec == codec::codec_id_t::entropy) encoder.entropy = &entropy_coder;
+    frame.start = slice_start;
+    frame.end   = encoder.finish();
 }
-#endif
 
+// Render and encode a whole slice into frame.buffer
+auto render_encode_slice(
+    const render_command_t& cmd,
+    int slice_start,
+    int slice_stop,
+    encoded_slice_t& frame) -> void
+{
+    render_encode_slice(cmd, slice_start, slice_stop, frame, [](codec::run_encoder_t&) {});
+    frame.size = frame.end - frame.buffer;
+}
@@ -3,25 +3,11 @@
 #include <cmath>
 #include <cstring>
 
+#include "fixed.hpp"
 #include "types.hpp"
 
 #if 0
 
-struct fp32_t
-{
-    int32_t value {0};
-
-    constexpr fp32_t() = default;
-    constexpr fp32_t(float x) : value {static_cast<int32_t>(x * (1 << 16))} {}
-
-    constexpr auto to_float() const -> float { return static_cast<float>(value) / (1 << 16); }
-
-    constexpr auto operator+(const fp32_t& x) const -> fp32_t { return value + x.value; }
-    constexpr auto operator-(const fp32_t& x) const -> fp32_t { return value - x.value; }
-    constexpr auto operator/(const fp32_t& x) const -> fp32_t { return (value / x.value) << 16; }
-    constexpr auto operator*(const fp32_t& x) const -> fp32_t { return (value * x.value) >> 16; }
-};
-
 struct fp32_vec3_t
 {
     fp32_t x {0.0F};
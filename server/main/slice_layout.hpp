@@ -0,0 +1,73 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include "common/config.hpp"
+
+// Column ranges of the slices of a frame
+// Adaptive layouts give every slice about the same render cost, measured per column on the previous frame,
+// so that streaming a slice overlaps evenly with rendering the next one
+struct slice_layout_t
+{
+    static constexpr auto num_slices = config::common::num_slices;
+
+    // Slice boundaries stay on multiples of a ray packet
+    static constexpr auto column_align = 8;
+    static constexpr auto min_slice_width = column_align;
+    static constexpr auto max_slice_width = config::common::max_slice_width;
+
+    int starts[num_slices + 1] {};
+
+    auto get_start(int slice_id) const -> int { return starts[slice_id]; }
+    auto get_stop(int slice_id)  const -> int { return starts[slice_id + 1]; }
+
+    auto init(int width) -> void
+    {
+        for (auto i = 0; i <= num_slices; i++) starts[i] = i * width / num_slices;
+    }
+
+    // Split columns [0, width) so that the cost of every slice is as close as possible to an equal share
+    // Falls back to equal widths until costs have been measured
+    auto update(const uint32_t* column_costs, int width) -> void
+    {
+        auto total_cost = int64_t {0};
+        for (auto x = 0; x < width; x++) total_cost += column_costs[x];
+        if (total_cost == 0 || width % column_align != 0)
+        {
+            init(width);
+            return;
+        }
+
+        starts[0] = 0;
+        starts[num_slices] = width;
+
+        auto x = 0;
+        auto cost = int64_t {0};
+        for (auto i = 1; i < num_slices; i++)
+        {
+            // Widths within limits, leaving enough columns for the remaining slices
+            const auto num_remaining = num_slices - i;
+            const auto lo = std::max(starts[i - 1] + min_slice_width, width - num_remaining * max_slice_width);
+            const auto hi = std::min(starts[i - 1] + max_slice_width, width - num_remaining * min_slice_width);
+            const auto target_cost = total_cost * i / num_slices;
+
+            // First aligned boundary at or past the target cost, or the one before it if that is closer
+            while (x < hi && (x < lo || cost < target_cost))
+            {
+                for (auto j = 0; j < column_align; j++) cost += column_costs[x++];
+            }
+            if (x - column_align >= lo && cost > target_cost)
+            {
+                auto prev_cost = cost;
+                for (auto j = 1; j <= column_align; j++) prev_cost -= column_costs[x - j];
+                if (target_cost - prev_cost < cost - target_cost)
+                {
+                    x -= column_align;
+                    cost = prev_cost;
+                }
+            }
+            starts[i] = x;
+        }
+    }
+};
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+// Single-producer single-consumer ring of slots, used to hand packets from the render task to the stream task
+// The producer fills the slot at the head while the consumer reads the slot at the tail
+// Indices count modulo 2 * num_slots, so the ring is empty when head == tail and full when they are num_slots apart
+// Neither side blocks here: callers wait for a notification from the other side when a slot is not available
+template <typename slot_t, int num_slots_>
+struct spsc_ring_t
+{
+    static constexpr auto num_slots = num_slots_;
+
+    slot_t slots[num_slots];
+
+    std::atomic<uint32_t> head {0}; // Written by the producer only
+    std::atomic<uint32_t> tail {0}; // Written by the consumer only
+
+    static constexpr auto next(uint32_t i) -> uint32_t { return (i + 1) % (2 * num_slots); }
+
+    // Free slot, or nullptr if the consumer has not released the oldest slot yet
+    auto get_write_slot() -> slot_t*
+    {
+        const auto h = head.load(std::memory_order_relaxed);
+        if ((h + num_slots) % (2 * num_slots) == tail.load(std::memory_order_acquire)) return nullptr;
+        return &slots[h % num_slots];
+    }
+
+    // Publish the slot from get_write_slot() and everything written before
+    auto commit_write() -> void { head.store(next(head.load(std::memory_order_relaxed)), std::memory_order_release); }
+
+    // Oldest published slot, or nullptr if the ring is empty
+    auto get_read_slot() -> const slot_t*
+    {
+        const auto t = tail.load(std::memory_order_relaxed);
+        if (head.load(std::memory_order_acquire) == t) return nullptr;
+        return &slots[t % num_slots];
+    }
+
+    // Number of published slots, which the consumer can read in order with get_read_slot(i)
+    auto get_read_size() -> int
+    {
+        const auto t = tail.load(std::memory_order_relaxed);
+        return (head.load(std::memory_order_acquire) + 2 * num_slots - t) % (2 * num_slots);
+    }
+
+    // i-th oldest published slot, for i < get_read_size()
+    auto get_read_slot(int i) -> const slot_t* { return &slots[(tail.load(std::memory_order_relaxed) + i) % num_slots]; }
+
+    // Hand the num_read oldest slots back to the producer
+    auto commit_read(int num_read = 1) -> void
+    {
+        const auto t = tail.load(std::memory_order_relaxed);
+        tail.store((t + num_read) % (2 * num_slots), std::memory_order_release);
+    }
+};
@@ -0,0 +1,277 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(ESP_PLATFORM)
+#include "lwip/sockets.h"
+#else
+#include <sys/uio.h>
+#endif
+
+#include "common/codec.hpp"
+#include "common/config.hpp"
+#include "common/protocol.hpp"
+#include "raycaster.hpp"
+#include "slice_layout.hpp"
+#include "spsc_ring.hpp"
+#include "types.hpp"
+
+constexpr auto max_pkt_payload_size = config::common::pkt_buffer_size - sizeof(protocol::pkt_info_t);
+constexpr auto min_pkt_payload_size = max_pkt_payload_size - sizeof(protocol::frame_info_t);
+
+// A literal column and the end marker
+constexpr auto max_encoded_column_size = codec::get_max_encoded_size(1, config::common::screen_height);
+static_assert(max_encoded_column_size <= max_pkt_payload_size);
+
+// Encoded bytes that queued packets point into: every queued packet plus the slice being encoded,
+// which holds less than a packet and a column between two calls to slice_streamer_t::drain()
+constexpr auto enc_ring_size = static_cast<int>((config::server::num_pkt_slots + 2) * max_pkt_payload_size);
+
+// Room for the column that crosses the end of the encoded byte ring
+constexpr auto enc_ring_buffer_size = enc_ring_size + max_encoded_column_size;
+
+// Packet queued for the stream task
+// The payload is not copied but points into the encoded byte ring, in two parts when it wraps around its end
+// Sent as a gather list of the header, the payload and the frame info on the last packet of a frame,
+// so a packet is only as long as its payload and only full packets are pkt_buffer_size bytes
+struct packet_t
+{
+	uint8_t header[sizeof(protocol::pkt_info_t)];
+	const uint8_t* payload[2] {nullptr, nullptr};
+	int payload_size[2] {0, 0};
+	bool has_frame_info {false};
+	protocol::frame_info_t frame_info;
+
+	auto get_size() const -> int
+	{
+		return sizeof(header) + payload_size[0] + payload_size[1] + (has_frame_info ? sizeof(frame_info) : 0);
+	}
+};
+
+constexpr auto max_pkt_iovecs = 4;
+
+// Gather list of a packet for sendmsg()
+inline auto get_pkt_iovecs(const packet_t& pkt, iovec* iov) -> int
+{
+	auto num_iovecs = 0;
+	const auto add = [iov, &num_iovecs](const void* data, int size)
+	{
+		if (size == 0) return;
+		iov[num_iovecs].iov_base = const_cast<void*>(data);
+		iov[num_iovecs].iov_len  = size;
+		num_iovecs++;
+	};
+
+	add(pkt.header, sizeof(pkt.header));
+	add(pkt.payload[0], pkt.payload_size[0]);
+	add(pkt.payload[1], pkt.payload_size[1]);
+	add(&pkt.frame_info, pkt.has_frame_info ? sizeof(pkt.frame_info) : 0);
+	return num_iovecs;
+}
+
+// The last packet of a frame carries the frame info
+inline auto is_frame_end(const protocol::pkt_info_t& pkt_info) -> bool
+{
+	return pkt_info.slice_end && pkt_info.slice_id == (config::common::num_slices - 1);
+}
+
+// Cuts encoded slices into packets while they are being rendered
+// The encoder writes into the encoded byte ring at the position returned by begin_slice(),
+// and drain() is called whenever it has finished a column to queue every full packet of payload,
+// so the first packets of a slice leave while its later columns are still being rendered
+// Packets are taken from pkt_queue.get_packet() and handed over with pkt_queue.commit_packet()
+// Frame info is added to the last packet of the last slice, or sent as an additional packet if there is no space
+// Shared by the ESP32 firmware and the host server so both stream the exact same packets
+template <typename pkt_queue_t>
+struct slice_streamer_t
+{
+	pkt_queue_t& pkt_queue;
+	uint8_t* ring {nullptr}; // enc_ring_buffer_size bytes
+	int pkt_pos {0}; // First byte of the ring that is not in a packet yet
+
+	int slice_id {0};
+	int slice_start {0};
+	codec::codec_id_t codec_id {codec::codec_id_t::rle};
+	int pkt_id {0};
+	int size {0}; // Encoded bytes of the slice sent so far
+
+	auto begin_slice(int slice_id_, int slice_start_, codec::codec_id_t codec_id_ = codec::codec_id_t::rle) -> uint8_t*
+	{
+		slice_id    = slice_id_;
+		slice_start = slice_start_;
+		codec_id    = codec_id_;
+		pkt_id = 0;
+		size   = 0;
+		return ring + pkt_pos;
+	}
+
+	// Queue full packets of the bytes up to end while more than a packet of them is pending
+	// Up to a whole packet stays pending for finish(), as the last packet of the slice is marked when it is queued
+	// Returns where the encoder continues
+	auto drain(uint8_t* end) -> uint8_t*
+	{
+		// Bytes written past the end of the ring continue at its start
+		if (end > ring + enc_ring_size)
+		{
+			std::memcpy(ring, ring + enc_ring_size, end - ring - enc_ring_size);
+			end -= enc_ring_size;
+		}
+
+		while (get_num_pending(end) > static_cast<int>(max_pkt_payload_size)) send(max_pkt_payload_size, false);
+		return end;
+	}
+
+	// Queue the rest of a finished slice, ending at end
+	// Returns the number of packets of the slice
+	auto finish(uint8_t* end, const protocol::frame_info_t& frame_info) -> int
+	{
+		end = drain(end);
+
+		// Only the last slice of a frame needs room for the frame info
+		const auto frame_end = (slice_id == (config::common::num_slices - 1));
+		const auto rem_size = get_num_pending(end);
+		const auto is_slice_end = rem_size <= static_cast<int>(frame_end ? min_pkt_payload_size : max_pkt_payload_size);
+		send(rem_size, is_slice_end, &frame_info);
+
+		// Send frame end and frame info as an additional packet if there was no space in the last packet
+		if (!is_slice_end) send(0, true, &frame_info);
+
+		return pkt_id;
+	}
+
+	auto get_num_pending(const uint8_t* end) const -> int
+	{
+		return (static_cast<int>(end - ring) - pkt_pos + enc_ring_size) % enc_ring_size;
+	}
+
+	// Queue the next payload_size bytes of the ring as a packet
+	auto send(int payload_size, bool is_slice_end, const protocol::frame_info_t* frame_info = nullptr) -> void
+	{
+		auto& pkt = *pkt_queue.get_packet();
+
+		protocol::write_pkt_info(
+			is_slice_end, payload_size > 0, static_cast<int>(codec_id), slice_id, pkt_id, slice_start, payload_size, pkt.header);
+
+		const auto first_size = std::min(payload_size, enc_ring_size - pkt_pos);
+		pkt.payload[0] = ring + pkt_pos;
+		pkt.payload[1] = ring;
+		pkt.payload_size[0] = first_size;
+		pkt.payload_size[1] = payload_size - first_size;
+
+		const auto frame_end = (slice_id == (config::common::num_slices - 1));
+		pkt.has_frame_info = frame_end && is_slice_end;
+		if (pkt.has_frame_info) pkt.frame_info = *frame_info;
+
+		pkt_queue.commit_packet();
+
+		pkt_pos = (pkt_pos + payload_size) % enc_ring_size;
+		size += payload_size;
+		pkt_id++;
+	}
+};
+
+// Packets queued by the render task for the stream task
+using pkt_ring_t = spsc_ring_t<packet_t, config::server::num_pkt_slots>;
+
+// Notification bits of the render task
+constexpr auto frame_start_bit = 1U << 0; // New render command
+constexpr auto slot_free_bit   = 1U << 1; // Packet sent, its slot can be reused
+
+// Notification bits of the stream task
+constexpr auto pkt_ready_bit = 1U << 0;
+
+// Packet queue of the slice streamer, waiting for the stream task to free a slot when the ring is full
+// wait_bits(bits) blocks the render task until one of its notification bits is set,
+// notify_stream() sets pkt_ready_bit of the stream task
+template <typename wait_t, typename notify_t, typename clock_t>
+struct pkt_ring_writer_t
+{
+	pkt_ring_t& pkt_ring;
+	wait_t& wait_bits;
+	notify_t& notify_stream;
+	clock_t& get_time_us;
+
+	packet_t* pkt {nullptr};
+	int64_t wait_us {0}; // Time blocked on a full ring, which is not render time
+
+	auto get_packet() -> packet_t*
+	{
+		if (!(pkt = pkt_ring.get_write_slot()))
+		{
+			wait_us -= get_time_us();
+			while (!(pkt = pkt_ring.get_write_slot())) wait_bits(slot_free_bit);
+			wait_us += get_time_us();
+		}
+		return pkt;
+	}
+
+	auto commit_packet() -> void
+	{
+		pkt_ring.commit_write();
+		notify_stream();
+	}
+};
+
+// Render task of the ESP32 firmware and the host server, never returns
+// Renders a frame of cmd whenever frame_start_bit is set, and queues its packets in pkt_ring while its slices render
+// Notifications and the clock are passed in, as the ESP32 and the host have their own
+template <typename wait_t, typename notify_t, typename clock_t>
+auto run_render_task(
+	const render_command_t& cmd,
+	protocol::frame_info_t& frame_info,
+	slice_layout_t& slice_layout,
+	pkt_ring_t& pkt_ring,
+	uint8_t* enc_ring,
+	wait_t&& wait_bits,
+	notify_t&& notify_stream,
+	clock_t&& get_time_us) -> void
+{
+	using pkt_writer_t = pkt_ring_writer_t<std::remove_reference_t<wait_t>, std::remove_reference_t<notify_t>, std::remove_reference_t<clock_t>>;
+	pkt_writer_t pkt_writer {pkt_ring, wait_bits, notify_stream, get_time_us};
+
+	// Packets of consecutive slices and frames follow each other in the encoded byte ring
+	slice_streamer_t<pkt_writer_t> streamer {pkt_writer, enc_ring};
+
+	for (;;)
+	{
+		// Wait for the stream task to start a new frame
+		wait_bits(frame_start_bit);
+
+		auto render_elapsed = 0U;
+
+		render_stats = {};
+
+		// Balance the slices of this frame with the column costs of the last one
+		if (config::server::use_adaptive_slices) slice_layout.update(column_costs, config::common::screen_width);
+
+		pkt_writer.wait_us = 0;
+
+		for (auto slice_id = 0; slice_id < config::common::num_slices; slice_id++)
+		{
+			encoded_slice_t slice;
+			slice.width  = config::common::screen_width;
+			slice.height = config::common::screen_height;
+			slice.codec  = static_cast<codec::codec_id_t>(config::server::slice_codec);
+
+			// Queue packets as soon as they are full, while the rest of the slice renders
+			slice.buffer = streamer.begin_slice(slice_id, slice_layout.get_start(slice_id), slice.codec);
+
+			render_elapsed -= get_time_us();
+			render_encode_slice(cmd, slice_layout.get_start(slice_id), slice_layout.get_stop(slice_id), slice,
+				[&streamer](codec::run_encoder_t& encoder) { encoder.dst_ptr = streamer.drain(encoder.dst_ptr); });
+			render_elapsed += get_time_us();
+
+			// Frame info goes out with the last packet of the last slice
+			if (slice_id == config::common::num_slices - 1)
+			{
+				frame_info.render_time_us = render_elapsed - pkt_writer.wait_us;
+				frame_info.render_stats   = render_stats;
+			}
+
+			streamer.finish(slice.end, frame_info);
+		}
+	}
+}
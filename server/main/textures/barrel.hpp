@@ -0,0 +1,147 @@
+
+#pragma once
+
+// Generated by generate_texture.py on 2026-10-16T14:06:49.978440
+
+#include <cstdint>
+
+namespace textures
+{
+
+// Colors of all levels in rgb233, texels are indices into the palette packed in barrel_index_bits each
+constexpr auto barrel_index_bits = 4;
+
+constexpr uint8_t barrel_palette[15] = {
+0,8,9,72,73,81,82,83,90,91,92,145,154,155,164,
+
+};
+
+// Palette indices of the 64x64 texels followed by prefiltered mip levels 1 to 6 (32x32 down to 1x1),
+// box-filtered from the source texture
+// Levels are transposed (stored column by column) and packed least significant bit first, with a byte of padding at the end
+
+constexpr uint8_t barrel_texels[2732] = {
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,64,68,68,68,68,68,68,68,68,68,68,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,119,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,6,0,0,0,0,0,0,
+0,0,0,96,68,68,153,153,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,153,153,68,4,0,0,0,0,0,0,153,68,68,153,153,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,153,153,68,68,68,7,0,
+0,0,0,153,68,68,153,153,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,153,153,68,68,68,153,0,0,0,0,153,68,68,170,170,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,170,154,68,68,68,153,0,
+0,0,0,170,68,68,170,170,68,68,84,181,187,187,187,187,187,187,187,187,91,69,68,68,68,170,170,68,68,68,153,0,0,0,0,170,68,68,238,238,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,238,170,68,68,68,170,0,
+0,0,0,238,187,187,238,238,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,238,238,187,75,68,170,0,0,0,0,238,187,187,238,238,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,238,238,187,187,187,238,0,
+0,0,0,238,187,187,238,238,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,238,238,187,187,187,238,0,0,0,0,238,187,187,238,238,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,238,238,187,187,187,238,0,
+0,0,0,238,187,187,238,238,187,187,91,85,85,85,85,85,85,85,85,85,85,181,187,187,187,238,238,187,187,187,238,0,0,0,0,238,187,187,238,238,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,238,238,187,187,187,238,0,
+0,0,0,238,85,85,238,238,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,238,238,85,181,187,238,0,0,0,0,238,85,85,238,238,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,238,238,85,85,85,238,0,
+0,0,0,238,85,85,238,238,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,238,238,85,85,85,238,0,0,0,0,238,85,85,238,238,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,238,238,85,85,85,238,0,
+0,0,0,238,85,85,238,238,85,85,181,187,187,187,187,187,187,187,187,187,187,91,85,85,85,238,238,85,85,85,238,0,0,0,0,238,85,85,238,238,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,238,238,85,85,85,238,0,
+0,0,0,238,187,187,238,238,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,238,238,187,91,85,238,0,0,0,0,238,187,187,238,238,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,238,238,187,187,187,238,0,
+0,0,0,238,187,187,238,238,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,238,238,187,187,187,238,0,0,0,0,238,187,187,238,238,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,238,238,187,187,187,238,0,
+0,0,0,238,187,187,238,238,187,187,91,85,85,85,85,85,85,85,85,85,85,181,187,187,187,238,238,187,187,187,238,0,0,0,0,238,187,187,238,238,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,238,238,187,187,187,238,0,
+0,0,0,238,85,85,238,238,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,238,238,85,181,187,238,0,0,0,0,238,85,85,238,238,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,238,238,85,85,85,238,0,
+0,0,0,238,85,85,238,238,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,238,238,85,85,85,238,0,0,0,0,238,85,85,238,238,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,238,238,85,85,85,238,0,
+0,0,0,238,85,85,238,238,85,85,181,187,187,187,187,187,187,187,187,187,187,91,85,85,85,238,238,85,85,85,238,0,0,0,0,238,85,85,238,238,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,238,238,85,85,85,238,0,
+0,0,0,238,187,187,238,238,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,238,238,187,91,85,238,0,0,0,0,238,187,187,238,238,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,238,238,187,187,187,238,0,
+0,0,0,238,187,187,238,238,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,238,238,187,187,187,238,0,0,0,0,238,187,187,238,238,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,238,238,187,187,187,238,0,
+0,0,0,238,187,187,238,238,187,187,91,85,85,85,85,85,85,85,85,85,85,181,187,187,187,238,238,187,187,187,238,0,0,0,0,238,187,187,238,238,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,238,238,187,187,187,238,0,
+0,0,0,238,68,85,238,238,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,238,238,68,180,187,238,0,0,0,0,238,68,68,238,238,68,68,68,85,85,85,85,85,85,85,85,85,85,68,68,68,68,238,238,68,68,68,170,0,
+0,0,0,170,68,68,238,238,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,238,170,68,68,68,170,0,0,0,0,170,68,68,170,170,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,170,170,68,68,68,153,0,
+0,0,0,153,68,68,170,170,68,68,84,85,85,85,85,85,85,85,85,85,85,69,68,68,68,170,154,68,68,68,153,0,0,0,0,153,68,68,153,153,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,153,153,68,68,68,153,0,
+0,0,0,153,84,85,153,153,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,153,153,69,68,68,7,0,0,0,0,96,68,68,153,153,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,68,153,153,68,4,0,0,0,
+0,0,0,0,0,0,96,119,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,68,68,68,68,68,68,68,68,68,68,4,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,32,0,65,68,68,68,68,20,0,0,0,0,0,0,96,68,153,68,68,68,68,68,68,68,68,148,73,1,0,0,144,68,153,68,68,68,68,68,68,68,68,148,73,68,9,0,160,68,170,85,181,187,187,187,187,91,85,165,74,68,10,
+0,224,187,238,187,187,187,187,187,187,187,187,235,190,85,14,0,224,187,238,187,187,187,187,187,187,187,187,235,190,187,14,0,224,187,238,187,85,85,85,85,85,85,187,235,190,187,14,0,224,85,238,85,85,85,85,85,85,85,85,229,94,181,14,
+0,224,85,238,85,85,85,85,85,85,85,85,229,94,85,14,0,224,85,238,187,187,187,187,187,187,187,187,235,94,85,14,0,224,187,238,187,187,187,187,187,187,187,187,235,190,187,14,0,224,187,238,187,187,187,187,187,187,187,187,235,190,187,14,
+0,224,187,238,187,91,85,85,85,85,181,187,235,190,187,14,0,224,85,238,85,85,85,85,85,85,85,85,229,94,187,14,0,224,85,238,85,85,85,85,85,85,85,85,229,94,85,14,0,224,85,238,187,187,187,187,187,187,187,187,235,94,85,14,
+0,224,187,238,187,187,187,187,187,187,187,187,235,190,187,14,0,224,187,238,187,187,187,187,187,187,187,187,235,190,187,14,0,224,187,238,85,85,85,85,85,85,85,85,229,190,187,14,0,224,68,238,85,85,85,85,85,85,85,85,229,78,85,14,
+0,160,68,170,68,68,68,68,68,68,68,68,164,74,68,10,0,144,68,153,85,85,85,85,85,85,85,85,149,73,68,9,0,96,68,153,85,85,85,85,85,85,85,85,149,73,3,0,0,0,0,32,0,67,68,68,68,68,52,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,67,68,68,52,36,0,32,164,84,85,85,69,102,36,96,235,187,187,187,187,204,107,96,235,85,85,85,85,204,107,96,229,187,187,187,187,221,101,96,235,187,187,187,187,221,107,
+96,235,91,85,85,181,221,107,96,229,187,187,187,187,221,101,96,235,187,187,187,187,204,107,96,229,85,85,85,85,200,101,32,164,84,85,85,69,102,36,0,96,67,85,85,52,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,96,68,68,21,194,187,187,92,210,187,187,93,210,187,187,93,194,187,187,92,96,84,69,21,0,0,0,0,0,0,182,107,182,107,0,0,68,68,4,0,
+
+};
+
+// Runs of equal texels in every texture column (row of the transposed data)
+// Column i has the runs [barrel_run_offsets[i], barrel_run_offsets[i + 1]) in barrel_run_ends
+// Each entry is the exclusive end texel of a run, so a column's last run always ends at 64
+
+constexpr uint16_t barrel_run_offsets[64 + 1] = {
+0,1,2,3,4,5,6,7,8,11,17,25,34,43,53,66,76,86,95,104,113,124,133,143,152,161,170,181,190,200,209,218,227,238,247,257,266,275,284,295,304,314,323,332,341,352,361,372,383,393,402,414,423,434,443,449,452,453,454,455,456,457,458,459,460,
+
+};
+
+constexpr uint8_t barrel_run_ends[460] = {
+64,
+64,
+64,
+64,
+64,
+64,
+64,
+64,
+21,43,64,
+13,14,16,50,51,64,
+7,8,12,16,50,54,57,64,
+6,8,12,16,50,54,60,61,64,
+6,8,12,16,50,54,60,62,64,
+6,8,12,16,50,53,54,60,62,64,
+6,8,12,16,21,23,41,43,50,54,60,62,64,
+6,8,12,16,50,52,54,60,62,64,
+6,8,12,16,50,54,57,60,62,64,
+6,8,12,16,50,54,60,62,64,
+6,8,12,16,50,54,60,62,64,
+6,8,12,16,50,54,60,62,64,
+6,8,12,16,21,43,50,54,60,62,64,
+6,8,12,16,50,54,60,62,64,
+6,8,12,16,50,54,57,60,62,64,
+6,8,12,16,50,54,60,62,64,
+6,8,12,16,50,54,60,62,64,
+6,8,12,16,50,54,60,62,64,
+6,8,12,16,21,43,50,54,60,62,64,
+6,8,12,16,50,54,60,62,64,
+6,8,12,16,50,54,57,60,62,64,
+6,8,12,16,50,54,60,62,64,
+6,8,12,16,50,54,60,62,64,
+6,8,12,16,50,54,60,62,64,
+6,8,12,16,21,43,50,54,60,62,64,
+6,8,12,16,50,54,60,62,64,
+6,8,12,16,50,54,57,60,62,64,
+6,8,12,16,50,54,60,62,64,
+6,8,12,16,50,54,60,62,64,
+6,8,12,16,50,54,60,62,64,
+6,8,12,16,21,43,50,54,60,62,64,
+6,8,12,16,50,54,60,62,64,
+6,8,12,16,50,54,57,60,62,64,
+6,8,12,16,50,54,60,62,64,
+6,8,12,16,50,54,60,62,64,
+6,8,12,16,50,54,60,62,64,
+6,8,12,16,21,43,50,54,60,62,64,
+6,8,12,16,50,54,60,62,64,
+6,8,10,12,16,50,54,57,60,62,64,
+6,8,12,16,22,42,50,54,60,62,64,
+6,8,12,16,50,52,54,60,62,64,
+6,8,12,16,50,54,60,62,64,
+6,8,12,16,21,43,50,53,54,60,62,64,
+6,8,12,16,50,54,60,62,64,
+6,8,9,12,16,50,54,55,60,61,64,
+7,8,12,16,48,50,54,57,64,
+13,14,16,50,51,64,
+21,43,64,
+64,
+64,
+64,
+64,
+64,
+64,
+64,
+64,
+
+};
+
+} // namespace textures
@@ -1,78 +1,146 @@
 
 #pragma once
 
-// Generated by generate_texture.py on 2022-09-07T14:50:31.497918
+// Generated by generate_texture.py on 2026-10-16T14:06:49.982389
 
 #include <cstdint>
 
 namespace textures
 {
 
-constexpr uint8_t bluestone[64 * 64] = {
-9,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,4,4,4,4,3,3,3,3,3,3,0,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,82,
-3,5,5,5,5,5,5,5,5,5,4,4,4,4,4,0,5,5,5,5,4,5,4,5,5,5,4,4,4,4,4,4,4,5,4,4,4,4,4,4,0,9,4,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,4,82,
-3,5,5,4,4,4,4,5,4,4,3,4,3,4,3,0,5,5,4,4,4,4,3,4,4,4,3,5,4,4,4,4,5,4,4,4,3,3,4,4,0,9,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,4,4,82,
-3,5,5,3,5,3,4,4,3,4,4,4,4,3,4,0,5,4,4,5,5,4,4,4,4,3,4,4,5,5,4,3,4,4,4,3,3,3,4,3,0,9,5,5,5,5,5,5,4,5,5,4,5,5,5,5,5,5,4,3,4,3,4,82,
-3,5,4,4,3,5,5,5,4,4,5,3,3,3,3,0,5,5,4,5,5,5,4,3,5,4,5,4,5,5,5,4,3,4,3,3,3,3,3,3,0,9,5,5,5,5,5,4,5,5,4,4,5,5,5,5,5,5,4,3,4,3,3,82,
-3,5,5,4,6,6,5,5,5,5,4,3,3,3,3,0,5,5,5,4,5,6,5,4,4,5,5,5,4,5,5,4,3,3,3,3,3,3,3,3,0,2,5,5,6,6,5,4,5,5,5,5,7,5,5,5,4,4,4,4,3,3,3,82,
-3,5,3,4,6,6,5,5,5,3,4,5,4,3,3,0,5,5,5,4,3,3,4,3,4,5,5,5,5,4,3,3,3,3,3,3,3,3,3,3,0,2,5,5,6,6,5,5,5,4,5,7,87,7,5,3,4,4,5,3,4,3,3,82,
-3,5,5,4,4,3,5,5,4,3,3,4,4,3,3,0,5,5,4,3,3,4,3,4,4,3,5,5,5,3,3,3,3,3,3,3,3,2,2,3,0,3,5,5,5,5,5,5,4,5,5,5,7,5,4,3,5,3,3,5,2,3,3,82,
-3,5,5,3,3,3,5,4,4,3,4,3,3,2,3,0,5,4,3,3,4,3,3,4,4,3,4,3,3,3,3,3,3,2,2,2,2,3,2,2,0,3,5,5,5,4,4,5,5,4,5,5,4,5,4,4,3,3,2,3,3,3,3,82,
-3,5,4,3,3,3,4,3,3,5,5,3,3,2,3,0,5,5,4,3,4,3,4,3,3,4,3,3,3,3,2,3,3,2,2,2,3,2,2,2,0,4,5,5,5,4,4,4,5,5,4,4,4,3,4,5,5,4,3,3,2,3,3,82,
-3,5,3,5,3,3,5,3,4,5,5,2,3,3,2,0,5,5,4,4,3,3,3,3,3,4,4,3,2,2,2,3,3,2,2,3,2,2,2,2,0,4,5,5,5,5,4,4,5,3,3,5,5,5,3,4,5,5,4,4,3,3,3,82,
-3,5,4,4,4,5,5,5,3,3,3,3,3,3,2,0,5,3,3,3,4,3,3,3,3,4,4,3,3,3,2,3,3,3,2,2,2,2,3,2,0,4,5,5,4,5,5,5,5,3,2,3,4,5,3,4,4,5,4,2,3,3,3,82,
-3,5,4,5,4,4,5,5,3,2,3,3,3,3,2,0,5,5,3,3,2,3,3,3,2,3,3,3,2,3,3,3,3,3,2,2,2,2,2,2,0,3,5,5,5,5,5,5,3,5,3,3,4,2,2,3,3,4,4,3,3,3,3,82,
-3,5,3,3,4,4,4,4,4,3,3,2,3,3,2,0,5,4,4,3,3,3,2,3,2,2,2,2,2,2,2,2,2,2,3,2,3,2,2,2,0,3,5,5,5,4,4,5,5,4,5,5,3,2,2,3,3,3,3,2,3,3,3,82,
-3,5,4,4,3,4,4,4,4,3,2,3,2,3,2,0,5,3,4,3,3,3,2,2,2,3,3,2,2,2,3,2,2,2,2,2,2,2,2,2,0,3,5,5,5,5,4,5,5,5,5,5,4,3,3,3,2,3,3,2,3,3,3,82,
-3,5,4,4,3,4,3,4,4,3,3,3,3,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,9,82,
-3,5,3,3,2,3,3,3,3,3,3,2,3,2,2,0,5,5,5,5,5,5,5,5,5,5,4,0,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,82,
-3,5,5,3,3,3,3,3,3,3,3,2,2,3,2,0,5,5,5,5,5,4,4,5,5,3,3,0,9,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,9,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,4,82,
-3,5,3,3,3,3,2,3,3,3,3,2,2,2,2,0,5,4,5,5,4,5,4,4,3,3,2,0,9,5,5,5,5,5,5,5,4,4,5,5,5,5,5,5,4,0,9,5,3,5,5,5,5,5,5,5,5,5,5,5,5,4,4,82,
-3,5,3,3,2,2,3,2,3,3,3,2,2,3,2,0,5,5,5,5,3,3,3,4,4,3,2,0,9,5,4,5,4,4,5,5,4,4,4,4,3,3,4,4,4,0,9,5,5,5,3,5,5,5,5,5,5,5,5,3,4,3,3,82,
-3,5,3,3,2,2,3,2,2,2,2,3,3,2,2,0,5,5,4,4,4,3,3,3,4,3,2,0,9,5,5,4,4,5,3,5,2,5,5,4,3,3,3,2,2,0,9,5,4,5,5,5,3,5,4,4,3,3,3,3,3,3,3,82,
-3,5,2,3,3,2,3,2,2,2,2,2,2,2,2,0,4,3,3,4,4,3,3,2,3,2,2,0,9,5,4,4,3,4,3,2,4,2,4,2,2,3,3,3,2,0,9,5,4,4,3,3,5,3,4,4,3,3,3,3,3,3,3,82,
-9,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,5,3,3,3,3,2,3,2,3,3,0,9,5,4,4,3,2,3,2,3,3,2,3,2,2,3,3,2,0,9,4,4,3,3,5,3,3,3,3,3,3,2,2,3,3,3,82,
-9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,0,0,0,0,0,0,0,0,0,0,0,0,9,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,9,0,0,0,0,0,0,0,0,0,0,0,0,0,9,9,82,
-4,5,5,5,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,82,
-4,5,5,5,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,9,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,9,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,82,
-4,5,5,5,0,5,5,5,6,5,5,5,5,7,6,5,4,5,4,5,5,0,9,5,5,5,5,5,5,5,5,5,5,5,3,5,5,0,9,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,4,5,5,5,5,5,5,5,6,82,
-4,5,5,4,0,5,5,7,5,5,5,5,5,6,6,5,5,5,5,5,4,0,9,5,5,5,5,5,5,5,5,5,5,5,5,5,3,0,9,5,5,6,6,5,5,5,5,6,5,5,5,5,5,5,5,4,5,5,5,5,5,4,4,82,
-4,5,3,4,0,5,5,6,6,4,5,5,4,4,4,4,4,5,5,5,4,0,9,5,5,5,5,5,5,5,5,5,3,5,3,3,5,0,9,5,5,6,6,5,5,5,6,6,5,5,5,5,4,5,5,5,5,4,4,3,5,5,4,82,
-4,5,5,4,0,5,5,5,4,4,4,5,5,4,4,4,4,5,5,4,4,0,9,5,5,6,6,5,5,5,5,5,5,3,5,5,5,0,9,5,5,5,6,5,5,5,4,4,5,5,5,5,4,4,4,5,5,4,4,5,5,4,4,82,
-4,5,5,3,0,5,4,5,5,4,4,5,4,4,4,4,5,4,4,5,4,0,9,5,5,7,6,6,5,4,4,5,5,5,5,5,3,0,9,5,5,5,5,6,6,5,4,4,4,5,4,5,3,4,5,5,4,3,5,5,3,3,4,82,
-4,5,4,4,0,5,4,5,5,5,5,5,4,4,5,5,5,5,3,3,3,0,9,5,5,7,7,6,5,4,4,5,5,5,3,3,2,0,9,5,5,5,5,6,6,6,5,4,4,5,5,4,3,3,3,4,4,4,5,5,4,3,4,82,
-4,5,3,2,0,5,5,5,5,5,5,5,5,4,5,5,5,5,4,3,3,0,9,5,5,5,5,5,5,5,5,4,5,4,3,3,2,0,9,5,5,5,5,5,6,6,5,5,5,5,5,4,3,3,3,3,5,5,3,2,2,3,3,82,
-4,5,3,3,0,5,4,4,5,5,5,5,5,3,3,5,5,5,4,3,2,0,9,5,5,6,7,5,5,5,5,5,5,3,3,3,2,0,9,5,5,5,5,5,3,5,5,5,5,5,5,5,4,3,4,3,5,5,5,3,3,3,3,82,
-4,5,4,2,0,5,4,4,4,5,5,5,5,3,4,4,3,4,3,3,3,0,9,5,5,7,6,6,5,5,5,3,3,3,3,2,2,0,9,5,5,6,5,5,5,5,5,5,5,5,5,5,5,4,3,3,3,5,5,3,3,3,3,82,
-4,5,4,2,0,5,5,4,4,5,5,5,5,3,4,4,4,3,3,3,3,0,9,5,5,5,6,6,5,3,3,3,3,3,3,3,3,0,9,5,5,5,5,3,4,5,5,5,5,5,5,5,5,3,3,4,3,3,2,3,3,3,3,82,
-4,5,5,3,0,5,4,5,5,4,3,3,4,4,3,4,4,3,3,2,2,0,9,5,5,5,5,5,5,5,5,3,3,3,3,3,3,0,9,5,5,4,3,3,3,4,5,3,3,5,5,5,5,4,4,4,2,3,2,2,2,3,3,82,
-4,5,5,5,0,5,4,5,3,4,3,3,4,4,4,3,3,3,3,2,3,0,9,5,5,5,3,5,5,5,5,5,3,3,3,3,3,0,9,5,5,4,3,3,3,3,5,3,3,3,5,5,3,2,3,2,3,3,3,2,2,3,3,82,
-4,5,4,5,0,5,5,5,5,3,4,3,3,4,3,3,3,2,2,2,3,0,9,5,5,5,5,3,3,3,5,5,3,3,3,3,3,0,9,5,5,5,3,3,3,3,3,4,3,4,5,5,3,2,2,2,2,3,3,2,2,2,3,82,
-4,5,3,3,0,5,5,5,3,3,3,5,3,3,3,3,2,2,2,3,2,0,9,5,3,5,3,3,4,4,3,3,3,3,3,2,2,0,9,5,5,5,3,3,3,3,3,4,3,3,2,3,3,4,4,3,2,2,3,2,2,2,3,82,
-4,5,4,3,0,5,5,5,4,3,3,3,2,3,3,3,2,3,3,3,2,0,9,5,5,5,3,3,4,4,4,2,3,3,2,2,2,0,9,5,4,4,5,3,3,3,3,3,3,2,2,2,3,4,4,4,3,2,2,2,3,3,3,82,
-4,5,5,3,0,5,5,4,5,3,3,3,2,3,2,2,2,2,2,2,2,0,9,5,5,5,5,3,3,4,4,3,2,3,2,2,2,0,9,5,4,3,5,4,4,3,3,3,3,3,2,2,3,3,4,4,3,2,2,2,3,3,3,82,
-4,5,5,3,0,5,5,5,3,3,2,2,3,2,2,2,2,2,2,2,2,0,9,5,5,5,3,5,3,3,2,2,2,2,3,2,2,0,9,5,3,4,5,3,3,2,3,3,3,3,2,3,2,3,3,3,3,2,2,2,3,3,3,82,
-4,5,5,3,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,5,5,5,3,3,2,3,3,3,2,2,3,2,2,0,9,5,5,3,4,3,3,3,3,2,2,3,3,2,2,2,3,3,3,3,2,2,2,3,3,82,
-4,5,4,3,0,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,5,3,5,5,3,2,3,3,3,2,3,3,2,2,0,9,5,4,4,4,3,3,3,2,2,2,3,3,2,2,2,3,2,2,2,2,2,2,2,3,82,
-4,5,4,2,0,9,5,5,5,5,5,5,5,5,5,5,4,4,4,4,4,0,9,4,5,3,2,2,2,2,3,3,2,3,2,2,2,0,9,5,5,4,3,4,3,3,2,2,2,2,3,2,2,2,2,2,2,2,2,2,2,2,3,82,
-4,5,5,3,0,9,5,4,4,5,5,3,4,5,3,5,5,4,4,3,3,0,9,5,2,2,2,2,3,2,2,2,2,2,2,2,2,0,9,5,3,3,3,3,3,3,2,2,2,2,3,2,2,2,3,2,2,2,2,2,2,3,3,82,
-4,5,5,4,0,9,5,4,4,4,4,4,4,4,4,5,4,3,2,2,3,0,9,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,9,82,
-4,5,5,4,0,9,5,4,4,3,3,4,4,4,5,4,5,3,2,3,2,0,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,82,
-4,5,5,3,0,9,4,4,3,3,5,3,3,3,2,5,4,3,2,2,2,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,4,0,9,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,82,
-4,5,4,3,0,9,4,3,3,2,3,2,3,3,2,2,3,3,3,2,2,0,5,6,6,6,5,6,6,6,5,5,5,5,6,6,6,5,5,5,6,5,6,5,5,3,0,9,5,5,5,5,4,5,5,5,5,5,5,5,5,5,4,82,
-4,5,3,3,0,9,3,3,3,2,2,2,3,3,2,3,3,2,2,2,2,0,5,5,5,6,5,5,6,6,6,5,6,6,5,5,5,5,5,5,5,5,5,4,3,3,0,9,5,5,5,5,5,5,5,4,5,5,5,5,5,5,4,82,
-9,9,0,0,0,9,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,6,6,6,6,5,5,4,4,4,4,5,5,4,3,3,5,5,5,5,3,3,3,2,0,9,5,5,6,6,4,4,4,5,5,4,4,5,4,3,3,82,
-9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,0,5,5,6,6,5,5,5,4,4,5,5,4,4,3,4,3,3,5,5,4,3,3,3,2,0,9,5,5,6,6,6,4,4,4,4,5,5,5,5,4,3,82,
-3,5,5,5,5,5,5,5,5,5,5,5,5,5,0,9,5,5,5,5,5,0,5,5,5,5,4,5,4,5,4,5,5,4,2,4,4,3,2,3,4,4,2,2,2,2,0,9,5,5,5,6,6,4,4,4,5,5,5,5,3,5,3,82,
-3,5,5,5,5,5,4,4,5,3,3,5,3,3,0,9,5,5,5,4,2,0,5,5,4,4,5,4,3,5,5,5,4,4,3,3,3,3,3,3,2,2,2,3,2,3,0,9,5,5,5,5,5,5,5,5,5,5,5,3,3,3,3,82,
-3,5,5,5,5,5,4,4,5,3,5,3,3,3,0,9,5,4,5,3,3,0,5,4,4,3,3,3,3,2,2,3,3,2,3,2,3,3,2,2,2,2,2,2,2,2,0,9,5,5,5,5,5,5,3,3,4,5,5,4,3,3,3,82,
-3,5,4,5,5,5,5,5,4,4,5,3,3,3,0,9,5,3,3,2,2,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,5,5,4,4,5,3,3,3,3,4,4,3,3,3,3,82,
-3,5,5,3,5,5,3,3,5,5,3,3,3,2,0,9,0,0,0,0,0,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,5,4,5,4,5,3,3,3,3,3,3,3,3,3,3,82,
-3,5,5,4,5,3,4,4,5,5,4,3,3,2,0,9,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,4,4,4,4,4,4,9,5,5,5,5,3,3,3,3,4,4,3,3,3,3,3,82,
-3,5,5,5,5,3,4,4,4,4,4,3,3,2,0,9,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,4,4,5,5,5,4,4,5,4,0,4,4,3,3,3,3,9,5,5,5,4,3,3,2,3,4,4,3,3,3,3,3,82,
-3,5,4,5,3,3,3,4,4,2,2,3,3,2,0,9,5,5,5,5,5,5,5,4,4,5,5,5,5,5,4,4,4,3,5,5,5,4,4,4,0,4,3,3,3,3,2,9,5,5,4,3,3,2,2,2,2,3,3,2,2,3,3,82,
-3,5,3,2,3,2,3,3,2,2,2,2,2,2,0,9,5,5,5,5,5,5,4,4,4,5,5,5,5,5,4,4,3,3,4,4,5,4,4,3,0,4,3,3,2,2,3,9,5,3,3,3,2,3,3,2,2,2,2,2,3,3,3,82,
-9,9,0,0,0,0,0,0,0,0,0,0,0,0,0,9,5,5,5,5,5,4,4,4,4,5,5,5,5,5,3,4,3,3,4,4,3,3,3,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,9,
+// Colors of all levels in rgb233, texels are indices into the palette packed in bluestone_index_bits each
+constexpr auto bluestone_index_bits = 4;
+
+constexpr uint8_t bluestone_palette[13] = {
+0,1,2,3,4,5,6,7,9,10,11,82,87,
+
+};
+
+// Palette indices of the 64x64 texels followed by prefiltered mip levels 1 to 6 (32x32 down to 1x1),
+// box-filtered from the source texture
+// Levels are transposed (stored column by column) and packed least significant bit first, with a byte of padding at the end
+
+constexpr uint8_t bluestone_texels[2732] = {
+136,0,0,0,0,0,0,0,85,85,85,85,85,85,85,68,68,51,51,51,128,136,136,136,136,136,136,136,136,136,136,184,83,85,85,85,85,68,68,4,85,85,84,84,85,68,68,68,84,68,68,68,128,84,85,85,85,85,85,85,85,85,85,180,
+83,69,68,84,68,67,67,3,85,68,68,67,68,83,68,68,69,68,51,68,128,85,85,85,85,85,85,85,85,85,69,180,83,53,53,68,67,68,52,4,69,84,69,68,52,68,85,52,68,52,51,52,128,85,85,85,84,69,85,85,85,52,52,180,
+83,68,83,85,68,53,51,3,85,84,85,52,69,69,85,69,67,51,51,51,128,85,85,69,85,68,85,85,85,52,52,179,83,69,102,85,85,52,51,3,85,69,101,69,84,85,84,69,51,51,51,51,32,85,102,69,85,85,87,85,68,68,51,179,
+83,67,102,85,53,84,52,3,85,69,51,52,84,85,69,51,51,51,51,51,32,85,102,85,69,117,124,53,68,53,52,179,83,69,52,85,52,67,52,3,85,52,67,67,52,85,53,51,51,51,35,50,48,85,85,85,84,85,87,52,53,83,50,179,
+83,53,51,69,52,52,35,3,69,51,52,67,52,52,51,51,35,34,50,34,48,85,69,84,69,85,84,68,51,50,51,179,83,52,51,52,83,53,35,3,85,52,52,52,67,51,51,50,35,34,35,34,64,85,69,68,85,68,52,84,69,51,50,179,
+83,83,51,53,84,37,51,2,85,68,51,51,67,52,34,50,35,50,34,34,64,85,85,68,53,83,85,67,85,68,51,179,83,68,84,85,51,51,51,2,53,51,52,51,67,52,51,50,51,34,34,35,64,85,84,85,53,50,84,67,84,36,51,179,
+83,84,68,85,35,51,51,2,85,51,50,51,50,51,50,51,51,34,34,34,48,85,85,85,83,51,36,50,67,52,51,179,83,51,68,68,52,35,51,2,69,52,51,50,34,34,34,34,34,35,35,34,48,85,69,84,69,85,35,50,51,35,51,179,
+83,68,67,68,52,50,50,2,53,52,51,34,50,35,34,35,34,34,34,34,48,85,85,84,85,85,52,51,50,35,51,179,83,68,67,67,52,51,35,2,0,0,0,0,0,0,0,0,0,0,0,0,128,8,0,0,0,0,0,0,0,0,128,184,
+83,51,50,51,51,35,35,2,85,85,85,85,85,4,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,184,83,53,51,51,51,35,50,2,85,85,69,84,53,3,88,85,85,85,85,85,85,85,5,88,85,85,85,85,85,85,85,180,
+83,51,51,50,51,35,34,2,69,85,84,68,51,2,88,85,85,85,68,85,85,85,4,88,83,85,85,85,85,85,69,180,83,51,34,35,51,35,50,2,85,85,51,67,52,2,88,84,68,85,68,68,51,68,4,88,85,83,85,85,85,53,52,179,
+83,51,34,35,34,50,35,2,85,68,52,51,52,2,88,69,84,83,82,69,51,35,2,88,84,85,83,68,51,51,51,179,83,50,35,35,34,34,34,2,52,67,52,35,35,2,88,68,67,35,36,36,50,51,2,88,68,51,53,68,51,51,51,179,
+136,0,0,0,0,0,0,0,84,51,51,50,50,3,88,68,35,35,51,50,34,51,2,72,52,83,51,51,51,34,51,179,136,136,136,136,136,136,136,136,0,0,0,0,0,0,136,0,0,0,0,0,0,0,0,136,0,0,0,0,0,0,128,184,
+84,85,80,85,85,85,85,85,85,85,5,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,184,84,85,80,85,85,85,85,85,85,85,5,88,85,85,85,85,85,85,5,88,85,85,85,85,85,85,85,85,85,85,85,181,
+84,85,80,85,86,85,117,86,84,84,5,88,85,85,85,85,85,83,5,88,85,85,85,85,85,85,85,84,85,85,85,182,84,69,80,117,85,85,101,86,85,85,4,88,85,85,85,85,85,85,3,88,101,86,85,101,85,85,85,69,85,85,69,180,
+84,67,80,101,70,85,68,68,84,85,4,88,85,85,85,85,83,51,5,88,101,86,85,102,85,85,84,85,69,52,85,180,84,69,80,85,68,84,69,68,84,69,4,88,101,86,85,85,53,85,5,88,85,86,85,68,85,85,68,84,69,84,69,180,
+84,53,80,84,69,84,68,68,69,84,4,88,117,102,69,84,85,85,3,88,85,101,86,68,84,84,67,85,52,85,51,180,84,68,80,84,85,85,68,85,85,51,3,88,117,103,69,84,85,51,2,88,85,101,102,69,84,69,51,67,68,85,52,180,
+84,35,80,85,85,85,69,85,85,52,3,88,85,85,85,69,69,51,2,88,85,85,102,85,85,69,51,51,85,35,50,179,84,51,80,68,85,85,53,83,85,52,2,88,101,87,85,85,53,51,2,88,85,85,83,85,85,85,52,52,85,53,51,179,
+84,36,80,68,84,85,53,68,67,51,3,88,117,102,85,53,51,35,2,88,101,85,85,85,85,85,69,51,83,53,51,179,84,36,80,69,84,85,53,68,52,51,3,88,85,102,53,51,51,51,3,88,85,53,84,85,85,85,53,67,51,50,51,179,
+84,53,80,84,69,51,68,67,52,35,2,88,85,85,85,53,51,51,3,88,69,51,67,53,83,85,69,68,50,34,50,179,84,85,80,84,67,51,68,52,51,35,3,88,85,83,85,85,51,51,3,88,69,51,51,53,51,85,35,35,51,35,50,179,
+84,84,80,85,53,52,67,51,35,34,3,88,85,53,51,85,51,51,3,88,85,51,51,67,67,85,35,34,50,35,34,179,84,51,80,85,51,83,51,51,34,50,2,88,83,51,68,51,51,35,2,88,85,51,51,67,51,50,67,52,34,35,34,179,
+84,52,80,85,52,51,50,51,50,51,2,88,85,51,68,36,51,34,2,88,68,53,51,51,35,34,67,68,35,34,51,179,84,53,80,69,53,51,50,34,34,34,2,88,85,53,67,52,50,34,2,88,52,69,52,51,51,34,51,68,35,34,51,179,
+84,53,80,85,51,34,35,34,34,34,2,88,85,83,51,34,34,35,2,88,67,53,35,51,51,50,50,51,35,34,51,179,84,53,128,0,0,0,0,0,0,0,0,88,85,51,50,51,34,35,2,88,53,52,51,35,50,35,34,51,51,34,50,179,
+84,52,128,136,136,136,136,136,136,136,136,88,83,53,50,51,50,35,2,88,68,52,51,34,50,35,34,35,34,34,34,179,84,36,128,85,85,85,85,85,68,68,4,72,53,34,34,51,50,34,2,88,69,67,51,34,34,35,34,34,34,34,34,179,
+84,53,128,69,84,53,84,83,69,52,3,88,34,34,35,34,34,34,2,88,51,51,51,34,34,35,34,35,34,34,50,179,84,69,128,69,68,68,68,84,52,34,3,136,0,0,0,0,0,0,0,136,0,0,0,0,0,0,0,0,0,0,128,184,
+84,69,128,69,52,67,68,69,53,50,2,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,184,84,53,128,68,51,53,51,82,52,34,2,85,85,85,85,85,85,85,85,85,85,85,69,128,85,85,85,85,85,85,85,181,
+84,52,128,52,35,35,51,34,51,35,2,101,102,101,102,85,85,102,86,85,86,86,53,128,85,85,84,85,85,85,85,180,84,51,128,51,35,34,51,50,35,34,2,85,101,85,102,86,102,85,85,85,85,69,51,128,85,85,85,69,85,85,85,180,
+136,0,128,8,0,0,0,0,0,0,0,101,102,86,69,68,84,69,51,85,85,51,35,128,85,102,68,84,69,84,52,179,136,136,136,136,136,136,136,136,136,136,8,85,102,85,69,84,69,52,52,83,69,51,35,128,85,102,70,68,84,85,69,179,
+83,85,85,85,85,85,85,128,85,85,5,85,85,84,84,84,69,66,52,50,68,34,34,128,85,101,70,68,85,85,83,179,83,85,85,68,53,83,51,128,85,69,2,85,68,69,83,85,68,51,51,51,34,50,50,128,85,85,85,85,85,53,51,179,
+83,85,85,68,53,53,51,128,69,53,3,69,52,51,35,50,35,35,51,34,34,34,34,128,85,85,85,51,84,69,51,179,83,84,85,85,68,53,51,128,53,35,2,8,0,0,0,0,0,0,0,0,0,0,0,128,85,68,53,51,67,52,51,179,
+83,53,85,51,85,51,35,128,0,0,128,136,136,136,136,136,136,136,136,136,136,136,136,136,69,69,53,51,51,51,51,179,83,69,53,68,85,52,35,128,85,85,85,85,85,85,85,85,85,85,85,85,64,68,68,132,85,85,51,51,68,51,51,179,
+83,85,53,68,68,52,35,128,85,85,85,85,85,85,85,69,84,85,68,69,64,52,51,131,85,69,51,50,68,51,51,179,83,84,51,67,36,50,35,128,85,85,85,69,84,85,85,68,52,85,69,68,64,51,51,130,85,52,35,34,50,35,50,179,
+83,35,35,51,34,34,34,128,85,85,85,68,84,85,85,68,51,68,69,52,64,51,34,131,53,51,50,35,34,34,51,179,136,0,0,0,0,0,0,128,85,85,69,68,84,85,85,67,51,68,51,67,0,0,0,0,0,0,0,0,0,0,0,136,
+34,34,34,18,85,68,69,68,52,51,32,51,51,51,51,147,68,68,51,19,68,52,67,52,52,51,80,85,68,85,69,164,68,85,52,19,69,69,68,68,51,51,80,69,69,85,52,147,68,84,67,19,69,51,84,52,51,34,81,85,84,54,68,147,
+52,67,51,18,52,51,51,35,34,34,81,68,68,68,35,146,68,67,51,19,52,51,51,34,34,34,82,68,52,52,52,147,52,68,35,19,52,34,34,34,34,34,81,68,68,34,51,147,68,51,35,18,18,17,17,17,17,17,33,34,34,17,17,145,
+52,50,35,18,85,68,20,50,51,51,51,33,51,51,51,147,52,34,35,18,84,51,19,67,84,68,68,50,68,85,69,148,36,34,34,18,52,35,19,67,52,51,34,49,68,68,51,147,8,0,0,0,18,17,1,34,17,17,17,16,33,17,17,145,
+84,82,85,85,85,34,51,51,51,33,51,51,51,51,51,147,68,82,85,85,68,50,85,85,69,50,85,85,85,69,85,164,68,82,68,68,68,50,85,85,68,50,85,85,85,68,68,164,68,66,68,68,52,49,102,68,69,49,85,69,68,67,83,163,
+36,66,85,68,53,49,85,69,52,49,85,85,69,51,53,146,52,66,84,68,51,49,101,52,35,49,69,84,85,52,51,147,68,66,52,52,35,49,69,69,51,49,52,67,83,51,34,146,52,82,51,51,34,49,52,67,35,49,53,51,51,35,34,146,
+52,66,51,34,34,49,53,51,34,49,67,51,34,67,34,147,68,33,17,17,17,48,53,34,34,49,51,34,34,50,34,146,52,48,51,51,34,33,52,50,34,49,52,35,34,34,34,146,68,64,68,68,36,33,17,17,17,32,17,17,17,17,17,145,
+68,64,51,67,35,49,51,51,51,51,51,2,51,51,51,147,52,48,34,35,34,81,85,86,85,85,85,3,85,68,85,165,8,0,0,0,0,80,86,68,68,67,52,2,101,68,68,148,84,69,68,4,69,81,68,68,52,35,35,2,85,69,69,147,
+68,69,68,3,52,33,17,17,17,17,17,1,69,52,68,147,68,52,53,2,34,50,51,51,51,51,33,18,68,51,51,147,68,51,51,2,85,69,84,69,84,68,50,19,69,34,35,146,18,17,17,1,85,68,84,53,67,51,17,17,18,17,17,129,
+51,35,68,68,51,66,67,51,68,36,68,68,35,83,84,36,51,35,52,35,34,67,68,35,51,19,34,17,17,50,35,34,35,18,68,50,51,35,67,51,18,17,34,33,34,18,35,34,52,85,36,68,35,68,52,52,52,68,36,69,36,85,68,52,
+51,68,35,69,35,68,52,35,52,51,34,68,34,51,51,34,36,18,17,52,34,35,50,34,36,51,18,18,17,18,17,33,36,50,34,68,68,20,52,52,34,18,50,69,51,19,69,52,68,20,35,34,34,17,52,35,35,18,69,68,52,17,19,34,
+35,68,51,52,35,35,49,35,18,35,35,35,68,67,67,52,67,66,66,35,35,34,33,34,34,66,35,52,35,51,19,35,51,51,51,51,51,34,50,50,51,51,3,0,
+
+};
+
+// Runs of equal texels in every texture column (row of the transposed data)
+// Column i has the runs [bluestone_run_offsets[i], bluestone_run_offsets[i + 1]) in bluestone_run_ends
+// Each entry is the exclusive end texel of a run, so a column's last run always ends at 64
+
+constexpr uint16_t bluestone_run_offsets[64 + 1] = {
+0,8,26,53,90,125,156,195,231,268,307,343,378,410,442,475,489,503,522,550,585,622,661,693,701,708,719,744,769,802,832,873,908,938,970,1001,1030,1063,1098,1131,1166,1200,1235,1269,1296,1323,1353,1385,1404,1423,1444,1479,1507,1532,1556,1587,1617,1650,1673,1692,1713,1739,1770,1802,1816,
+
+};
+
+constexpr uint8_t bluestone_run_ends[1816] = {
+2,16,30,34,40,41,63,64,
+1,10,15,16,20,21,22,23,26,33,34,40,41,42,43,62,63,64,
+1,3,7,8,10,11,12,13,14,15,16,18,22,23,26,27,28,32,33,36,38,40,41,42,61,63,64,
+1,3,4,5,6,8,9,13,14,15,16,17,19,21,25,26,28,30,31,32,35,38,39,40,41,42,48,49,51,52,58,59,60,61,62,63,64,
+1,2,4,5,8,10,11,15,16,18,19,22,23,24,25,26,27,28,31,32,33,34,40,41,42,47,48,50,52,58,59,60,61,63,64,
+1,3,4,6,10,11,15,16,19,20,21,22,23,25,28,29,31,32,40,41,42,44,46,47,48,52,53,56,60,63,64,
+1,2,3,4,6,9,10,11,12,13,15,16,19,20,22,23,24,25,29,30,40,41,42,44,46,49,50,51,52,53,54,55,56,58,59,60,61,63,64,
+1,3,5,6,8,9,11,13,15,16,18,19,21,22,23,25,26,29,37,39,40,41,42,48,49,52,53,54,55,56,57,59,60,61,63,64,
+1,3,6,7,9,10,11,13,14,15,16,17,18,20,21,23,25,26,27,33,37,38,40,41,42,45,47,49,50,52,53,54,56,58,59,63,64,
+1,2,3,6,7,9,11,13,14,15,16,18,19,20,21,22,23,25,26,30,31,33,36,37,40,41,42,45,48,50,53,54,55,57,58,60,61,63,64,
+1,2,3,4,6,7,8,9,11,12,14,15,16,18,20,25,27,28,31,33,35,36,40,41,42,46,48,49,51,54,55,56,58,60,63,64,
+1,2,5,8,14,15,16,17,20,21,25,27,30,31,34,38,39,40,41,42,44,45,49,50,51,52,53,54,55,57,58,59,60,63,64,
+1,2,3,4,6,8,9,10,14,15,16,18,20,21,24,25,28,29,34,40,41,42,48,49,50,52,53,55,57,59,63,64,
+1,2,4,9,11,12,14,15,16,17,19,22,23,24,34,35,36,37,40,41,42,45,47,49,50,52,53,55,59,60,63,64,
+1,2,4,5,9,10,11,12,13,14,15,16,17,18,19,22,25,27,30,31,40,41,42,46,47,52,53,56,57,59,60,63,64,
+1,2,4,5,6,7,9,13,15,41,43,61,63,64,
+1,2,4,5,11,12,13,15,16,26,27,28,63,64,
+1,3,11,13,14,15,16,21,23,25,27,28,29,45,46,47,62,63,64,
+1,2,6,7,11,15,16,17,18,20,21,22,24,26,27,28,29,36,38,44,45,46,47,48,49,61,63,64,
+1,2,4,6,7,8,11,13,14,15,16,20,23,25,26,27,28,29,30,31,32,34,36,40,42,45,46,47,50,51,59,60,61,63,64,
+1,2,4,6,7,11,13,15,16,18,21,24,25,26,27,28,29,31,33,34,35,36,37,39,40,43,45,46,47,48,49,52,53,54,56,63,64,
+1,2,3,5,6,7,15,16,17,19,21,23,24,25,27,28,29,30,32,33,34,35,36,37,38,39,41,44,45,46,47,48,50,52,53,54,56,63,64,
+2,16,17,18,22,23,24,25,27,28,29,30,32,33,34,35,36,38,39,40,42,44,45,46,47,49,51,52,58,60,63,64,
+16,28,30,46,48,61,63,64,
+1,4,5,21,22,63,64,
+1,4,5,21,22,23,37,38,39,63,64,
+1,4,5,8,9,13,14,15,16,17,18,19,21,22,23,34,35,37,38,39,54,55,62,63,64,
+1,3,4,5,7,8,13,15,20,21,22,23,36,37,38,39,41,43,47,48,55,56,61,63,64,
+1,2,3,4,5,7,9,10,12,17,20,21,22,23,32,33,34,36,37,38,39,41,43,46,48,52,53,57,59,60,62,63,64,
+1,3,4,5,8,11,13,17,19,21,22,23,25,27,33,34,37,38,39,42,43,46,48,52,55,57,59,61,63,64,
+1,3,4,5,6,7,9,11,12,16,17,19,20,21,22,23,25,26,28,29,31,36,37,38,39,43,45,46,49,50,51,52,53,54,56,57,58,60,62,63,64,
+1,2,4,5,6,7,12,14,18,21,22,23,25,27,28,29,31,34,36,37,38,39,43,46,47,49,51,52,55,58,60,61,62,63,64,
+1,2,3,4,5,13,14,18,19,21,22,23,31,32,33,34,36,37,38,39,44,46,51,52,56,58,59,61,63,64,
+1,2,4,5,6,8,13,15,18,19,20,21,22,23,25,26,27,33,36,37,38,39,44,45,52,53,54,55,56,59,63,64,
+1,2,3,4,5,6,9,13,14,16,17,18,21,22,23,25,26,28,31,35,37,38,39,41,42,53,54,57,59,63,64,
+1,2,3,4,5,7,9,13,14,17,21,22,23,26,28,29,37,38,39,43,44,45,53,55,56,58,59,63,64,
+1,3,4,5,6,7,9,10,12,14,15,17,19,21,22,23,31,37,38,39,41,42,45,46,47,49,53,56,57,58,61,63,64,
+1,4,5,6,7,8,9,10,12,15,19,20,21,22,23,26,27,32,37,38,39,41,42,46,47,50,52,53,54,55,56,59,61,63,64,
+1,2,3,4,5,9,10,11,13,14,17,20,21,22,23,27,30,32,37,38,39,42,47,48,49,50,52,53,57,59,62,63,64,
+1,2,4,5,8,11,12,16,19,20,21,22,23,24,25,26,28,30,35,37,38,39,42,47,48,50,51,53,55,56,58,59,62,63,64,
+1,2,3,4,5,8,9,12,13,16,17,20,21,22,23,26,28,31,32,34,37,38,39,40,42,43,49,52,53,56,57,60,63,64,
+1,3,4,5,7,8,9,12,13,14,21,22,23,27,29,31,32,33,34,37,38,39,40,41,42,43,45,50,52,54,56,57,60,63,64,
+1,3,4,5,8,10,12,13,21,22,23,26,27,28,30,34,35,37,38,39,40,41,42,43,45,46,50,51,52,53,57,60,63,64,
+1,3,4,5,6,22,23,26,28,29,32,34,35,37,38,39,41,42,43,47,49,51,54,58,61,63,64,
+1,2,3,4,5,23,24,25,27,28,29,32,33,35,37,38,39,40,43,46,49,51,54,55,62,63,64,
+1,2,3,4,5,6,16,21,22,23,24,25,26,30,32,33,34,37,38,39,41,42,43,44,46,50,51,62,63,64,
+1,3,4,5,6,7,9,11,12,13,14,15,17,19,21,22,23,24,28,29,37,38,39,40,46,50,51,54,55,61,63,64,
+1,3,4,5,6,7,15,16,17,18,20,21,22,24,38,40,61,63,64,
+1,3,4,5,6,7,9,11,14,15,16,17,18,19,20,21,22,63,64,
+1,3,4,5,6,8,10,11,14,15,16,17,18,21,22,45,46,47,48,63,64,
+1,2,3,4,5,6,7,9,10,11,12,14,16,19,21,22,23,26,27,30,34,37,40,41,42,43,45,46,47,48,52,53,62,63,64,
+1,2,4,5,6,9,12,14,15,17,21,22,25,26,28,31,32,34,43,44,46,47,48,55,56,62,63,64,
+2,5,7,22,23,27,29,33,35,36,38,42,45,46,47,48,50,52,55,57,59,60,61,63,64,
+21,22,24,26,29,31,33,35,36,37,39,41,42,45,46,47,48,50,53,57,61,62,63,64,
+1,14,15,16,21,22,26,27,28,29,30,31,33,34,35,37,38,39,40,42,46,47,48,51,53,56,60,61,62,63,64,
+1,6,8,9,11,12,14,15,16,19,20,21,22,24,26,27,28,29,32,34,40,43,44,45,46,47,48,59,63,64,
+1,6,8,9,10,11,14,15,16,17,18,19,21,22,23,25,29,31,33,34,35,36,38,46,47,48,54,56,57,59,60,63,64,
+1,2,3,8,10,11,14,15,16,17,19,21,22,23,47,48,50,52,53,57,59,63,64,
+1,3,4,6,8,10,13,14,15,16,21,48,49,50,51,52,53,63,64,
+1,3,4,5,6,8,10,11,13,14,15,16,40,41,47,48,52,56,58,63,64,
+1,5,6,11,13,14,15,16,31,33,36,38,39,40,41,43,47,48,51,52,54,55,56,58,63,64,
+1,2,3,4,7,9,11,13,14,15,16,23,25,30,33,34,37,40,41,42,46,47,48,50,51,53,57,59,61,63,64,
+1,2,3,4,5,6,8,14,15,16,22,25,30,32,34,36,37,39,40,41,42,44,46,47,48,49,52,53,55,60,63,64,
+2,15,16,21,25,30,31,32,34,36,39,40,62,64,
 
 };
 
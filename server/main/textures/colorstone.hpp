@@ -1,78 +1,146 @@
 
 #pragma once
 
-// Generated by generate_texture.py on 2022-09-07T14:50:32.520322
+// Generated by generate_texture.py on 2026-10-16T14:06:49.986454
 
 #include <cstdint>
 
 namespace textures
 {
 
-constexpr uint8_t colorstone[64 * 64] = {
-91,91,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,91,91,82,72,81,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,82,91,91,9,9,9,9,82,91,91,91,91,81,81,81,81,81,81,81,81,81,81,81,81,
-91,91,91,91,82,82,82,82,82,82,82,82,82,82,82,82,9,91,91,82,72,81,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,82,91,91,91,82,9,9,82,91,91,91,91,82,81,81,72,81,81,81,81,81,81,81,81,81,
-91,91,91,91,91,82,82,82,82,82,82,82,82,82,82,9,91,91,82,72,81,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,82,91,91,164,164,164,82,82,91,91,91,91,91,81,81,81,81,81,72,72,81,81,81,81,81,81,
-72,82,91,91,91,91,82,82,82,82,82,82,82,82,9,91,91,82,72,81,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,8,82,91,91,164,164,164,164,91,91,91,91,91,91,164,81,81,81,81,81,72,72,81,81,81,81,81,81,
-72,72,82,91,91,91,91,82,82,82,82,82,82,9,91,91,91,82,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,8,8,82,91,91,91,164,164,91,91,82,82,82,82,91,91,164,82,81,81,81,81,81,81,81,81,81,81,81,72,
-81,72,72,82,91,91,91,91,82,82,82,82,9,91,91,91,91,91,82,72,72,72,72,72,72,72,72,72,72,72,72,8,8,8,72,82,91,91,91,91,91,91,82,82,82,82,82,82,82,91,164,164,81,81,81,81,81,81,81,81,81,81,72,72,
-81,81,72,72,72,72,82,91,91,91,91,91,91,91,91,91,91,91,91,82,72,72,72,72,72,72,8,8,8,8,72,72,72,72,82,91,91,91,91,91,91,82,82,82,82,82,82,82,82,82,91,164,82,81,81,81,81,81,72,72,72,72,72,72,
-81,81,81,81,81,72,72,82,91,91,91,91,91,91,82,82,82,82,91,91,91,82,72,72,72,72,72,72,72,72,72,72,72,82,91,91,91,91,91,91,82,82,82,82,82,82,82,82,82,82,82,91,91,81,81,72,72,72,72,72,72,72,72,82,
-81,81,81,81,81,81,72,72,82,91,91,91,91,82,82,82,82,82,82,82,91,91,91,91,82,72,72,72,72,72,72,72,82,91,91,91,91,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,91,82,81,81,81,81,72,72,72,72,82,91,
-81,81,81,81,81,81,81,72,72,82,91,91,82,82,82,82,82,82,82,82,82,91,91,91,91,91,82,82,82,82,82,82,91,91,91,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,82,91,72,72,72,72,72,72,72,82,91,91,
-81,81,81,81,81,81,81,81,72,72,82,91,82,82,82,82,82,82,82,82,82,82,82,91,91,91,91,91,91,91,91,91,91,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,82,91,81,81,72,72,72,82,91,82,82,
-81,81,81,81,81,81,81,81,81,72,72,82,82,82,82,82,82,82,82,82,82,82,82,82,91,91,91,164,91,91,164,91,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,82,81,81,72,72,82,91,82,82,82,
-81,81,81,81,81,81,81,81,81,72,72,82,91,82,82,82,82,82,82,82,82,82,82,82,82,9,91,91,164,91,91,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,82,72,72,82,91,91,82,82,82,
-81,81,81,81,81,72,81,81,81,72,72,82,91,91,82,82,82,82,82,82,82,82,82,82,82,82,9,91,91,91,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,82,82,91,91,91,82,82,82,
-81,81,81,81,81,81,81,81,81,72,72,82,164,164,91,82,82,82,82,82,82,82,82,82,82,82,9,91,91,91,91,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,82,82,91,91,91,91,82,82,
-81,72,81,81,81,81,81,81,72,72,82,82,164,164,164,91,82,91,82,82,82,82,82,82,82,82,9,91,91,81,91,91,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,82,82,91,82,82,82,91,91,82,
-81,81,72,72,81,81,81,81,72,72,82,91,164,164,91,82,91,91,91,91,82,82,9,9,9,9,91,91,81,81,81,91,91,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,82,82,91,82,72,72,72,82,82,91,
-81,81,72,72,81,81,81,72,72,82,91,91,91,91,81,81,81,81,81,91,91,91,91,91,91,91,91,82,81,81,81,81,91,91,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,82,91,82,72,72,72,72,72,72,72,
-81,81,81,81,81,81,81,72,72,91,91,91,91,81,72,72,72,72,72,72,82,91,91,91,91,91,91,81,81,81,81,81,72,91,91,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,82,91,82,72,72,72,72,72,72,72,72,
-81,81,81,81,81,81,72,72,82,91,91,91,81,72,72,81,81,72,72,72,72,72,82,91,91,91,91,81,81,81,81,81,72,91,164,91,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,82,91,82,72,72,72,72,72,72,72,72,72,
-81,81,81,81,81,72,72,72,91,91,91,81,72,72,81,72,72,72,72,72,72,72,72,72,82,91,91,82,81,81,81,72,72,82,91,164,164,91,82,82,82,82,82,82,82,82,82,9,9,9,9,82,82,82,72,81,81,81,81,81,81,81,81,72,
-81,81,81,81,72,72,72,82,91,91,82,81,72,72,72,72,72,72,72,72,72,72,72,72,8,8,82,91,81,81,81,72,72,82,164,164,164,164,91,82,82,82,82,82,82,82,82,82,82,9,82,82,91,82,81,72,72,72,72,72,72,72,72,72,
-72,72,72,72,72,72,82,91,91,91,81,72,72,72,72,72,72,72,72,72,72,72,72,72,72,8,8,82,91,72,72,72,91,91,91,164,164,164,164,164,91,82,82,82,82,82,82,82,9,82,82,91,82,72,72,72,72,72,72,72,72,72,72,72,
-72,72,72,72,72,72,82,91,91,81,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,8,8,82,91,91,91,91,91,91,82,82,82,91,91,164,91,91,82,82,82,82,82,9,82,82,91,82,72,72,72,72,72,72,72,72,72,72,72,72,
-72,72,72,72,72,82,91,91,82,81,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,8,8,82,91,91,91,91,82,82,82,82,82,82,9,82,91,91,91,82,82,82,9,82,82,91,82,72,72,72,72,72,72,72,72,72,72,72,72,72,
-81,81,81,72,72,91,91,91,81,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,8,8,82,91,91,91,82,82,82,82,82,82,82,82,9,9,82,82,82,82,9,82,82,91,82,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
-81,81,72,72,82,91,91,81,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,8,82,82,91,91,82,82,82,82,82,82,82,82,82,9,9,9,82,82,91,91,91,91,82,72,72,72,72,72,72,72,72,72,72,72,72,72,72,82,
-81,81,72,72,91,91,82,81,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,8,8,82,91,91,82,82,82,82,82,82,82,82,82,82,82,9,9,9,91,91,164,164,82,72,72,72,72,72,72,72,72,72,72,72,72,72,72,82,82,
-81,72,72,82,91,91,81,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,8,8,82,82,91,82,82,82,82,82,82,82,82,82,82,82,82,82,9,9,82,82,164,164,72,72,72,72,72,72,72,72,72,72,72,72,72,82,82,91,91,
-72,72,82,91,91,81,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,8,8,82,91,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,9,9,82,91,82,72,72,72,72,72,72,72,72,72,72,72,82,91,91,9,9,
-72,72,82,91,82,81,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,8,8,82,91,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,9,9,82,91,82,72,72,72,72,72,72,72,72,82,82,91,82,9,9,9,
-72,82,91,82,81,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,8,8,8,82,91,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,9,9,82,91,72,72,72,72,72,72,72,82,91,91,9,9,9,9,9,
-82,91,91,81,72,72,72,72,72,72,72,72,72,72,72,72,72,8,8,8,8,8,82,91,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,9,9,9,91,82,72,72,72,72,82,82,91,82,9,9,9,9,9,9,
-91,91,82,81,72,72,72,72,72,72,72,8,8,8,8,8,8,8,72,72,8,8,82,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,9,82,91,82,72,72,82,91,9,9,9,9,9,9,9,9,9,
-91,91,81,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,8,8,82,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,9,82,91,91,91,91,91,9,9,9,9,9,9,9,9,9,9,
-91,91,81,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,8,82,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,9,9,9,9,9,91,91,91,91,9,9,9,9,9,9,9,9,9,9,9,9,
-91,91,81,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,8,72,91,91,82,82,82,82,82,82,82,82,82,82,82,9,9,9,9,9,9,9,9,9,9,9,9,82,82,91,91,91,82,9,9,9,9,9,9,9,9,9,9,9,9,9,
-91,91,81,72,72,72,72,72,8,8,8,8,8,8,8,8,8,8,72,91,91,91,82,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,82,82,91,91,91,91,91,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
-91,91,82,72,72,72,72,72,72,72,72,8,8,8,8,8,8,8,82,81,72,91,82,82,9,82,82,82,82,82,82,82,82,82,82,82,9,9,9,82,82,82,91,91,91,91,91,91,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
-91,91,91,72,72,72,8,8,8,8,8,8,8,8,82,82,82,91,81,81,72,91,82,82,82,9,9,82,82,82,82,82,82,9,9,9,82,82,91,91,91,91,91,91,91,91,91,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
-9,82,91,91,82,8,8,8,8,8,82,82,82,91,91,91,91,81,81,81,72,91,82,82,82,82,82,9,9,9,9,9,9,9,9,91,91,91,91,91,91,82,81,81,72,91,91,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
-9,9,82,91,91,91,91,91,91,91,91,91,91,91,91,91,91,81,81,81,72,91,82,82,82,82,82,82,9,9,9,9,82,82,91,91,91,91,82,81,81,81,81,81,81,72,91,91,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
-9,9,9,82,91,164,173,164,164,164,164,91,164,91,91,91,91,91,82,72,72,91,91,82,82,9,9,9,9,82,82,91,91,91,82,82,81,81,81,81,81,81,81,81,81,81,72,91,91,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
-9,9,9,82,91,173,91,91,91,91,91,91,91,91,91,91,82,82,91,91,91,164,164,91,82,82,82,82,82,91,91,82,81,81,145,145,145,145,145,145,145,145,81,81,81,81,81,72,91,91,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
-9,9,9,82,91,91,82,91,82,82,82,82,82,82,82,82,82,82,82,91,91,164,164,164,91,91,91,91,91,91,91,81,81,81,81,81,81,81,81,81,81,81,145,145,81,81,81,72,91,91,91,9,9,9,9,9,9,9,9,9,9,9,9,9,
-9,9,82,91,91,82,91,82,82,82,82,82,82,82,82,82,82,82,82,82,91,91,164,164,164,91,91,91,91,82,91,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,72,91,91,91,9,9,9,9,9,9,9,9,9,0,0,0,
-9,82,91,91,82,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,91,91,164,164,91,91,82,82,82,91,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,72,91,91,91,9,9,9,9,9,9,9,9,9,9,9,
-82,91,91,82,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,91,91,91,82,82,82,82,82,91,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,72,82,91,91,91,9,9,9,9,9,9,9,9,9,9,
-91,91,82,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,82,91,91,82,82,82,82,82,91,81,81,81,72,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,72,82,91,91,91,9,9,9,9,9,9,9,9,9,
-91,82,91,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,9,82,91,91,82,82,82,82,91,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,82,91,91,91,9,9,9,9,9,9,9,9,
-82,91,82,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,82,9,82,91,91,82,82,82,91,81,81,81,81,81,81,81,81,81,81,81,81,72,81,81,81,81,81,81,72,72,82,91,91,91,91,9,9,9,9,9,9,9,
-91,82,82,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,82,82,9,82,91,91,91,82,91,81,81,81,81,81,81,81,81,81,81,72,72,81,81,81,72,72,81,81,72,82,82,91,164,164,91,91,9,9,9,9,9,9,
-82,82,82,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,82,82,9,9,82,91,91,91,91,81,81,81,81,81,81,81,72,72,72,81,81,81,81,81,72,72,81,72,72,82,91,164,164,91,82,91,91,9,9,9,9,9,
-82,82,82,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,82,82,9,9,82,91,164,91,91,72,72,72,72,72,72,72,72,81,81,81,81,81,72,81,81,81,72,72,82,91,91,91,82,82,82,82,91,91,9,9,9,9,
-82,82,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,82,82,9,9,82,164,164,91,91,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,82,91,91,82,82,82,82,82,82,82,82,91,82,82,82,
-82,82,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,82,82,9,9,82,164,91,91,82,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,82,91,82,82,82,82,82,82,82,82,82,82,82,91,91,91,
-82,82,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,9,82,9,9,82,91,91,91,82,82,82,81,72,72,72,72,72,72,72,72,72,72,72,72,72,72,82,91,91,82,82,82,82,82,82,82,82,82,82,82,82,82,91,
-82,91,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,82,82,9,82,91,91,91,91,82,82,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,82,82,82,82,82,82,82,82,82,82,82,82,82,91,
-82,91,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,9,82,9,82,91,91,91,82,72,72,72,72,72,72,72,72,82,91,91,91,91,9,9,9,9,9,9,9,9,91,82,82,82,82,82,82,82,82,82,82,82,82,91,91,
-82,91,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,82,9,82,91,91,91,82,72,72,72,72,72,72,72,72,72,72,82,91,91,91,9,9,9,9,9,9,9,9,82,82,82,82,82,82,82,82,82,82,82,82,91,81,81,
-82,91,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,9,82,91,91,91,82,72,72,72,72,72,72,72,72,72,72,72,72,82,91,91,9,9,9,9,9,9,9,9,82,82,82,82,82,82,82,82,82,82,82,81,81,81,81,
-91,91,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,9,82,91,91,82,72,81,72,72,72,72,72,72,72,72,72,72,72,72,72,82,91,82,9,9,9,9,9,9,9,82,91,82,82,82,82,82,82,91,81,81,81,81,81,81,
-91,91,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,82,82,91,91,82,72,81,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,82,91,9,9,9,9,9,9,9,82,91,91,91,91,91,91,81,81,81,81,81,81,81,81,
-91,91,91,82,82,82,82,82,82,82,82,82,82,82,82,82,9,82,82,91,91,82,72,81,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,82,91,82,9,9,9,9,9,9,82,91,91,91,91,81,81,81,81,81,81,81,81,81,81,
+// Colors of all levels in rgb233, texels are indices into the palette packed in colorstone_index_bits each
+constexpr auto colorstone_index_bits = 4;
+
+constexpr uint8_t colorstone_palette[13] = {
+0,8,9,17,18,72,73,81,82,91,145,164,173,
+
+};
+
+// Palette indices of the 64x64 texels followed by prefiltered mip levels 1 to 6 (32x32 down to 1x1),
+// box-filtered from the source texture
+// Levels are transposed (stored column by column) and packed least significant bit first, with a byte of padding at the end
+
+constexpr uint8_t colorstone_texels[2732] = {
+153,137,136,136,136,136,136,136,40,153,88,87,85,85,85,85,85,85,85,85,152,41,34,130,153,153,119,119,119,119,119,119,153,153,136,136,136,136,136,136,146,137,117,85,85,85,85,85,85,85,85,133,153,137,34,152,153,137,119,117,119,119,119,119,
+153,153,137,136,136,136,136,40,153,88,87,85,85,85,85,85,85,85,85,152,185,187,136,153,153,121,119,119,85,119,119,119,133,153,153,136,136,136,136,146,137,117,85,85,85,85,85,85,85,85,129,153,187,187,153,153,153,123,119,119,85,119,119,119,
+85,152,153,137,136,136,40,153,137,85,85,85,85,85,85,85,85,17,152,153,187,153,136,136,153,139,119,119,119,119,119,87,87,133,153,153,136,136,146,153,153,88,85,85,85,85,85,21,17,133,153,153,153,136,136,136,152,187,119,119,119,119,119,85,
+119,85,85,152,153,153,153,153,153,137,85,85,85,17,17,85,85,152,153,153,137,136,136,136,136,185,120,119,119,85,85,85,119,119,87,133,153,153,153,136,136,153,137,85,85,85,85,85,133,153,153,153,136,136,136,136,136,152,121,87,85,85,85,133,
+119,119,119,85,152,153,137,136,136,136,153,153,88,85,85,85,152,153,153,136,136,136,136,136,136,136,137,119,119,85,85,152,119,119,119,87,133,153,136,136,136,136,152,153,153,136,136,136,153,153,136,136,136,136,136,136,136,40,152,85,85,85,133,153,
+119,119,119,119,85,152,136,136,136,136,136,152,153,153,153,153,153,136,136,136,136,136,136,136,136,136,130,121,87,85,152,136,119,119,119,119,87,133,136,136,136,136,136,136,153,185,153,155,137,136,136,136,136,136,136,136,136,136,40,120,87,133,137,136,
+119,119,119,119,87,133,137,136,136,136,136,136,40,153,155,153,136,136,136,136,136,136,136,136,136,136,136,130,85,152,137,136,119,119,87,119,87,133,153,136,136,136,136,136,136,146,153,137,136,136,136,136,136,136,136,136,136,136,136,40,136,153,137,136,
+119,119,119,119,87,133,187,137,136,136,136,136,136,146,153,153,136,136,136,136,136,136,136,136,136,136,136,40,136,153,153,136,87,119,119,119,85,136,187,155,152,136,136,136,136,146,121,153,137,136,136,136,136,136,136,136,136,136,136,130,152,136,152,137,
+119,85,119,119,85,152,187,137,153,153,136,34,34,153,119,151,153,136,136,136,136,136,136,136,136,136,40,136,137,85,133,152,119,85,119,87,133,153,153,119,119,151,153,153,153,137,119,119,153,137,136,136,136,136,136,136,136,136,40,152,88,85,85,85,
+119,119,119,87,149,153,121,85,85,85,152,153,153,121,119,119,149,153,136,136,136,136,136,136,136,136,130,137,85,85,85,85,119,119,119,85,152,153,87,117,87,85,85,152,153,121,119,119,149,155,137,136,136,136,136,136,136,40,152,88,85,85,85,85,
+119,119,87,85,153,121,85,87,85,85,85,85,152,137,119,87,133,185,155,136,136,136,136,40,34,130,136,117,119,119,119,87,119,119,85,133,153,120,85,85,85,85,85,85,17,152,119,87,133,187,187,137,136,136,136,136,40,136,137,87,85,85,85,85,
+85,85,85,152,153,87,85,85,85,85,85,85,21,129,89,85,153,185,187,187,137,136,136,136,130,152,88,85,85,85,85,85,85,85,85,152,121,85,85,85,85,85,85,85,21,129,153,153,153,136,152,185,153,136,136,40,136,137,85,85,85,85,85,85,
+85,85,133,153,120,85,85,85,85,85,85,85,21,129,153,153,136,136,136,130,153,137,136,130,152,88,85,85,85,85,85,85,119,87,149,153,87,85,85,85,85,85,85,85,21,129,153,137,136,136,136,40,130,136,40,136,137,85,85,85,85,85,85,85,
+119,85,152,121,85,85,85,85,85,85,85,85,21,136,153,136,136,136,136,40,34,136,153,153,88,85,85,85,85,85,85,133,119,85,153,120,85,85,85,85,85,85,85,85,17,152,137,136,136,136,136,136,34,146,185,139,85,85,85,85,85,85,85,136,
+87,133,153,87,85,85,85,85,85,85,85,21,129,152,136,136,136,136,136,136,40,130,184,91,85,85,85,85,85,85,136,153,85,152,121,85,85,85,85,85,85,85,85,17,152,137,136,136,136,136,136,136,136,34,130,137,85,85,85,85,85,133,153,34,
+85,152,120,85,85,85,85,85,85,85,21,129,153,136,136,136,136,136,136,136,136,40,34,152,88,85,85,85,133,152,40,34,133,137,87,85,85,85,85,85,85,85,17,129,153,136,136,136,136,136,136,136,136,136,34,130,89,85,85,85,152,41,34,34,
+152,121,85,85,85,85,85,85,21,17,17,152,137,136,136,136,136,136,136,136,136,136,34,34,137,85,85,136,137,34,34,34,153,120,85,85,85,21,17,17,17,85,17,152,136,136,136,136,136,136,136,136,136,136,136,34,152,88,133,41,34,34,34,34,
+153,87,85,85,85,85,85,85,85,21,129,137,136,136,136,136,136,136,136,136,136,136,136,34,152,153,153,34,34,34,34,34,153,87,85,85,85,85,85,85,85,21,152,136,136,136,136,136,136,136,136,136,136,34,34,34,153,153,34,34,34,34,34,34,
+153,87,85,85,85,85,85,85,85,81,153,136,136,136,136,136,40,34,34,34,34,34,130,152,153,40,34,34,34,34,34,34,153,87,85,85,17,17,17,17,17,149,153,40,34,34,34,34,34,34,34,34,34,136,153,153,41,34,34,34,34,34,34,34,
+153,88,85,85,85,21,17,17,17,120,149,136,130,136,136,136,136,136,34,130,136,153,153,153,34,34,34,34,34,34,34,34,153,89,85,17,17,17,17,136,152,119,149,136,40,130,136,136,40,34,136,153,153,153,153,41,34,34,34,34,34,34,34,34,
+130,153,24,17,17,136,152,153,121,119,149,136,136,40,34,34,34,146,153,153,137,119,149,41,34,34,34,34,34,34,34,34,34,152,153,153,153,153,153,153,121,119,149,136,136,136,34,34,136,153,153,120,119,119,87,153,34,34,34,34,34,34,34,34,
+34,130,185,188,187,155,155,153,153,88,149,137,40,34,130,152,153,136,119,119,119,119,119,149,41,34,34,34,34,34,34,34,34,130,201,153,153,153,153,153,136,153,185,155,136,136,152,137,119,170,170,170,170,119,119,87,153,34,34,34,34,34,34,34,
+34,130,153,152,136,136,136,136,136,152,185,187,153,153,153,121,119,119,119,119,119,170,119,87,153,41,34,34,34,34,34,34,34,152,137,137,136,136,136,136,136,136,153,187,155,153,137,121,119,119,119,119,119,119,119,119,149,153,34,34,34,34,2,0,
+130,153,152,136,136,136,136,136,136,136,152,185,155,137,136,121,119,119,119,119,119,119,119,119,87,153,41,34,34,34,34,34,152,137,137,136,136,136,136,136,136,136,136,153,137,136,136,121,119,119,119,119,119,119,119,119,87,152,153,34,34,34,34,34,
+153,152,136,136,136,136,136,136,136,136,40,152,137,136,136,121,119,117,119,119,119,119,119,119,119,133,153,41,34,34,34,34,137,153,136,136,136,136,136,136,136,136,40,130,153,136,136,121,119,119,119,119,119,119,119,119,119,85,152,153,34,34,34,34,
+152,152,136,136,136,136,136,136,136,136,40,40,152,137,136,121,119,119,119,119,119,87,119,119,119,85,152,153,41,34,34,34,137,152,136,136,136,136,136,136,136,136,40,136,130,153,137,121,119,119,119,119,87,117,119,85,119,133,152,187,153,34,34,34,
+136,152,136,136,136,136,136,136,136,136,40,136,34,152,153,121,119,119,119,85,117,119,119,85,87,133,185,155,152,41,34,34,136,152,136,136,136,136,136,136,136,136,40,136,34,152,155,89,85,85,85,117,119,119,117,119,85,152,153,136,136,153,34,34,
+136,137,136,136,136,136,136,136,136,136,40,136,34,184,155,121,119,119,119,119,119,119,119,87,133,153,136,136,136,136,137,136,136,137,136,136,136,136,136,136,136,136,40,136,34,184,153,120,119,119,119,119,119,119,119,85,152,136,136,136,136,136,152,153,
+136,137,136,136,136,136,136,136,136,136,34,40,130,153,137,136,87,85,85,85,85,85,85,133,153,136,136,136,136,136,136,152,152,137,136,136,136,136,136,136,136,136,130,40,152,153,137,152,153,153,153,153,153,153,153,153,153,136,136,136,136,136,136,152,
+152,137,136,136,136,136,136,136,136,40,130,130,153,137,85,85,85,85,152,153,41,34,34,34,146,136,136,136,136,136,136,153,152,137,136,136,136,136,136,136,136,40,40,152,153,88,85,85,85,85,133,153,41,34,34,34,130,136,136,136,136,136,152,119,
+152,137,136,136,136,136,136,136,136,40,130,153,137,85,85,85,85,85,85,152,41,34,34,34,130,136,136,136,136,136,119,119,153,137,136,136,136,136,136,136,136,34,152,137,117,85,85,85,85,85,85,133,137,34,34,34,130,137,136,136,152,119,119,119,
+153,137,136,136,136,136,136,136,40,136,153,88,87,85,85,85,85,85,85,85,152,34,34,34,130,153,153,153,119,119,119,119,153,137,136,136,136,136,136,136,130,152,137,117,85,85,85,85,85,85,85,85,152,40,34,34,130,153,153,119,119,119,119,119,
+137,136,136,136,130,85,85,85,85,85,72,66,137,87,119,119,152,136,136,40,88,85,85,85,85,129,185,152,137,119,117,119,117,137,136,146,88,85,85,21,17,152,137,136,152,119,119,87,87,117,153,137,136,86,21,81,133,153,136,136,152,87,85,85,
+119,87,151,136,136,152,104,102,152,136,136,136,40,88,85,133,119,119,117,136,136,136,153,153,136,136,136,136,136,114,85,136,119,117,101,136,136,136,66,137,136,136,136,136,136,40,134,136,117,119,101,155,136,136,72,152,136,136,136,136,136,40,136,136,
+87,87,133,121,136,72,132,119,137,136,136,136,136,130,87,101,119,87,152,87,85,134,137,119,151,136,136,136,40,116,85,85,119,85,121,85,85,85,130,87,150,137,136,40,34,88,85,85,85,133,88,85,85,85,33,120,137,153,136,40,130,85,85,85,
+85,150,86,85,85,85,33,137,136,40,132,34,88,85,85,85,87,120,85,85,85,85,129,136,136,40,66,153,85,85,85,101,117,88,85,85,85,21,131,136,136,136,34,136,85,85,85,72,133,86,85,85,85,33,137,136,136,136,40,66,86,85,71,34,
+120,85,21,17,17,129,136,136,136,136,136,34,88,69,34,34,89,85,85,85,21,131,136,136,136,136,40,34,152,36,34,34,89,85,17,17,17,41,34,34,34,34,34,132,36,34,34,34,105,21,17,33,114,135,34,136,34,66,152,73,34,34,34,34,
+130,52,131,152,120,135,40,34,66,137,119,70,34,34,34,34,34,153,153,153,136,152,34,132,120,119,119,103,36,34,34,34,66,136,136,136,136,185,153,136,119,119,119,87,72,34,34,0,132,136,136,136,136,152,137,136,119,119,119,119,133,36,34,34,
+136,136,136,136,136,66,136,136,87,119,119,119,87,72,34,34,136,136,136,136,136,34,132,136,119,119,85,87,87,152,36,34,136,136,136,136,136,130,130,121,85,85,117,85,117,137,72,34,136,136,136,136,136,130,146,121,119,119,119,87,135,136,136,136,
+136,136,136,136,136,34,148,136,119,119,119,135,137,136,136,136,136,136,136,136,40,66,121,85,85,151,36,34,130,136,136,136,136,136,136,136,40,132,87,85,85,117,36,34,130,136,120,119,137,136,136,136,130,88,85,85,85,85,40,34,146,137,119,119,
+136,40,84,85,21,73,88,117,117,72,88,17,129,136,120,85,87,135,136,136,136,136,34,117,85,133,136,132,136,136,40,136,85,120,70,116,136,136,34,85,85,87,85,114,152,40,82,85,133,85,85,129,40,130,85,85,86,85,21,132,136,34,85,34,
+88,17,33,136,136,34,40,34,23,17,65,34,34,68,34,34,130,152,135,34,115,55,34,34,130,136,152,136,119,87,36,2,136,136,40,132,117,85,133,34,136,136,40,130,85,85,134,36,136,136,34,100,117,34,132,136,136,136,66,85,85,34,132,119,
+71,18,130,87,117,72,136,114,117,49,72,82,86,49,50,21,18,34,34,34,132,72,119,2,136,66,85,39,136,34,37,116,39,119,37,20,50,34,40,49,34,35,2,0,
+
+};
+
+// Runs of equal texels in every texture column (row of the transposed data)
+// Column i has the runs [colorstone_run_offsets[i], colorstone_run_offsets[i + 1]) in colorstone_run_ends
+// Each entry is the exclusive end texel of a run, so a column's last run always ends at 64
+
+constexpr uint16_t colorstone_run_offsets[64 + 1] = {
+0,14,32,48,67,86,104,120,135,152,167,182,198,214,228,241,262,285,302,318,339,361,383,401,419,438,454,470,486,502,519,538,555,571,589,600,610,622,633,648,663,681,696,717,735,750,766,781,794,810,824,843,865,886,906,922,938,953,965,981,997,1010,1028,1043,1059,
+
+};
+
+constexpr uint8_t colorstone_run_ends[1059] = {
+3,17,18,20,21,22,23,40,41,43,47,48,52,64,
+4,16,17,19,20,21,22,39,40,43,44,46,47,51,52,54,55,64,
+5,15,16,18,19,20,21,38,39,41,44,46,51,56,58,64,
+1,2,6,14,15,17,18,19,20,36,37,38,40,44,50,51,56,58,64,
+2,3,7,13,14,17,18,34,36,37,40,42,44,48,50,51,52,63,64,
+1,3,4,8,12,13,18,19,31,34,35,36,42,49,50,52,62,64,
+2,6,7,19,20,26,30,34,35,41,50,51,52,53,58,64,
+5,7,8,14,18,21,22,33,34,40,51,53,55,63,64,
+6,8,9,13,20,24,25,32,33,38,52,53,54,58,62,63,64,
+7,9,10,12,21,26,32,36,51,52,53,54,61,62,64,
+8,10,11,12,23,34,52,53,54,55,57,60,61,62,64,
+9,11,24,27,28,30,31,33,53,54,55,57,59,60,61,64,
+9,11,12,13,25,26,28,29,32,54,55,56,58,59,61,64,
+5,6,9,11,12,14,26,27,31,55,56,58,61,64,
+9,11,12,14,15,26,27,32,55,56,58,62,64,
+1,2,8,10,12,15,16,17,18,26,27,29,30,33,54,55,57,58,61,63,64,
+2,4,8,10,11,12,14,15,16,20,22,26,28,31,34,53,54,56,57,58,61,63,64,
+2,4,7,9,10,14,19,27,28,32,35,53,54,55,56,57,64,
+7,9,13,14,20,21,27,32,33,36,52,53,54,55,56,64,
+6,8,9,12,13,15,17,22,23,27,32,33,34,35,37,51,52,53,54,55,64,
+5,8,11,12,14,15,24,25,27,28,31,33,34,35,37,38,47,51,54,55,63,64,
+4,7,8,10,11,12,24,26,27,28,31,33,34,38,39,49,50,52,53,54,55,64,
+6,7,10,11,25,27,28,29,32,35,40,41,48,49,51,52,53,64,
+6,7,9,10,25,27,28,34,37,39,40,42,47,48,50,51,52,64,
+5,6,8,9,10,25,27,28,32,38,39,40,43,46,47,49,50,51,64,
+3,5,8,9,25,27,28,31,39,41,45,46,48,49,50,64,
+2,4,5,7,8,25,26,28,30,39,42,44,48,49,63,64,
+2,4,6,7,8,24,26,27,29,40,43,45,47,48,62,64,
+1,3,4,6,7,23,25,27,28,41,43,45,47,60,62,64,
+2,3,5,6,22,24,25,27,42,45,46,47,48,59,60,62,64,
+2,3,4,5,6,21,23,24,26,43,46,47,48,49,57,59,60,61,64,
+1,2,3,4,5,20,23,24,26,44,47,48,49,56,57,59,64,
+1,3,4,17,22,23,25,44,48,49,50,54,56,57,58,64,
+2,3,4,11,18,20,22,23,24,46,48,49,50,51,53,54,55,64,
+2,3,19,21,22,23,46,48,49,54,64,
+2,3,19,20,21,22,42,48,52,64,
+2,3,18,19,20,22,33,45,47,50,51,64,
+2,3,8,18,19,22,23,42,44,49,64,
+2,3,11,18,19,20,21,22,24,25,36,39,42,48,64,
+3,6,14,17,18,20,21,22,25,27,33,36,38,47,64,
+1,2,4,5,10,13,17,20,21,22,27,35,41,42,44,45,47,64,
+2,3,17,20,21,22,28,32,34,38,39,45,46,48,64,
+3,4,5,6,7,11,12,13,18,19,21,23,25,29,31,34,36,46,47,49,64,
+3,4,5,6,16,18,21,23,24,29,31,32,34,42,47,48,50,64,
+3,4,6,7,8,19,21,24,31,42,44,47,48,51,64,
+2,3,5,6,7,20,22,25,29,30,31,48,49,52,61,64,
+1,2,4,5,6,21,23,25,27,30,31,49,50,53,64,
+1,3,4,5,22,25,30,31,49,50,51,54,64,
+2,3,4,21,22,23,25,30,31,34,35,50,51,52,55,64,
+1,2,4,21,23,24,26,30,31,50,52,53,56,64,
+1,2,3,4,21,22,23,24,25,27,30,31,43,44,50,52,53,57,64,
+1,3,4,21,22,24,25,26,29,30,31,41,43,46,48,50,51,53,54,56,58,64,
+3,4,21,22,24,26,27,31,38,41,46,48,49,51,52,53,55,56,57,59,64,
+3,4,21,22,24,26,27,28,29,31,39,44,45,48,50,51,54,58,60,64,
+2,3,21,22,24,26,27,29,31,47,49,50,52,60,61,64,
+2,3,21,22,24,26,27,28,30,31,46,48,49,50,61,64,
+2,3,20,22,23,25,26,29,32,33,47,48,50,63,64,
+1,3,20,21,23,24,25,29,31,50,63,64,
+1,3,19,21,22,23,24,27,28,36,37,41,49,50,62,64,
+1,3,19,20,21,22,23,26,27,37,38,41,49,61,62,64,
+1,3,19,21,22,25,26,38,39,41,49,60,64,
+3,18,20,21,23,24,25,26,39,40,41,42,49,50,51,57,58,64,
+3,17,18,20,22,23,24,25,40,41,42,49,50,56,64,
+3,16,17,19,21,22,23,24,40,41,42,43,49,50,54,64,
 
 };
 
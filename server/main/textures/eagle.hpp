@@ -1,78 +1,168 @@
 
 #pragma once
 
-// Generated by generate_texture.py on 2022-09-07T14:50:30.100538
+// Generated by generate_texture.py on 2026-10-16T14:06:49.990344
 
 #include <cstdint>
 
 namespace textures
 {
 
-constexpr uint8_t eagle[64 * 64] = {
-9,82,9,82,240,154,82,82,82,82,82,82,192,128,128,64,128,64,64,64,9,82,82,82,9,82,82,82,82,82,82,82,128,128,128,128,128,128,64,64,9,82,9,82,82,82,9,82,9,82,9,82,192,64,128,128,64,64,64,64,64,9,9,82,
-9,9,192,248,240,160,72,128,128,64,82,9,192,128,128,128,128,128,128,64,9,82,192,192,192,128,128,128,192,128,82,82,128,128,64,64,128,128,64,64,9,82,192,192,192,192,192,192,192,128,82,9,192,128,64,64,128,128,128,128,64,9,82,82,
-9,82,192,192,160,80,128,64,128,64,9,9,192,128,128,128,128,64,64,64,9,82,192,128,128,64,128,64,128,128,9,82,128,128,128,128,64,64,128,64,9,82,192,128,128,128,128,128,128,64,9,82,192,64,64,64,64,64,64,64,64,9,9,82,
-9,82,192,128,173,91,91,164,173,173,246,246,173,173,173,173,173,173,173,173,173,173,246,246,246,173,173,173,173,164,173,173,173,173,173,173,173,173,173,173,246,246,246,173,173,173,173,173,173,173,173,173,173,91,64,64,64,128,64,128,64,9,82,82,
-9,82,192,128,173,91,91,91,91,164,173,173,246,246,246,173,173,173,173,173,173,173,246,246,246,173,173,173,173,164,173,173,173,173,173,173,173,173,173,173,246,246,246,173,173,173,173,173,173,173,173,173,173,173,91,64,64,64,64,64,64,9,9,82,
-9,82,192,192,173,91,91,201,128,64,64,82,64,64,128,128,128,64,64,64,64,64,64,128,128,64,64,64,64,64,64,64,64,64,64,64,64,64,64,128,128,128,128,128,128,128,64,64,64,64,64,64,91,173,173,82,64,64,128,64,64,9,9,82,
-9,82,192,128,173,91,91,128,246,164,164,91,91,164,173,173,246,246,246,246,173,173,246,246,246,173,173,173,173,164,173,173,173,173,173,173,173,173,173,173,246,246,246,173,173,173,173,173,173,173,164,91,64,91,173,91,64,64,128,128,64,9,9,82,
-9,82,192,128,173,91,164,64,164,246,173,164,164,164,164,164,173,173,246,246,246,246,173,246,164,164,66,66,66,66,66,91,164,173,173,173,173,173,173,173,246,246,246,173,173,173,173,173,173,173,173,173,91,64,173,173,82,64,64,64,64,9,82,82,
-9,82,192,192,173,91,164,64,91,164,246,173,173,164,164,164,164,173,173,91,66,67,67,66,91,164,66,66,66,66,66,66,91,173,164,66,66,91,164,173,246,246,246,173,173,173,173,173,173,173,173,173,164,64,164,173,91,64,64,64,64,9,82,82,
-9,82,192,128,173,91,164,82,64,91,164,246,173,173,164,164,164,164,164,66,66,66,67,67,66,91,82,66,66,66,66,66,66,164,164,66,66,66,66,91,173,173,173,173,173,173,173,173,173,173,173,173,173,64,91,173,173,64,64,64,64,9,82,82,
-9,82,192,192,173,91,164,64,91,164,91,164,246,173,91,66,66,82,91,91,66,66,66,66,67,82,91,66,66,66,66,66,66,164,91,66,66,66,66,66,91,173,173,173,173,173,173,173,173,173,173,173,173,91,64,173,173,64,64,128,64,9,82,82,
-9,82,192,128,173,91,164,64,173,164,91,91,164,91,67,67,66,66,82,82,82,66,66,66,66,66,91,66,66,66,66,66,66,164,66,66,66,66,66,66,66,164,173,173,173,173,173,173,173,173,173,173,173,164,64,173,173,82,64,64,64,9,82,82,
-9,82,128,64,173,91,164,64,246,173,164,91,91,66,67,67,67,66,66,82,82,66,66,66,66,66,91,66,66,66,66,66,66,164,66,66,66,66,66,66,66,164,173,173,173,173,173,173,173,173,173,173,173,173,64,164,173,91,64,64,64,9,82,82,
-9,82,82,9,173,91,164,64,246,173,164,164,91,91,82,67,67,67,66,82,82,66,66,66,66,66,91,66,66,66,66,66,82,91,66,66,66,66,66,66,66,164,173,91,144,173,164,144,81,173,173,173,173,173,64,91,173,173,64,64,64,9,9,82,
-9,82,82,82,173,91,164,64,246,164,82,66,82,91,91,66,67,67,67,66,82,9,66,66,66,66,91,66,66,66,66,66,91,66,66,66,66,66,66,66,91,164,164,144,144,91,144,81,91,173,173,173,173,173,91,64,173,173,82,64,64,9,9,82,
-9,82,82,82,173,91,164,64,246,91,66,66,66,82,91,82,67,67,67,67,82,82,66,66,66,66,82,66,66,66,66,66,91,66,66,66,66,66,66,91,66,66,164,144,144,91,144,81,164,173,173,173,173,173,164,64,164,173,91,64,64,9,9,82,
-9,82,192,192,173,91,164,64,173,173,91,66,66,66,82,91,66,67,67,67,67,82,66,66,66,66,82,66,66,66,66,82,66,66,66,66,66,66,91,66,66,66,66,91,144,81,144,164,173,173,173,173,173,173,173,64,91,173,173,64,64,9,9,82,
-9,9,192,128,173,91,164,64,173,246,173,66,66,66,66,82,82,66,67,67,67,82,66,66,66,66,82,66,66,66,66,91,66,66,66,66,66,91,66,66,66,66,66,173,144,144,144,144,144,144,164,173,173,173,173,91,64,173,173,64,64,9,9,82,
-9,82,192,128,173,91,164,64,173,246,246,91,66,66,66,9,82,66,66,66,67,91,66,66,66,66,9,66,66,66,66,66,66,66,66,66,91,66,66,66,66,66,66,173,144,144,144,144,81,81,144,173,173,173,173,164,64,164,173,82,9,9,9,82,
-9,82,192,128,173,91,164,64,173,173,246,173,66,66,66,66,9,66,67,132,66,66,132,132,67,66,66,66,66,66,82,66,66,66,66,91,66,66,66,66,66,66,164,173,144,144,144,81,173,173,173,173,173,173,173,173,64,91,173,91,9,9,9,82,
-9,82,192,128,173,91,164,64,173,173,246,246,91,66,66,66,66,66,66,66,132,66,66,66,66,67,66,66,66,66,66,66,66,66,91,66,66,66,66,66,66,164,173,173,144,144,144,173,173,173,66,91,173,173,173,173,91,64,173,173,9,9,9,9,
-9,82,192,128,173,91,164,64,173,173,246,246,173,66,132,67,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,91,66,66,66,66,66,66,164,173,173,91,144,81,144,164,173,91,66,82,173,173,173,173,164,64,164,173,82,9,9,9,
-9,82,192,128,173,91,164,64,173,173,173,246,173,66,66,66,66,66,66,66,66,66,66,66,66,66,132,66,66,66,66,66,91,66,66,66,66,66,164,66,66,132,173,144,144,81,144,81,173,82,66,66,91,173,173,173,173,64,91,173,91,9,9,9,
-9,82,192,128,173,91,164,64,173,173,173,246,173,91,66,66,66,66,66,66,66,66,66,66,66,66,66,132,66,66,66,82,66,66,66,66,91,164,66,66,66,66,91,66,81,91,144,144,91,66,66,66,82,173,173,173,173,91,64,173,173,9,9,9,
-9,82,192,64,173,91,164,64,173,173,173,246,173,164,66,66,66,66,164,66,66,66,66,66,66,66,66,67,66,66,82,66,66,66,66,91,164,66,66,66,66,66,66,66,81,173,173,173,82,66,66,66,66,173,173,173,173,164,64,173,173,9,9,9,
-9,82,192,128,173,91,164,64,173,173,173,246,173,173,91,66,66,164,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,91,66,66,66,66,66,66,66,66,173,173,91,66,66,66,66,66,173,173,173,173,173,64,164,173,82,9,9,
-9,82,192,128,173,91,164,64,173,173,173,173,173,173,164,66,82,173,91,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,91,66,66,66,66,66,66,66,66,66,173,173,66,66,66,66,66,91,173,173,173,173,173,64,91,173,91,9,9,
-9,82,192,128,173,91,164,64,173,173,173,173,173,173,173,173,173,173,173,173,91,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,91,173,66,66,66,66,66,91,173,173,173,173,173,173,91,64,173,173,9,9,
-9,82,192,128,173,91,164,64,173,173,173,66,66,91,173,173,173,91,66,173,91,66,66,66,82,91,91,82,91,82,91,82,66,66,66,66,66,66,66,66,66,66,66,66,173,66,66,66,66,66,66,173,91,66,91,173,173,173,164,64,164,173,9,9,
-9,82,192,128,173,91,164,64,173,173,173,91,66,66,66,66,66,66,66,66,66,66,66,66,82,67,132,67,132,67,82,91,66,66,66,66,66,66,66,66,66,91,66,66,66,66,66,66,66,66,91,66,66,66,66,91,173,173,173,64,91,173,82,9,
-9,82,192,64,173,91,164,64,173,173,173,82,66,66,66,66,66,66,66,66,66,66,66,66,91,132,67,67,67,132,67,91,82,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,91,173,173,91,64,173,91,9,
-9,82,192,128,173,91,164,64,173,173,173,66,66,66,66,66,66,66,66,66,66,66,66,66,91,67,67,67,67,82,82,82,91,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,91,173,164,64,173,173,9,
-9,82,192,64,173,91,164,64,173,173,173,66,66,66,66,66,66,66,66,66,66,66,66,66,91,67,67,67,67,67,67,82,91,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,91,173,164,64,173,173,9,
-9,82,192,128,173,91,164,64,173,173,173,66,91,66,66,66,66,66,66,66,66,66,66,66,91,132,67,67,67,132,67,91,82,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,91,173,173,91,64,173,91,9,
-9,82,192,192,173,91,164,64,173,173,173,66,66,66,66,66,66,66,66,66,66,66,66,66,82,67,132,67,132,67,82,91,66,66,66,66,66,66,66,66,66,91,66,66,66,66,66,66,66,66,91,66,66,66,66,91,173,173,173,64,91,173,82,9,
-9,82,192,128,173,91,164,64,173,173,173,144,144,144,164,173,173,91,66,173,91,66,66,66,82,91,91,82,91,82,91,82,66,66,66,66,66,66,66,66,66,66,66,66,173,66,66,66,66,66,66,173,91,66,91,173,173,173,164,64,164,173,9,9,
-9,82,128,64,173,91,164,64,173,173,173,216,144,164,173,173,173,173,173,173,91,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,91,173,66,66,66,66,66,91,173,173,173,173,173,173,91,64,173,173,9,9,
-9,82,82,9,173,91,164,64,173,173,173,216,216,173,164,66,82,173,91,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,91,66,66,66,66,66,66,66,66,66,173,173,66,66,66,66,66,91,173,173,173,173,173,64,91,173,91,9,9,
-9,82,9,82,173,91,164,64,173,173,173,173,225,173,91,67,66,164,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,91,66,66,66,66,66,66,66,66,173,173,91,66,66,66,66,66,173,173,173,173,173,64,164,173,82,9,9,
-9,82,82,9,173,91,164,64,173,173,173,173,173,164,67,67,66,66,164,66,66,66,66,66,66,66,66,67,66,66,82,66,66,66,66,91,164,66,66,66,66,66,66,66,81,173,173,173,82,66,66,66,66,173,173,173,173,164,64,173,173,9,9,9,
-9,82,192,192,173,91,164,64,173,173,173,173,173,91,67,66,66,66,66,66,66,66,66,66,66,66,66,132,66,66,66,82,66,66,66,66,91,164,66,66,66,66,91,66,81,91,144,144,91,66,66,66,82,173,173,173,173,91,64,173,91,9,9,9,
-9,82,192,128,173,91,164,64,173,173,173,173,173,67,66,66,66,66,66,66,66,66,66,66,66,66,132,66,66,66,66,66,91,66,66,66,66,66,164,66,66,132,173,144,144,81,144,81,173,82,66,66,91,173,173,173,173,64,91,173,82,9,9,9,
-9,82,192,192,173,91,164,64,173,173,173,246,164,67,132,67,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,91,66,66,66,66,66,66,164,173,173,91,144,81,144,164,173,91,66,82,173,173,173,173,164,64,164,173,64,9,9,9,
-9,82,192,128,173,91,164,64,173,173,173,246,91,66,66,66,66,66,66,66,67,66,66,66,66,132,66,66,66,66,66,66,66,66,91,66,66,66,66,66,66,164,173,173,144,144,144,173,173,173,66,91,173,173,173,173,91,64,173,173,64,9,9,9,
-9,82,192,192,173,91,164,64,173,173,246,164,67,66,66,66,9,66,66,67,66,66,132,132,132,66,66,66,66,66,82,66,66,66,66,91,66,66,66,66,66,66,164,173,144,144,144,81,173,173,173,173,173,173,173,173,64,91,173,91,64,9,9,9,
-9,82,192,128,173,91,164,64,173,173,246,91,66,66,66,9,82,66,66,66,66,82,66,66,66,66,82,66,66,66,66,66,66,66,66,66,91,66,66,66,66,66,66,173,144,144,144,144,81,81,144,173,173,173,173,164,64,164,173,82,64,9,9,9,
-9,82,192,128,173,91,164,64,173,173,164,67,66,66,66,82,82,66,66,66,67,91,66,66,66,66,82,66,66,66,66,91,66,66,66,66,66,91,66,66,66,66,66,173,144,144,144,144,144,144,164,173,173,173,173,91,64,173,173,64,64,9,9,82,
-9,82,192,192,173,91,164,64,173,164,91,66,66,66,82,91,66,66,66,67,67,164,66,66,66,66,82,66,66,66,66,82,66,66,66,66,66,66,91,66,66,66,66,91,144,81,144,164,173,173,173,173,173,173,173,64,91,173,173,9,9,9,9,82,
-9,82,192,64,173,91,164,64,246,67,67,66,66,82,91,82,66,66,67,67,82,91,66,66,66,66,82,66,66,66,66,66,91,66,66,66,66,66,66,91,66,66,164,144,144,91,144,81,164,173,173,173,173,173,164,64,164,173,91,9,9,9,9,82,
-9,82,192,192,173,91,164,64,246,91,66,66,82,91,82,66,66,67,67,67,164,82,66,66,66,66,9,66,66,66,66,66,91,66,66,66,66,66,66,66,91,164,164,144,144,91,144,81,91,173,173,173,173,173,91,64,173,173,82,9,9,9,9,82,
-9,82,192,64,173,91,164,128,246,246,164,164,164,91,67,67,67,67,67,82,91,66,66,66,66,66,82,66,66,66,66,66,82,91,66,66,66,66,66,66,66,164,173,91,144,173,164,144,81,173,173,173,173,173,64,91,173,173,64,64,64,9,9,82,
-9,9,192,192,173,91,164,128,246,173,173,164,164,66,67,67,67,67,67,91,91,66,66,66,66,66,82,66,66,66,66,66,66,164,66,66,66,66,66,66,66,164,173,173,246,173,173,173,173,173,173,173,173,173,64,164,173,91,64,64,64,9,82,82,
-9,9,192,128,173,91,164,192,246,173,173,164,164,91,67,67,67,67,82,91,82,66,66,66,66,66,82,66,66,66,66,66,66,164,66,66,66,66,66,66,66,164,173,173,246,173,173,173,173,173,173,173,173,164,64,173,173,82,64,64,64,9,82,82,
-9,9,192,192,173,91,164,192,91,173,164,164,173,173,91,67,67,82,91,82,66,66,66,66,66,82,91,66,66,66,66,66,66,164,91,66,66,66,66,66,91,173,173,246,246,246,173,173,173,173,173,173,173,164,64,173,173,64,64,64,64,9,82,82,
-9,82,192,128,173,91,164,91,64,173,164,173,246,246,173,164,164,164,91,82,66,66,66,66,66,91,82,66,66,67,67,67,66,164,164,66,66,66,66,91,173,173,173,246,246,246,173,173,173,173,173,173,173,64,164,173,91,64,64,128,64,9,82,82,
-9,82,192,128,173,91,164,64,91,91,173,246,246,173,164,164,91,91,164,91,66,66,66,66,91,164,67,67,67,67,67,66,91,173,164,66,66,91,164,173,173,173,173,246,246,246,173,173,173,173,173,173,164,64,164,173,82,64,64,64,64,9,82,82,
-9,82,192,128,173,91,164,64,91,173,246,246,173,164,91,91,164,164,164,164,164,173,173,164,164,164,67,67,67,67,66,91,164,173,164,164,164,164,173,173,173,173,246,246,246,246,246,173,173,173,173,173,91,64,173,173,64,64,64,128,64,9,82,82,
-9,82,192,64,173,91,91,64,164,246,91,91,91,91,164,164,164,164,173,173,173,173,173,173,173,173,246,246,246,246,173,173,173,173,164,164,164,164,173,173,173,173,246,246,246,246,246,173,173,173,164,91,64,91,173,91,64,64,64,64,64,9,82,82,
-9,82,192,192,173,91,91,91,201,128,64,82,64,64,64,64,64,64,64,64,64,64,64,64,64,128,128,128,128,128,64,64,64,64,64,64,64,64,64,64,64,64,128,128,128,128,128,64,64,64,64,64,91,164,173,82,64,64,128,128,64,9,82,82,
-9,82,128,128,173,91,91,246,91,91,91,164,164,173,173,173,173,173,173,173,173,173,173,173,173,173,246,246,246,246,173,173,173,173,164,164,164,164,173,173,173,173,246,246,246,246,246,173,173,173,173,173,173,173,91,64,64,64,64,64,64,9,9,82,
-9,82,128,192,173,91,91,91,91,91,164,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,246,246,246,246,173,173,173,173,164,164,164,164,173,173,173,173,246,246,246,246,246,173,173,173,173,173,173,91,64,64,64,64,64,128,64,9,82,82,
-9,82,128,128,240,88,64,64,64,64,9,9,64,64,64,64,64,64,64,64,9,9,64,64,64,64,64,64,64,64,9,9,64,64,64,64,64,64,64,64,9,9,64,64,64,64,64,64,64,64,9,9,64,64,64,64,64,128,64,64,64,9,82,82,
-9,82,128,248,240,226,154,64,64,64,9,9,64,64,64,64,64,64,64,64,9,9,64,64,64,64,64,64,64,64,9,9,64,64,64,64,64,64,64,64,9,9,64,64,64,64,64,64,64,64,9,9,64,64,64,64,64,64,128,128,64,9,82,82,
-9,9,82,9,88,80,9,9,9,9,9,9,192,128,128,64,64,128,64,64,9,9,9,9,9,9,9,9,9,9,9,9,128,128,64,64,128,64,64,64,9,9,9,9,9,9,9,9,9,9,9,9,128,64,64,128,128,128,64,64,64,9,82,82,
+// Colors of all levels in rgb233, texels are indices into the palette packed in eagle_index_bits each
+constexpr auto eagle_index_bits = 6;
+
+constexpr uint8_t eagle_palette[46] = {
+0,1,2,9,18,64,66,67,72,73,74,75,80,81,82,83,88,90,91,92,98,99,100,128,132,137,144,145,146,152,154,155,156,160,162,163,164,173,192,201,216,225,226,240,246,248,
+
+};
+
+// Palette indices of the 64x64 texels followed by prefiltered mip levels 1 to 6 (32x32 down to 1x1),
+// box-filtered from the source texture
+// Levels are transposed (stored column by column) and packed least significant bit first, with a byte of padding at the end
+
+constexpr uint8_t eagle_texels[4097] = {
+131,51,56,171,231,56,142,227,56,230,117,21,87,81,20,131,227,56,131,227,56,142,227,56,215,117,93,215,85,20,131,51,56,142,51,56,131,51,56,102,113,93,69,81,20,197,48,56,195,96,182,107,136,92,87,225,12,230,117,93,215,117,21,131,
+99,154,230,117,93,230,229,56,215,85,20,215,85,20,131,99,154,166,105,154,230,229,12,230,85,20,215,117,93,197,224,56,131,99,154,33,115,21,87,49,12,230,117,93,87,81,20,131,99,94,87,113,21,215,53,56,215,117,93,69,113,21,131,99,
+94,215,117,93,87,49,56,102,81,20,69,81,20,197,48,56,131,99,94,165,36,145,101,201,178,101,89,150,101,89,150,101,201,178,108,89,150,37,89,150,101,89,150,101,89,150,44,203,150,101,89,150,101,89,150,165,84,20,197,85,92,197,224,56,
+131,99,94,165,36,73,18,89,150,44,203,150,101,89,150,101,201,178,108,89,150,37,89,150,101,89,150,101,89,150,44,203,150,101,89,150,101,89,150,101,41,21,69,81,20,197,48,56,131,99,154,165,36,157,87,81,56,69,113,93,87,81,20,69,
+81,92,87,81,20,69,81,20,69,81,20,69,81,92,215,117,93,215,85,20,69,81,20,82,89,58,69,113,21,197,48,56,131,99,94,165,36,93,44,73,74,18,89,150,44,203,178,101,201,178,108,89,150,37,89,150,101,89,150,101,89,150,44,203,
+150,101,89,150,101,73,74,133,84,74,69,113,93,197,48,56,131,99,94,165,68,22,36,91,146,36,73,146,101,201,178,44,91,178,36,105,24,134,97,72,100,89,150,101,89,150,44,203,150,101,89,150,101,89,150,82,81,150,78,81,20,197,224,56,
+131,99,154,165,68,22,18,201,150,37,73,146,100,89,74,198,113,24,18,105,24,134,97,24,82,73,26,134,68,150,44,203,150,101,89,150,101,89,150,100,65,150,82,81,20,197,224,56,131,99,94,165,68,58,133,68,178,101,73,146,36,73,26,134,
+113,28,134,228,24,134,97,24,6,73,26,134,97,72,101,89,150,101,89,150,101,89,150,101,33,149,101,81,20,197,224,56,131,99,154,165,68,22,18,41,145,108,41,25,134,35,73,134,97,24,135,35,25,134,97,24,6,41,25,134,97,24,82,89,
+150,101,89,150,101,89,150,165,84,148,101,81,92,197,224,56,131,99,94,165,68,22,37,41,73,164,116,28,134,225,56,142,97,24,134,33,25,134,97,24,6,105,24,134,97,24,6,89,150,101,89,150,101,89,150,37,89,148,165,83,20,197,224,56,
+131,115,21,165,68,22,108,73,74,146,113,28,135,97,56,142,97,24,134,33,25,134,97,24,6,105,24,134,97,24,6,89,150,101,89,150,101,89,150,101,89,144,165,84,20,197,224,56,131,227,12,165,68,22,108,73,146,146,228,28,199,97,56,142,
+97,24,134,33,25,134,97,24,142,100,24,134,97,24,6,89,74,90,73,106,77,89,150,101,89,72,101,89,20,197,48,56,131,227,56,165,68,22,44,233,24,142,36,25,199,113,24,206,96,24,134,33,25,134,97,24,146,97,24,134,97,24,18,73,
+106,154,164,53,82,89,150,101,41,21,101,233,20,197,48,56,131,227,56,165,68,22,172,100,24,134,35,57,199,113,28,142,99,24,134,225,24,134,97,24,146,97,24,134,97,72,134,65,106,154,164,53,100,89,150,101,73,22,100,41,21,197,48,56,
+131,99,154,165,68,22,101,41,25,134,225,72,198,113,28,135,99,24,134,225,24,134,97,56,134,97,24,134,33,25,134,97,72,90,163,145,101,89,150,101,89,22,82,89,22,197,48,56,195,96,94,165,68,22,37,91,26,134,97,56,142,113,28,135,
+99,24,134,225,24,134,97,72,134,97,24,134,100,24,134,97,148,154,166,105,154,70,150,101,89,74,69,89,22,197,48,56,131,99,94,165,68,22,37,203,74,134,97,12,142,97,24,135,100,24,134,49,24,134,97,24,134,97,24,146,97,24,134,97,
+148,154,166,105,77,163,149,101,89,146,5,89,58,195,48,56,131,99,94,165,68,22,101,201,150,134,97,24,131,113,96,134,129,97,135,97,24,134,225,24,134,97,72,134,97,24,134,65,150,154,166,53,101,89,150,101,89,150,133,84,74,195,48,56,
+131,99,94,165,68,22,101,201,178,146,97,24,134,97,24,152,97,24,198,97,24,134,97,24,134,33,25,134,97,24,6,89,150,154,166,149,101,105,72,101,89,150,82,81,150,195,48,12,131,99,94,165,68,22,101,201,178,165,129,29,134,97,24,134,
+97,24,134,97,24,134,97,24,134,100,24,134,97,24,100,89,74,90,163,145,165,100,56,101,89,150,100,65,150,206,48,12,131,99,94,165,68,22,101,89,178,165,97,24,134,97,24,134,97,24,134,129,25,134,97,24,146,97,24,134,65,26,6,86,
+106,90,163,53,165,99,24,82,89,150,101,33,149,210,48,12,131,99,94,165,68,22,101,89,178,165,100,24,134,97,24,134,97,24,134,97,96,134,97,56,134,97,24,18,105,24,134,33,25,141,164,105,146,97,24,78,89,150,165,84,148,229,48,12,
+131,99,22,165,68,22,101,89,178,37,105,24,134,65,26,134,97,24,134,97,28,134,225,24,134,97,72,164,97,24,134,97,24,77,89,150,142,97,24,70,89,150,37,89,148,229,48,12,131,99,94,165,68,22,101,89,178,101,41,25,6,105,24,134,
+97,24,134,97,24,134,97,24,134,97,24,146,97,24,134,97,24,70,89,74,134,97,24,70,89,150,101,89,144,165,51,12,131,99,94,165,68,22,101,89,150,101,73,26,78,41,25,134,97,24,134,97,24,134,97,24,134,97,72,134,97,24,134,97,
+24,70,89,26,134,97,24,82,89,150,101,89,72,165,52,12,131,99,94,165,68,22,101,89,150,101,89,150,101,89,150,146,97,24,134,97,24,134,97,24,134,97,24,134,97,24,134,97,24,82,105,24,134,97,72,101,89,150,101,41,21,101,57,12,
+131,99,94,165,68,22,101,89,26,134,84,150,165,100,148,146,97,24,142,36,57,146,35,57,134,97,24,134,97,24,134,97,24,165,97,24,134,97,148,146,33,149,101,73,22,100,57,12,131,99,94,165,68,22,101,89,74,134,97,24,134,97,24,134,
+97,24,206,129,29,216,225,72,134,97,24,134,97,24,134,100,24,134,97,24,134,33,25,134,97,72,101,89,22,82,233,12,131,99,22,165,68,22,101,89,58,134,97,24,134,97,24,134,97,24,18,118,28,7,118,72,142,97,24,134,97,24,134,97,
+24,134,97,24,134,97,24,134,97,24,82,89,74,69,41,13,131,99,94,165,68,22,101,89,26,134,97,24,134,97,24,134,97,24,210,113,28,135,227,56,146,97,24,134,97,24,134,97,24,134,97,24,134,97,24,134,97,24,134,84,146,69,89,14,
+131,99,22,165,68,22,101,89,26,134,97,24,134,97,24,134,97,24,210,113,28,199,113,56,146,97,24,134,97,24,134,97,24,134,97,24,134,97,24,134,97,24,134,84,146,69,89,14,131,99,94,165,68,22,101,89,26,146,97,24,134,97,24,134,
+97,24,18,118,28,7,118,72,142,97,24,134,97,24,134,97,24,134,97,24,134,97,24,134,97,24,82,89,74,69,41,13,131,99,154,165,68,22,101,89,26,134,97,24,134,97,24,134,97,24,206,129,29,216,225,72,134,97,24,134,97,24,134,100,
+24,134,97,24,134,33,25,134,97,72,101,89,22,82,233,12,131,99,94,165,68,22,101,89,106,154,70,150,165,100,148,146,97,24,142,36,57,146,35,57,134,97,24,134,97,24,134,97,24,165,97,24,134,97,148,146,33,149,101,73,22,100,57,12,
+131,115,21,165,68,22,101,89,162,26,89,150,101,89,150,146,97,24,134,97,24,134,97,24,134,97,24,134,97,24,134,97,24,82,105,24,134,97,72,101,89,150,101,41,21,101,57,12,131,227,12,165,68,22,101,89,162,104,73,26,78,41,25,134,
+97,24,134,97,24,134,97,24,134,97,72,134,97,24,134,97,24,70,89,26,134,97,24,82,89,150,101,89,72,165,52,12,131,51,56,165,68,22,101,89,150,105,41,29,6,105,24,134,97,24,134,97,24,134,97,24,134,97,24,146,97,24,134,97,
+24,70,89,74,134,97,24,70,89,150,101,89,144,165,51,12,131,227,12,165,68,22,101,89,150,37,121,28,134,65,26,134,97,24,134,97,28,134,225,24,134,97,72,164,97,24,134,97,24,77,89,150,142,97,24,70,89,150,37,89,148,229,48,12,
+131,99,154,165,68,22,101,89,150,165,116,24,134,97,24,134,97,24,134,97,96,134,97,56,134,97,24,18,105,24,134,33,25,141,164,105,146,97,24,78,89,150,165,84,148,210,48,12,131,99,94,165,68,22,101,89,150,229,97,24,134,97,24,134,
+97,24,134,129,25,134,97,24,146,97,24,134,65,26,6,86,106,90,163,53,165,99,24,82,89,150,101,33,149,206,48,12,131,99,154,165,68,22,101,89,178,228,129,29,134,97,24,134,97,24,134,97,24,134,97,24,134,100,24,134,97,24,100,89,
+74,90,163,145,165,100,56,101,89,150,100,65,150,197,48,12,131,99,94,165,68,22,101,89,178,146,97,24,134,97,24,135,97,24,6,102,24,134,97,24,134,33,25,134,97,24,6,89,150,154,166,149,101,105,72,101,89,150,82,81,150,197,48,12,
+131,99,154,165,68,22,101,201,146,135,97,24,131,97,28,134,129,97,152,97,24,134,225,24,134,97,72,134,97,24,134,65,150,154,166,53,101,89,150,101,89,150,133,84,74,197,48,12,131,99,94,165,68,22,101,201,74,134,97,12,142,97,24,134,
+99,24,134,225,24,134,97,24,134,97,24,146,97,24,134,97,148,154,166,105,77,163,149,101,89,146,5,89,58,197,48,12,131,99,94,165,68,22,101,73,30,134,97,56,142,97,24,135,100,24,134,225,24,134,97,72,134,97,24,134,100,24,134,97,
+148,154,166,105,154,70,150,101,89,74,69,89,22,197,48,56,131,99,154,165,68,22,37,41,25,134,225,72,134,97,28,7,105,24,134,225,24,134,97,56,134,97,24,134,33,25,134,97,72,90,163,145,101,89,150,101,89,22,82,89,14,195,48,56,
+131,99,22,165,68,22,236,113,24,134,35,57,134,113,28,142,100,24,134,225,24,134,97,24,146,97,24,134,97,72,134,65,106,154,164,53,100,89,150,101,73,22,100,41,13,195,48,56,131,99,154,165,68,22,172,100,24,142,228,24,198,113,28,164,
+99,24,134,49,24,134,97,24,146,97,24,134,97,24,18,73,106,154,164,53,82,89,150,101,41,21,101,233,12,195,48,56,131,99,22,165,68,94,44,75,146,164,116,28,199,113,56,146,97,24,134,225,24,134,97,24,142,100,24,134,97,24,6,89,
+74,90,73,106,77,89,150,101,89,72,101,89,20,197,48,56,195,96,154,165,68,94,108,89,146,164,113,28,199,113,72,146,97,24,134,225,24,134,97,24,6,105,24,134,97,24,6,89,150,108,89,150,101,89,150,101,89,144,165,84,20,197,224,56,
+195,96,94,165,68,154,108,89,146,164,116,28,199,225,72,142,97,24,134,225,24,134,97,24,6,105,24,134,97,24,6,89,150,108,89,150,101,89,150,37,89,148,165,83,20,197,224,56,195,96,154,165,68,154,82,73,146,101,41,29,135,35,57,134,
+97,24,134,35,25,134,97,24,6,41,25,134,97,24,82,89,178,44,91,150,101,89,150,37,89,148,101,81,20,197,224,56,131,99,94,165,68,74,69,73,150,44,91,146,36,41,57,134,97,24,134,228,24,198,113,28,6,73,26,134,97,72,101,89,
+178,44,91,150,101,89,150,101,65,150,82,81,92,197,224,56,131,99,94,165,68,22,146,84,178,108,73,146,146,68,74,134,97,24,18,121,28,199,113,24,82,73,26,134,68,150,101,89,178,44,91,150,101,89,150,100,65,150,78,81,20,197,224,56,
+131,99,94,165,68,22,82,201,178,37,41,73,36,73,146,100,89,146,36,121,28,199,97,72,100,73,146,36,89,150,101,201,178,44,203,150,101,89,150,82,81,150,69,81,92,197,224,56,131,99,22,165,36,21,36,43,73,146,68,146,36,89,150,101,
+89,150,101,201,178,44,91,150,101,73,146,36,89,150,101,201,178,44,203,150,101,73,74,133,84,74,69,81,20,197,224,56,131,99,154,165,36,73,231,85,56,69,81,20,69,81,20,69,81,20,197,117,93,215,85,20,69,81,20,69,81,20,69,113,
+93,215,117,21,69,81,20,18,89,58,69,113,93,197,224,56,131,115,93,165,36,177,146,36,145,100,89,150,101,89,150,101,89,150,101,201,178,44,91,150,101,73,146,36,89,150,101,201,178,44,203,150,101,89,150,101,41,21,69,81,20,197,48,56,
+131,115,153,165,36,73,146,68,150,101,89,150,101,89,150,101,89,150,101,201,178,44,91,150,101,73,146,36,89,150,101,201,178,44,203,150,101,89,150,165,84,20,69,81,92,197,224,56,131,115,93,43,84,20,69,49,12,69,81,20,69,81,20,195,
+80,20,69,81,20,69,49,12,69,81,20,69,81,20,195,80,20,69,81,20,69,49,12,69,81,20,197,85,20,197,224,56,131,115,181,171,234,21,69,49,12,69,81,20,69,81,20,195,80,20,69,81,20,69,49,12,69,81,20,69,81,20,195,80,
+20,69,81,20,69,49,12,69,81,20,69,113,93,197,224,56,195,224,12,16,51,12,195,48,12,230,117,21,197,85,20,195,48,12,195,48,12,195,48,12,215,85,20,87,81,20,195,48,12,195,48,12,195,48,12,87,81,92,215,85,20,197,224,56,
+3,19,38,201,112,21,69,49,100,69,146,56,87,113,21,67,145,21,197,112,21,69,1,12,195,21,37,142,196,113,142,35,125,156,195,73,28,231,56,18,199,113,142,228,20,69,1,12,195,101,57,137,244,113,142,227,124,156,227,56,142,227,56,31,
+199,57,142,99,57,69,1,12,195,101,37,165,37,145,37,91,150,228,243,72,100,89,150,108,89,150,165,149,88,69,1,12,195,101,57,78,73,146,164,100,24,143,97,24,210,99,72,101,89,150,101,233,88,78,1,56,195,101,57,150,68,26,134,99,
+24,134,98,24,143,97,24,82,89,150,101,105,57,82,1,56,67,97,57,165,228,24,134,162,24,134,98,24,142,97,24,143,53,142,86,89,38,86,1,12,131,99,57,164,161,56,135,49,24,134,98,24,138,97,24,138,215,48,86,89,38,100,2,12,
+195,101,57,229,99,40,198,161,24,134,98,40,134,97,24,198,195,108,30,89,74,146,3,12,195,101,57,101,105,4,129,97,28,70,96,24,134,97,24,198,164,49,210,88,146,137,52,12,195,101,57,37,251,24,134,97,24,134,97,24,134,97,24,146,
+197,120,150,82,150,9,57,12,195,101,57,101,41,25,134,97,24,198,97,24,134,161,40,134,211,48,143,33,149,146,68,12,195,101,57,101,73,26,138,98,24,134,97,24,134,161,24,134,33,89,134,241,148,164,35,13,195,101,57,101,89,78,150,100,
+24,134,97,24,134,97,24,134,33,41,134,97,149,101,98,13,195,101,57,165,100,60,143,98,24,202,178,56,134,97,24,134,161,24,198,99,60,165,99,13,195,101,57,165,100,24,134,97,24,203,113,40,138,97,24,134,97,24,134,97,24,143,229,16,
+195,101,57,229,99,24,134,97,24,203,113,40,138,97,24,134,97,24,134,97,24,143,229,16,195,101,57,165,148,60,143,98,24,202,178,56,134,97,24,134,161,24,198,99,60,165,99,13,67,97,57,165,232,77,150,100,24,134,97,24,134,97,24,134,
+33,41,134,97,149,101,98,13,195,96,57,101,57,30,138,98,24,134,97,24,134,161,24,134,33,89,134,241,148,164,35,13,195,101,57,101,57,25,134,97,24,198,97,24,134,161,40,134,211,48,143,33,149,146,52,12,195,101,57,101,185,24,134,97,
+24,134,97,24,134,97,24,146,197,120,150,82,150,9,9,12,195,101,57,37,105,4,129,97,28,134,97,24,134,97,24,198,164,49,210,88,146,137,4,12,195,101,57,228,98,40,134,177,24,134,98,40,134,97,24,198,195,108,30,89,74,146,3,12,
+195,101,57,160,161,40,198,225,24,70,96,24,138,97,24,138,215,48,86,89,38,228,48,12,195,101,113,37,249,28,135,162,24,134,98,24,142,97,24,143,69,142,86,89,38,86,1,12,195,101,113,36,105,29,134,99,24,134,98,24,143,97,24,82,
+89,150,101,73,58,82,1,56,195,101,57,78,89,146,146,100,24,143,97,24,210,99,72,101,201,150,101,233,144,73,1,56,195,101,37,36,41,73,36,73,146,36,8,74,36,73,150,37,203,150,165,149,88,69,1,56,195,101,73,137,227,56,142,227,
+56,206,247,57,142,227,56,206,247,113,142,99,57,69,1,12,195,69,37,137,227,56,142,35,57,206,247,73,142,227,56,210,247,57,142,228,20,69,1,56,3,211,13,192,80,20,69,49,0,0,0,12,69,81,20,3,0,0,192,80,20,69,1,56,
+72,227,100,137,147,56,73,226,36,78,81,12,133,36,125,36,41,57,146,68,74,146,84,12,133,36,77,143,161,24,138,65,150,165,148,12,131,52,41,70,96,24,134,241,68,150,228,12,133,68,10,134,33,24,134,161,48,149,229,12,133,84,42,134,
+97,24,134,241,52,142,37,13,133,84,78,143,97,24,134,97,72,134,37,17,133,100,25,134,161,40,134,97,24,134,33,57,133,52,41,134,161,40,134,97,24,134,33,57,131,68,74,143,97,24,134,97,72,134,37,17,133,84,46,134,97,24,134,241,
+52,142,37,13,133,100,9,130,97,24,134,161,48,149,229,0,133,52,41,134,18,24,134,241,68,150,228,12,133,100,77,142,161,24,138,65,150,165,148,12,133,36,73,146,244,61,146,68,146,146,84,12,72,51,36,201,144,12,73,50,36,67,81,12,
+141,227,56,206,231,0,142,100,24,138,100,37,201,99,24,70,35,17,137,100,24,134,161,72,142,100,24,134,161,72,201,99,24,70,35,17,137,100,24,74,101,13,141,227,56,142,228,20,142,226,56,142,97,56,142,97,56,142,226,56,138,163,56,10,
+0,
+
+};
+
+// Runs of equal texels in every texture column (row of the transposed data)
+// Column i has the runs [eagle_run_offsets[i], eagle_run_offsets[i + 1]) in eagle_run_ends
+// Each entry is the exclusive end texel of a run, so a column's last run always ends at 64
+
+constexpr uint16_t eagle_run_offsets[64 + 1] = {
+0,34,71,109,133,153,177,208,238,275,305,340,370,400,436,473,509,543,575,609,644,673,708,742,775,806,832,858,878,915,946,972,993,1014,1041,1070,1107,1131,1158,1185,1214,1246,1279,1313,1343,1376,1409,1442,1476,1515,1551,1586,1614,1645,1677,1715,1753,1787,1814,1837,1856,1876,1896,1918,1941,
+
+};
+
+constexpr uint8_t eagle_run_ends[1941] = {
+1,2,3,4,5,6,12,13,15,16,17,20,21,24,25,32,38,40,41,42,43,46,47,48,49,50,51,52,53,54,56,61,63,64,
+2,3,4,5,6,7,9,10,11,12,13,19,20,21,22,25,28,29,30,32,34,36,38,40,41,42,49,50,51,52,53,54,56,60,61,62,64,
+1,2,4,5,6,7,8,9,10,12,13,17,20,21,22,23,25,26,27,28,30,31,32,36,38,39,40,41,42,43,49,50,51,52,53,61,63,64,
+1,2,3,4,5,7,8,10,12,22,25,29,30,40,43,53,54,57,58,59,60,61,62,64,
+1,2,3,4,5,9,10,12,15,22,25,29,30,40,43,54,55,61,63,64,
+1,2,4,5,7,8,9,11,12,14,17,23,25,39,46,52,53,55,56,58,59,61,63,64,
+1,2,3,4,5,7,8,9,11,13,14,16,20,22,25,29,30,40,43,50,51,52,53,54,55,56,58,60,61,63,64,
+1,2,3,4,5,6,7,8,9,10,11,16,18,22,23,24,26,31,32,33,40,43,52,53,54,56,57,61,62,64,
+1,2,4,5,6,7,8,9,10,11,13,17,19,20,21,23,24,25,26,32,33,34,35,37,38,39,40,43,52,53,54,55,56,57,61,62,64,
+1,2,3,4,5,6,7,8,9,10,11,12,14,19,22,24,25,26,27,33,35,39,40,53,54,55,57,61,62,64,
+1,2,4,5,6,7,8,9,10,11,12,13,14,15,17,18,20,24,25,26,27,33,34,35,40,41,53,54,55,57,59,60,61,62,64,
+1,2,3,4,5,6,7,8,9,10,12,13,14,16,18,21,26,27,33,34,41,42,53,54,55,57,58,61,62,64,
+1,2,3,4,5,6,7,8,9,10,11,13,14,17,19,21,26,27,33,34,41,42,54,55,56,57,58,61,62,64,
+1,3,4,5,6,7,8,9,10,12,14,15,18,19,21,26,27,32,33,34,41,42,43,44,45,46,47,48,49,54,55,56,58,61,63,64,
+1,4,5,6,7,8,9,10,11,12,13,15,16,19,20,21,22,26,27,32,33,40,41,43,45,46,47,48,49,54,55,56,58,59,61,63,64,
+1,4,5,6,7,8,9,10,13,14,15,16,20,22,26,27,32,33,39,40,42,43,45,46,47,48,49,54,55,56,57,58,59,61,63,64,
+1,2,4,5,6,7,8,10,11,14,15,16,17,21,22,26,27,31,32,38,39,43,44,45,46,47,48,55,56,57,59,61,63,64,
+2,3,4,5,6,7,8,9,10,11,15,17,18,21,22,26,27,31,32,37,38,43,44,50,51,55,56,57,59,61,63,64,
+1,2,3,4,5,6,7,8,9,11,12,15,16,17,20,21,22,26,27,36,37,43,44,48,50,51,55,56,57,58,59,60,63,64,
+1,2,3,4,5,6,7,8,10,11,12,16,17,18,19,20,22,24,25,30,31,35,36,42,43,44,47,48,56,57,58,59,60,63,64,
+1,2,3,4,5,6,7,8,10,12,13,20,21,25,26,34,35,41,42,44,47,50,51,52,56,57,58,60,64,
+1,2,3,4,5,6,7,8,10,12,13,14,15,16,33,34,40,41,43,44,45,46,47,48,49,50,51,52,56,57,58,59,60,61,64,
+1,2,3,4,5,6,7,8,11,12,13,26,27,32,33,38,39,41,42,43,45,46,47,48,49,50,52,53,57,58,59,60,61,64,
+1,2,3,4,5,6,7,8,11,12,13,14,27,28,31,32,36,37,38,42,43,44,45,46,48,49,52,53,57,58,59,61,64,
+1,2,3,4,5,6,7,8,11,12,13,14,18,19,27,28,30,31,35,36,37,44,45,48,49,53,57,58,59,61,64,
+1,2,3,4,5,6,7,8,11,12,14,15,17,18,36,37,45,47,48,53,58,59,60,61,62,64,
+1,2,3,4,5,6,7,8,14,15,16,17,18,19,35,36,45,47,52,53,58,59,60,61,62,64,
+1,2,3,4,5,6,7,8,20,21,44,45,46,51,52,58,59,60,62,64,
+1,2,3,4,5,6,7,8,11,13,14,17,18,19,20,21,24,25,27,28,29,30,31,32,44,45,51,52,53,54,55,58,59,60,61,62,64,
+1,2,3,4,5,6,7,8,11,12,24,25,26,27,28,29,30,31,32,41,42,50,51,55,56,59,60,61,62,63,64,
+1,2,3,4,5,6,7,8,11,12,24,25,26,29,30,31,32,33,56,57,59,60,61,62,63,64,
+1,2,3,4,5,6,7,8,11,24,25,29,32,33,57,58,59,60,61,63,64,
+1,2,3,4,5,6,7,8,11,24,25,31,32,33,57,58,59,60,61,63,64,
+1,2,3,4,5,6,7,8,11,12,13,24,25,26,29,30,31,32,33,56,57,59,60,61,62,63,64,
+1,2,4,5,6,7,8,11,24,25,26,27,28,29,30,31,32,41,42,50,51,55,56,59,60,61,62,63,64,
+1,2,3,4,5,6,7,8,11,14,15,17,18,19,20,21,24,25,27,28,29,30,31,32,44,45,51,52,53,54,55,58,59,60,61,62,64,
+1,2,3,4,5,6,7,8,11,12,13,14,20,21,44,45,46,51,52,58,59,60,62,64,
+1,3,4,5,6,7,8,11,13,14,15,16,17,18,19,35,36,45,47,52,53,58,59,60,61,62,64,
+1,2,3,4,5,6,7,8,12,13,14,15,16,17,18,36,37,45,47,48,53,58,59,60,61,62,64,
+1,3,4,5,6,7,8,13,14,16,18,19,27,28,30,31,35,36,37,44,45,48,49,53,57,58,59,61,64,
+1,2,4,5,6,7,8,13,14,15,27,28,31,32,36,37,38,42,43,44,45,46,48,49,52,53,57,58,59,60,61,64,
+1,2,3,4,5,6,7,8,13,14,26,27,32,33,38,39,41,42,43,45,46,47,48,49,50,52,53,57,58,59,60,61,64,
+1,2,4,5,6,7,8,11,12,13,14,15,16,33,34,40,41,43,44,45,46,47,48,49,50,51,52,56,57,58,59,60,61,64,
+1,2,3,4,5,6,7,8,11,12,13,20,21,25,26,34,35,41,42,44,47,50,51,52,56,57,58,60,61,64,
+1,2,4,5,6,7,8,10,11,12,13,16,17,19,20,22,25,30,31,35,36,42,43,44,47,48,56,57,58,59,60,61,64,
+1,2,3,4,5,6,7,8,10,11,12,15,16,17,21,22,26,27,36,37,43,44,48,50,51,55,56,57,58,59,60,61,64,
+1,2,3,4,5,6,7,8,10,11,12,15,17,20,21,22,26,27,31,32,37,38,43,44,50,51,55,56,57,59,61,63,64,
+1,2,4,5,6,7,8,9,10,11,14,15,16,19,21,22,26,27,31,32,38,39,43,44,45,46,47,48,55,56,57,59,63,64,
+1,2,3,4,5,6,7,8,9,11,13,14,15,16,18,20,21,22,26,27,32,33,39,40,42,43,45,46,47,48,49,54,55,56,57,58,59,63,64,
+1,2,4,5,6,7,8,9,10,12,13,14,15,17,20,21,22,26,27,32,33,40,41,43,45,46,47,48,49,54,55,56,58,59,63,64,
+1,2,3,4,5,6,7,8,10,13,14,19,20,21,26,27,32,33,34,41,42,43,44,45,46,47,48,49,54,55,56,58,61,63,64,
+2,4,5,6,7,8,9,11,13,14,19,21,26,27,33,34,41,42,44,45,54,55,56,57,58,61,62,64,
+2,3,4,5,6,7,8,9,11,13,14,18,19,20,21,26,27,33,34,41,42,44,45,53,54,55,57,58,61,62,64,
+2,4,5,6,7,8,9,10,12,14,15,17,18,19,20,25,26,27,33,34,35,40,41,43,46,53,54,55,57,61,62,64,
+1,2,3,4,5,6,7,8,9,10,11,12,14,15,18,19,20,25,26,27,29,32,33,35,39,40,43,46,53,54,55,56,57,59,60,61,62,64,
+1,2,3,4,5,6,7,8,10,11,13,14,16,18,19,20,24,25,26,31,32,33,34,35,37,38,39,43,46,52,53,54,55,56,57,61,62,64,
+1,2,3,4,5,6,7,8,9,10,12,13,14,16,21,23,26,30,31,32,33,34,38,42,47,52,53,54,56,59,60,61,62,64,
+1,2,3,4,5,7,8,9,10,14,18,26,30,34,38,42,47,50,51,52,53,54,55,56,61,62,64,
+1,2,4,5,8,9,10,11,12,25,30,42,47,52,53,54,55,56,58,60,61,62,64,
+1,2,4,5,7,8,11,13,26,30,34,38,42,47,54,55,61,63,64,
+1,2,3,4,5,10,11,26,30,34,38,42,47,53,54,59,60,61,62,64,
+1,2,4,5,6,10,12,20,22,30,32,40,42,50,52,57,58,61,62,64,
+1,2,3,4,5,6,7,10,12,20,22,30,32,40,42,50,52,58,60,61,62,64,
+2,3,4,5,6,12,13,15,17,18,20,32,34,36,37,40,52,53,55,58,61,62,64,
 
 };
 
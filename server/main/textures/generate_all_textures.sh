@@ -6,3 +6,4 @@ python generate_texture.py ~/Downloads/pics/bluestone.png
 python generate_texture.py ~/Downloads/pics/mossy.png
 python generate_texture.py ~/Downloads/pics/wood.png
 python generate_texture.py ~/Downloads/pics/colorstone.png
+python generate_texture.py ~/Downloads/pics/barrel.png
@@ -9,49 +9,34 @@ import pathlib
 from PIL import Image
 
 TEXEL_DATA_TYPE = "uint8_t"
-
-parser = argparse.ArgumentParser()
-parser.add_argument("texture_path", type=pathlib.Path, help="path to texture")
-args = parser.parse_args()
-
-in_texture = Image.open(args.texture_path)
-#print(in_texture.format, in_texture.size, in_texture.mode)
-
-R, G, B = in_texture.split()
-R = np.asarray(R)
-G = np.asarray(G)
-B = np.asarray(B)
-
-r = (R >> 6) << 6
-g = (G >> 5) << 3
-b = (B >> 5) << 0
-#r = (R >> 5) << 5
-#g = (G >> 5) << 2
-#b = (B >> 6) << 0
-P = r | g | b
-out_texture = Image.fromarray(np.uint8(P)).transpose(Image.Transpose.TRANSPOSE)
-
-#out_texture = in_texture.convert("L").transpose(Image.Transpose.TRANSPOSE)
-#print(out_texture.format, out_texture.size, out_texture.mode)
-
-texture_name = args.texture_path.stem
-output_path  = texture_name + ".hpp"
-texture_width, texture_height = out_texture.size
-
-comment = f"Generated by {os.path.basename(__file__)} on {datetime.datetime.today().isoformat()}"
+RUN_OFFSET_DATA_TYPE = "uint16_t"
+RUN_END_DATA_TYPE = "uint8_t"
+
+def quantize_rgb233(texture):
+    R, G, B = texture.split()
+    R = np.asarray(R)
+    G = np.asarray(G)
+    B = np.asarray(B)
+
+    r = (R >> 6) << 6
+    g = (G >> 5) << 3
+    b = (B >> 5) << 0
+    #r = (R >> 5) << 5
+    #g = (G >> 5) << 2
+    #b = (B >> 6) << 0
+    P = r | g | b
+    return Image.fromarray(np.uint8(P)).transpose(Image.Transpose.TRANSPOSE)
 
 FILE_HEAD = """
 #pragma once
 
-// {4}
+// {0}
 
 #include <cstdint>
 
 namespace textures
 {{
-
-constexpr {0} {1}[{2} * {3}] = {{
-""".format(TEXEL_DATA_TYPE, texture_name, texture_width, texture_height, comment)
+"""
 
 FILE_TAIL = """
 };
@@ -59,11 +44,97 @@ FILE_TAIL = """
 } // namespace textures
 """
 
-gray_data = list(out_texture.getdata())
-with open(output_path, "w") as out_file:
-    out_file.write(FILE_HEAD)
-    for i in range(texture_height):
-        out_file.write(",".join(map(str, gray_data[i * texture_width : (i + 1) * texture_width])) + ",\n")
-    out_file.write(FILE_TAIL)
-print(f"Saved {texture_width}x{texture_height} {TEXEL_DATA_TYPE} texture data to {output_path}")
+PALETTE_HEAD = """
+// Colors of all levels in rgb233, texels are indices into the palette packed in {1}_index_bits each
+constexpr auto {1}_index_bits = {2};
+
+constexpr {0} {1}_palette[{3}] = {{
+"""
+
+TEXELS_HEAD = """
+}};
+
+// Palette indices of the {2}x{3} texels followed by prefiltered mip levels 1 to {4} ({5}x{5} down to 1x1),
+// box-filtered from the source texture
+// Levels are transposed (stored column by column) and packed least significant bit first, with a byte of padding at the end
+
+constexpr uint8_t {1}_texels[{6}] = {{
+"""
+
+RUNS_HEAD = """
+}};
+
+// Runs of equal texels in every texture column (row of the transposed data)
+// Column i has the runs [{0}_run_offsets[i], {0}_run_offsets[i + 1]) in {0}_run_ends
+// Each entry is the exclusive end texel of a run, so a column's last run always ends at {1}
+
+constexpr {2} {0}_run_offsets[{3} + 1] = {{
+"""
+
+RUN_ENDS_HEAD = """
+}};
+
+constexpr {0} {1}_run_ends[{2}] = {{
+"""
 
+def find_run_ends(column):
+    return [i + 1 for i in range(len(column)) if i + 1 == len(column) or column[i + 1] != column[i]]
+
+def pack_indices(indices, index_bits):
+    bits = 0
+    num_bits = 0
+    packed = []
+    for index in indices:
+        bits |= index << num_bits
+        num_bits += index_bits
+        while num_bits >= 8:
+            packed.append(bits & 0xFF)
+            bits >>= 8
+            num_bits -= 8
+    if num_bits > 0:
+        packed.append(bits)
+    return packed + [0]
+
+# levels: transposed rgb233 texels of level 0 and every mip level, as (width, height, data)
+def write_texture(texture_name, levels):
+    texture_width, texture_height, texels = levels[0]
+    num_mip_levels = len(levels) - 1
+
+    palette = sorted(set(x for level in levels for x in level[2]))
+    index_bits = max(int(np.ceil(np.log2(len(palette)))), 1)
+    palette_indices = {x: i for i, x in enumerate(palette)}
+    packed = pack_indices([palette_indices[x] for level in levels for x in level[2]], index_bits)
+
+    output_path = texture_name + ".hpp"
+    comment = f"Generated by {os.path.basename(__file__)} on {datetime.datetime.today().isoformat()}"
+    with open(output_path, "w") as out_file:
+        out_file.write(FILE_HEAD.format(comment))
+        out_file.write(PALETTE_HEAD.format(TEXEL_DATA_TYPE, texture_name, index_bits, len(palette)))
+        out_file.write(",".join(map(str, palette)) + ",\n")
+
+        out_file.write(TEXELS_HEAD.format(TEXEL_DATA_TYPE, texture_name, texture_width, texture_height, num_mip_levels, texture_width // 2, len(packed)))
+        for i in range(0, len(packed), 64):
+            out_file.write(",".join(map(str, packed[i : i + 64])) + ",\n")
+
+        run_ends = [find_run_ends(texels[i * texture_width : (i + 1) * texture_width]) for i in range(texture_height)]
+        run_offsets = np.cumsum([0] + [len(x) for x in run_ends])
+
+        out_file.write(RUNS_HEAD.format(texture_name, texture_width, RUN_OFFSET_DATA_TYPE, texture_height))
+        out_file.write(",".join(map(str, run_offsets)) + ",\n")
+        out_file.write(RUN_ENDS_HEAD.format(RUN_END_DATA_TYPE, texture_name, run_offsets[-1]))
+        for x in run_ends:
+            out_file.write(",".join(map(str, x)) + ",\n")
+        out_file.write(FILE_TAIL)
+    print(f"Saved {texture_width}x{texture_height} texture data with {len(palette)} colors in {index_bits} bits to {output_path}")
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser()
+    parser.add_argument("texture_path", type=pathlib.Path, help="path to texture")
+    args = parser.parse_args()
+
+    in_texture = Image.open(args.texture_path)
+    #print(in_texture.format, in_texture.size, in_texture.mode)
+
+    num_mip_levels = int(np.log2(min(in_texture.size)))
+    textures = [quantize_rgb233(in_texture)] + [quantize_rgb233(in_texture.reduce(1 << level)) for level in range(1, num_mip_levels + 1)]
+    write_texture(args.texture_path.stem, [(x.size[0], x.size[1], list(x.getdata())) for x in textures])
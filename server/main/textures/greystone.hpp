@@ -1,78 +1,146 @@
 
 #pragma once
 
-// Generated by generate_texture.py on 2022-09-07T14:50:31.154972
+// Generated by generate_texture.py on 2026-10-16T14:06:49.994371
 
 #include <cstdint>
 
 namespace textures
 {
 
-constexpr uint8_t greystone[64 * 64] = {
-0,82,82,164,246,173,173,173,164,164,91,82,0,0,9,82,164,246,173,173,173,173,164,164,164,164,91,82,0,82,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,
-9,82,82,164,246,173,164,173,173,164,91,82,0,9,9,82,164,246,164,164,164,164,173,164,164,173,82,82,0,91,164,173,246,246,246,246,246,246,246,246,246,246,246,246,173,246,173,91,9,82,82,91,173,173,173,173,173,173,173,164,9,82,82,9,
-0,82,82,164,246,173,164,164,173,164,91,82,0,0,9,9,164,246,164,164,164,173,91,164,173,164,91,82,0,91,173,246,173,173,173,173,173,173,173,173,173,173,173,173,173,164,173,91,0,82,82,173,246,246,246,246,246,246,164,91,0,9,82,9,
-9,82,82,164,246,173,164,173,164,164,91,82,0,9,9,9,164,246,173,164,173,164,91,91,173,164,82,9,0,91,246,246,173,164,164,173,164,173,164,164,173,164,173,164,173,164,173,91,0,82,82,173,246,173,173,173,173,173,91,9,0,9,82,9,
-0,82,82,164,173,164,173,164,164,91,82,82,0,0,9,9,164,246,164,173,164,173,164,164,164,173,91,9,0,164,246,246,173,164,173,164,173,164,173,164,173,164,173,173,164,173,164,82,0,9,82,173,246,173,173,164,173,164,82,9,0,9,82,9,
-9,82,82,164,173,173,164,164,91,82,82,0,9,0,9,9,164,246,173,164,173,164,164,173,164,164,82,9,0,164,246,173,164,173,164,164,173,164,173,164,164,173,164,164,173,164,164,82,82,0,82,173,246,164,173,173,173,173,91,9,0,0,82,9,
-0,82,82,164,164,91,91,82,82,82,9,0,0,9,9,9,164,173,173,164,173,164,173,164,164,91,82,0,0,164,246,173,173,164,173,164,164,173,164,173,164,164,173,173,164,91,82,82,82,0,82,164,246,173,173,91,164,91,82,9,0,9,82,9,
-9,82,82,164,164,91,91,82,82,82,9,0,9,0,9,9,164,173,91,91,91,91,91,91,82,82,9,0,9,164,246,173,164,173,173,164,173,164,173,164,173,173,164,173,164,91,82,82,82,0,9,164,246,246,173,91,173,91,91,9,0,0,82,9,
-0,82,82,0,0,0,0,0,0,0,0,0,0,9,9,0,164,91,91,91,82,82,82,82,82,9,9,0,0,164,246,164,173,164,91,173,164,173,91,173,164,164,173,164,164,91,82,82,82,0,0,91,173,246,164,173,164,164,82,9,0,0,82,9,
-9,82,82,82,82,82,82,9,0,9,0,9,9,9,9,9,0,9,9,9,9,9,9,9,9,9,9,0,82,164,173,173,164,173,173,164,173,164,173,164,173,91,82,82,82,82,0,0,0,9,0,82,173,246,173,164,164,173,91,9,0,9,82,9,
-0,82,82,82,82,82,82,82,82,82,82,9,82,82,82,82,0,0,0,0,0,0,0,0,0,0,0,0,82,82,91,9,91,91,82,82,82,82,82,82,82,82,0,0,0,0,0,9,9,9,9,82,173,246,173,164,164,164,91,9,0,0,82,9,
-9,246,246,246,246,255,255,255,246,173,164,91,82,82,82,82,82,82,82,82,82,82,9,9,9,9,9,9,82,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,9,9,9,9,9,9,82,82,164,173,246,91,164,173,82,9,0,0,82,9,
-0,246,246,246,246,173,246,246,173,255,246,246,246,173,164,91,82,82,82,82,82,82,82,164,246,246,246,246,246,246,246,255,255,255,246,246,246,173,164,91,82,82,82,9,82,82,82,9,82,9,9,9,91,173,246,173,173,173,91,9,0,9,9,9,
-9,246,246,246,173,164,173,164,173,173,164,173,246,246,246,246,246,164,91,82,82,82,82,246,246,164,173,164,173,173,173,164,164,164,173,173,246,246,246,246,255,255,255,255,246,246,173,164,91,9,9,9,82,173,246,164,164,164,82,9,0,0,9,9,
-0,246,246,173,173,173,164,164,164,164,173,164,164,164,173,164,173,173,164,164,91,0,82,246,173,164,173,173,164,91,173,164,173,164,173,91,164,91,164,173,164,173,164,164,173,164,173,164,91,9,0,0,82,173,246,173,164,164,91,9,0,0,9,9,
-9,246,173,246,164,173,173,164,173,173,164,164,164,173,164,173,164,164,173,164,82,9,9,246,164,164,173,164,164,164,164,173,164,164,173,164,164,173,91,164,164,164,164,173,173,164,164,173,82,9,0,0,82,173,246,164,173,91,91,9,0,9,9,9,
-0,246,246,173,173,173,164,173,164,164,164,91,164,164,173,164,164,173,164,91,82,0,0,246,164,173,164,173,173,164,91,91,173,173,164,91,173,164,173,173,164,164,173,91,164,173,164,164,91,9,0,9,9,173,246,173,91,173,82,9,0,0,9,9,
-9,246,246,246,164,173,173,173,173,164,91,91,164,91,164,164,164,164,173,91,82,9,0,246,164,173,173,173,164,173,164,164,173,164,164,173,164,164,173,164,164,91,164,164,173,164,173,164,91,9,0,0,9,173,246,164,91,91,91,9,0,9,9,9,
-0,246,246,246,173,164,164,164,164,164,164,91,164,164,164,173,164,91,173,91,82,0,0,173,173,164,164,164,173,164,173,173,164,173,164,173,164,164,164,164,173,164,164,164,164,173,164,164,82,9,0,0,9,173,246,173,164,164,82,9,0,0,9,9,
-9,246,246,173,173,173,164,164,164,164,164,173,164,173,91,164,164,164,164,91,82,0,0,173,164,164,173,91,91,164,164,164,173,164,173,164,164,173,164,173,164,173,164,173,164,164,164,91,91,9,0,9,9,164,246,173,173,91,91,9,0,0,9,9,
-0,246,246,246,173,164,164,91,164,164,173,164,164,164,164,173,91,164,173,82,82,0,0,164,164,173,82,82,82,91,91,91,91,91,91,82,82,91,91,91,91,91,91,91,82,91,91,91,82,9,0,0,9,164,246,164,91,164,82,9,0,9,9,9,
-9,246,246,246,173,173,164,164,164,164,164,164,173,164,91,164,164,164,91,82,82,0,0,82,9,0,0,0,0,9,9,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,0,0,9,164,246,173,164,164,91,9,0,0,9,9,
-0,246,173,173,164,164,164,164,164,164,173,164,91,164,164,173,164,173,164,91,9,0,0,9,82,82,82,82,9,0,0,0,0,0,0,0,0,0,0,0,0,0,9,9,9,9,9,9,9,9,0,9,9,164,246,164,164,173,91,9,0,0,9,9,
-9,246,246,173,173,173,164,173,164,173,164,91,164,164,173,164,164,164,91,82,0,0,0,82,82,82,82,82,82,82,82,82,9,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,91,246,173,164,164,82,9,0,9,9,9,
-0,246,246,246,173,173,173,164,173,164,173,164,173,164,164,173,164,91,82,91,0,0,82,91,91,164,164,164,164,164,164,91,82,82,82,82,82,9,9,0,9,0,0,0,0,0,0,0,0,0,0,9,9,91,246,173,173,173,91,9,0,0,9,9,
-9,246,246,164,91,91,164,82,91,82,91,91,164,91,82,82,91,164,91,82,0,0,82,91,246,246,255,255,255,255,246,246,246,173,164,91,82,82,82,82,82,9,9,0,0,0,0,0,0,0,0,0,9,91,246,173,164,164,82,9,0,0,9,9,
-0,246,164,82,82,82,82,82,82,91,82,91,82,82,82,91,82,91,82,82,0,0,82,173,255,246,173,164,164,173,173,246,246,255,255,246,173,164,82,82,82,91,91,91,91,91,82,0,9,0,9,9,9,91,173,246,173,173,91,9,0,9,9,9,
-9,0,0,0,0,0,0,0,0,0,9,9,9,9,9,82,82,82,82,0,0,0,82,173,246,164,164,173,164,164,164,173,173,173,173,173,246,173,164,9,82,91,246,246,246,173,246,173,173,164,164,82,82,91,173,246,164,164,82,9,0,0,9,9,
-0,9,9,9,9,9,9,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,82,173,246,173,173,164,173,164,164,164,173,173,173,173,173,173,164,0,9,91,173,246,246,246,246,246,246,246,164,82,82,82,173,246,173,173,91,9,0,0,9,9,
-9,164,164,173,164,82,82,82,82,9,9,9,9,0,9,0,0,0,0,0,0,0,82,246,246,164,164,164,164,164,173,164,164,164,164,164,164,164,82,9,9,91,246,255,173,173,173,246,246,173,91,9,82,82,173,246,173,173,82,9,0,9,9,9,
-0,173,246,246,173,173,91,82,82,82,82,82,9,9,9,82,82,82,82,9,0,9,82,246,173,173,91,173,164,91,164,91,164,164,173,91,173,91,82,0,9,91,173,255,246,164,164,173,164,173,91,9,9,82,173,246,173,164,91,9,0,0,9,9,
-9,173,173,173,164,164,164,164,82,9,9,82,91,173,173,173,173,173,173,164,164,9,164,246,173,164,173,164,91,164,173,164,173,164,164,164,164,91,82,0,9,91,246,255,173,164,164,173,164,164,91,0,9,82,173,173,91,91,82,9,0,0,9,9,
-0,246,164,164,164,173,164,173,91,9,0,82,173,173,246,255,255,246,246,164,91,82,164,246,246,164,173,164,164,91,91,91,164,91,164,164,173,82,9,0,9,91,173,255,246,164,164,164,173,164,91,9,9,82,164,164,91,82,82,9,0,9,9,9,
-9,246,173,173,164,173,173,173,9,9,0,82,173,246,173,173,164,173,173,91,9,9,164,246,173,173,164,91,91,164,91,91,173,164,164,164,164,82,0,0,82,91,246,255,173,164,173,164,164,173,91,0,9,9,82,9,0,0,9,9,0,0,9,9,
-0,246,164,164,173,164,164,164,9,9,0,91,246,246,173,164,164,173,164,164,9,0,173,246,246,164,164,164,164,173,164,173,91,91,164,164,173,82,0,9,82,91,246,246,246,164,164,164,173,164,91,9,9,82,82,82,9,9,0,0,0,9,9,9,
-9,246,164,173,173,164,173,164,9,9,0,91,246,173,164,164,173,164,91,91,9,0,173,246,173,173,164,173,164,91,91,164,91,91,173,164,164,82,0,0,82,91,173,246,173,164,164,164,164,173,91,0,9,9,82,82,82,82,9,0,0,0,9,9,
-0,246,164,164,173,164,173,164,9,9,0,164,255,164,164,173,173,164,91,9,0,0,164,246,246,164,173,164,164,164,164,173,164,173,164,164,164,9,0,9,9,91,246,255,173,173,164,91,164,91,173,82,0,9,9,82,82,82,82,82,82,9,9,9,
-9,246,164,173,173,164,164,164,9,9,0,173,246,173,164,164,164,173,91,9,0,0,164,246,173,164,164,164,173,164,173,164,173,164,173,164,91,9,0,0,82,91,173,255,246,164,164,164,173,164,164,91,82,0,9,82,173,246,246,173,9,82,82,9,
-0,173,164,164,164,173,173,173,9,0,0,164,246,164,164,173,173,164,91,9,0,0,164,246,246,164,173,164,164,173,164,164,91,91,82,82,82,9,0,0,82,91,246,246,173,173,173,164,164,164,173,91,82,9,9,82,246,173,173,173,82,82,82,9,
-9,246,164,173,164,91,91,91,9,9,9,173,246,173,164,164,164,173,82,9,0,9,91,164,91,91,82,82,82,82,82,82,82,82,82,9,9,9,0,9,82,91,173,255,173,173,164,173,91,164,173,91,82,0,9,9,246,173,173,173,9,9,82,9,
-0,173,173,164,91,82,9,9,9,0,0,173,164,164,164,173,164,164,82,9,0,0,82,91,82,82,82,82,82,82,9,9,9,9,0,0,0,0,0,0,82,164,246,255,246,164,164,164,91,91,164,164,82,9,9,9,164,246,173,173,82,9,82,9,
-9,164,82,82,82,82,9,9,0,0,9,164,91,91,82,82,82,82,82,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,9,9,9,9,82,164,173,255,173,164,164,164,164,164,164,91,82,0,9,9,91,246,173,164,91,0,9,9,
-0,82,9,9,9,9,9,9,0,0,0,91,82,9,9,9,9,9,9,9,0,9,9,9,9,9,9,9,9,9,9,9,9,82,9,82,82,9,82,82,82,164,246,255,173,164,173,164,164,164,91,91,82,9,9,0,82,246,173,82,82,0,9,9,
-9,0,0,0,0,0,0,0,9,82,82,9,0,0,0,0,0,0,0,0,0,0,91,91,164,164,164,164,164,164,164,164,164,164,164,164,91,82,82,82,82,164,246,255,173,173,173,173,164,164,164,91,82,0,9,9,82,246,173,164,91,0,9,9,
-0,82,9,9,9,9,9,9,9,82,82,82,82,9,9,9,9,9,9,82,82,164,173,246,246,255,255,255,255,255,246,246,246,246,246,246,173,9,82,82,82,173,246,246,173,173,164,164,173,91,164,91,82,9,9,9,82,173,173,164,91,0,9,9,
-9,82,91,164,164,164,164,164,91,82,82,82,82,9,0,82,91,173,246,246,246,246,246,246,173,173,173,164,173,164,164,173,164,173,164,164,91,9,82,82,91,173,255,246,164,173,164,91,164,173,164,91,82,0,0,9,82,82,82,91,82,0,9,9,
-0,82,164,246,246,246,246,246,246,246,246,173,164,9,0,82,173,246,246,173,173,173,173,164,164,164,173,173,173,173,164,164,173,173,164,173,82,9,82,82,91,173,255,246,164,164,164,164,173,164,91,91,82,9,0,9,82,82,82,82,82,9,9,9,
-9,82,164,246,246,173,173,173,246,246,173,164,91,9,9,82,246,246,173,164,173,173,164,173,164,173,164,164,164,173,173,164,164,164,173,82,9,9,82,82,91,246,255,246,164,91,164,164,164,164,164,91,82,0,9,9,82,82,91,173,246,82,82,9,
-0,82,164,246,173,173,164,173,164,164,164,91,91,9,0,82,246,173,164,164,164,164,91,91,91,82,82,82,82,82,82,82,82,82,82,82,9,9,82,82,91,173,255,173,164,164,164,173,164,91,164,91,82,9,0,9,82,173,246,173,164,82,82,9,
-9,82,164,246,246,164,173,164,173,164,173,91,82,9,0,82,82,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,82,82,82,91,246,255,173,173,164,164,164,173,164,173,91,82,0,9,9,82,246,164,164,164,82,0,9,
-0,82,164,246,173,173,164,164,164,164,164,91,82,9,9,0,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,0,82,82,91,173,255,173,164,173,91,164,164,164,164,91,82,0,0,9,9,246,173,173,164,82,0,9,
-9,82,164,246,246,164,164,91,164,164,173,82,82,9,0,82,82,91,164,164,164,164,164,164,91,82,0,9,9,82,173,246,246,246,246,246,173,91,0,82,91,246,255,246,173,173,164,173,164,164,173,91,82,0,9,9,82,246,173,164,173,82,0,9,
-0,82,91,173,246,173,164,173,164,164,164,91,82,9,0,82,91,246,246,246,246,246,246,173,246,164,9,0,9,9,246,164,164,173,173,173,173,82,0,82,91,173,255,173,164,164,164,164,91,164,164,91,82,0,0,9,82,246,164,173,173,82,0,9,
-9,82,91,173,246,173,164,164,91,164,164,82,82,9,9,82,164,246,246,173,173,164,173,173,164,91,9,0,9,82,246,164,164,173,164,164,164,82,0,82,91,173,255,173,164,164,164,91,164,173,164,91,82,0,9,9,82,246,173,173,164,82,0,9,
-0,82,91,173,246,164,164,91,164,164,164,82,9,9,0,82,164,246,173,173,164,173,164,164,173,82,82,0,9,82,173,173,173,164,173,173,173,82,0,9,91,246,255,173,164,173,164,91,164,164,173,91,82,0,0,9,9,246,164,173,164,82,0,9,
-9,82,82,164,246,164,173,164,164,164,91,82,9,0,9,82,164,246,173,164,164,164,164,164,164,82,82,0,9,82,164,246,173,164,173,164,164,82,0,9,91,173,255,246,173,164,173,164,164,91,164,91,82,0,9,9,82,246,173,164,173,82,0,9,
-0,82,82,164,246,164,164,173,173,164,91,82,9,0,9,82,164,246,173,173,164,173,164,173,164,82,82,0,9,82,82,246,164,173,164,173,164,82,0,9,91,246,246,173,164,173,164,91,173,164,164,91,82,0,0,9,82,246,164,173,164,82,0,9,
-9,82,82,164,246,173,164,164,164,173,91,82,9,0,9,82,164,246,173,164,164,164,164,164,164,82,82,0,9,82,82,246,164,173,164,164,173,82,0,9,91,173,246,173,173,173,173,164,164,164,164,91,82,0,9,9,9,246,173,164,164,82,0,9,
-0,82,82,164,246,164,164,173,164,164,82,82,9,0,9,82,164,246,173,173,164,173,164,173,164,91,82,0,0,82,82,246,173,164,173,164,164,82,0,9,91,246,246,246,164,164,164,164,91,164,164,91,82,0,0,9,82,173,164,173,173,82,0,9,
-9,82,82,164,246,173,164,173,91,173,82,82,0,0,9,82,164,246,173,164,164,164,164,164,164,91,82,0,9,82,82,246,164,173,164,173,164,82,0,9,91,173,246,173,173,164,173,164,164,91,164,91,82,0,9,9,82,164,173,164,164,82,0,9,
-0,82,82,164,246,164,173,164,173,173,91,82,9,0,9,82,164,246,173,164,91,164,91,91,173,91,82,0,0,82,82,246,164,164,173,164,173,82,0,9,91,246,164,91,91,91,91,91,91,91,91,91,82,0,9,9,82,91,246,173,164,82,0,9,
-9,82,82,164,246,173,164,91,173,164,82,82,0,0,9,82,164,246,173,164,164,164,91,91,164,91,82,9,0,9,82,164,164,82,82,82,82,82,0,9,91,91,91,82,82,82,82,82,82,82,82,82,0,0,9,82,82,82,164,82,82,82,0,9,
-0,82,82,164,246,164,164,173,91,173,91,82,9,0,9,82,164,246,173,164,164,164,164,164,173,164,82,9,0,9,82,9,9,9,9,9,9,9,0,9,9,9,0,0,9,0,9,0,0,0,0,0,9,9,82,82,82,82,0,0,0,0,0,9,
-9,82,82,164,246,164,164,164,164,164,82,82,0,0,9,9,164,246,173,164,164,164,164,164,164,164,82,82,0,9,82,82,82,82,82,82,9,9,9,9,82,82,82,82,9,9,9,9,9,9,9,9,9,9,82,82,82,82,82,82,82,82,82,9,
+// Colors of all levels in rgb233, texels are indices into the palette packed in greystone_index_bits each
+constexpr auto greystone_index_bits = 4;
+
+constexpr uint8_t greystone_palette[11] = {
+0,9,18,82,91,100,164,173,182,246,255,
+
+};
+
+// Palette indices of the 64x64 texels followed by prefiltered mip levels 1 to 6 (32x32 down to 1x1),
+// box-filtered from the source texture
+// Levels are transposed (stored column by column) and packed least significant bit first, with a byte of padding at the end
+
+constexpr uint8_t greystone_texels[2732] = {
+48,99,121,119,102,52,0,49,150,119,119,102,102,52,48,68,68,68,68,68,68,68,52,51,51,51,51,51,51,51,51,19,49,99,121,118,103,52,16,49,150,102,102,103,118,51,64,118,153,153,153,153,153,153,151,71,49,67,119,119,119,103,49,19,
+48,99,121,102,103,52,0,17,150,102,118,100,103,52,64,151,119,119,119,119,119,119,103,71,48,115,153,153,153,70,16,19,49,99,121,118,102,52,16,17,150,103,103,68,103,19,64,153,103,118,118,102,103,103,103,71,48,115,121,119,119,20,16,19,
+48,99,103,103,70,51,0,17,150,118,118,102,118,20,96,153,103,103,103,103,103,119,118,54,16,115,121,103,103,19,16,19,49,99,119,102,52,3,1,17,150,103,103,118,102,19,96,121,118,102,103,103,118,102,103,54,3,115,105,119,119,20,0,19,
+48,99,70,52,51,1,16,17,118,103,103,103,70,3,96,121,103,103,118,118,102,119,70,51,3,99,121,71,70,19,16,19,49,99,70,52,51,1,1,17,118,68,68,68,51,1,97,121,118,103,103,103,119,118,70,51,3,97,153,71,71,20,0,19,
+48,3,0,0,0,0,16,1,70,68,51,51,19,1,96,105,103,116,118,116,102,103,70,51,3,64,151,118,102,19,0,19,49,51,51,19,16,16,17,17,16,17,17,17,17,1,99,119,118,103,103,103,71,51,51,0,16,48,151,103,118,20,16,19,
+48,51,51,51,51,19,51,51,0,0,0,0,0,0,51,20,68,51,51,51,51,0,0,16,17,49,151,103,102,20,0,19,145,153,169,170,121,70,51,51,51,51,51,17,17,17,3,0,0,0,0,0,0,16,17,17,17,51,118,73,118,19,0,19,
+144,153,121,153,167,153,121,70,51,51,51,99,153,153,153,169,170,153,121,70,51,19,51,19,19,17,116,121,119,20,16,17,145,153,103,103,119,118,153,153,105,52,51,147,105,103,119,103,102,119,153,153,170,170,153,103,20,17,115,105,102,19,0,17,
+144,121,119,102,102,103,102,103,119,102,4,147,103,119,70,103,103,71,70,118,118,102,103,103,20,0,115,121,102,20,0,17,145,151,118,103,119,102,118,118,102,103,19,145,102,103,102,118,102,103,118,100,102,118,103,118,19,0,115,105,71,20,16,17,
+144,121,119,118,102,70,102,103,118,70,3,144,118,118,103,68,119,70,103,119,102,71,118,102,20,16,113,121,116,19,0,17,145,153,118,119,103,68,70,102,102,71,19,144,118,119,118,102,103,118,102,103,70,102,103,103,20,0,113,105,68,20,16,17,
+144,153,103,102,102,70,102,118,70,71,3,112,103,102,103,119,118,118,102,102,103,102,118,102,19,0,113,121,102,19,0,17,145,121,119,102,102,118,118,100,102,70,3,112,102,71,100,102,103,103,118,118,118,118,102,70,20,16,97,121,71,20,0,17,
+144,153,103,70,102,103,102,118,100,55,3,96,118,51,67,68,68,52,67,68,68,68,67,68,19,0,97,105,100,19,16,17,145,153,119,102,102,102,103,100,102,52,3,48,1,0,16,49,51,51,51,51,51,51,51,51,19,0,97,121,102,20,0,17,
+144,119,102,102,102,103,100,118,118,70,1,16,51,51,1,0,0,0,0,0,0,17,17,17,17,16,97,105,118,20,0,17,145,121,119,118,118,70,102,103,102,52,0,48,51,51,51,51,1,1,0,0,0,0,0,0,0,0,65,121,102,19,16,17,
+144,153,119,103,103,103,103,118,70,67,0,67,100,102,102,70,51,51,19,1,1,0,0,0,0,16,65,121,119,20,0,17,145,105,68,54,52,68,70,51,100,52,0,67,153,170,170,153,121,70,51,51,19,1,0,0,0,0,65,121,102,19,0,17,
+144,54,51,51,67,67,51,67,67,51,0,115,154,103,118,151,169,154,103,51,67,68,68,3,1,17,65,151,119,20,16,17,1,0,0,0,0,17,17,49,51,3,0,115,105,118,102,118,119,119,121,22,67,153,121,121,103,54,67,151,102,19,0,17,
+16,17,17,17,0,0,0,0,0,0,0,115,121,103,103,102,119,119,119,6,65,151,153,153,153,54,51,151,119,20,0,17,97,118,54,51,19,17,1,1,0,0,0,147,105,102,102,103,102,102,102,19,65,169,119,151,121,20,51,151,119,19,16,17,
+112,153,119,52,51,51,17,49,51,19,16,147,119,116,70,70,102,71,71,3,65,167,105,118,118,20,49,151,103,20,0,17,113,119,102,102,19,49,116,119,119,103,22,150,103,103,100,103,103,102,70,3,65,169,103,118,102,4,49,119,68,19,0,17,
+144,102,118,118,20,48,119,169,154,105,52,150,105,103,70,68,70,102,55,1,65,167,105,102,103,20,49,102,52,19,16,17,145,119,118,119,17,48,151,119,118,71,17,150,119,70,100,68,103,102,54,0,67,169,103,103,118,4,17,19,0,17,0,17,
+144,102,103,102,17,64,153,103,118,102,1,151,105,102,118,118,68,102,55,16,67,153,105,102,103,20,49,51,17,0,16,17,145,118,103,103,17,64,121,102,103,68,1,151,119,118,70,100,68,103,54,0,67,151,103,102,118,4,17,51,51,1,0,17,
+144,102,103,103,17,96,106,118,103,20,0,150,105,103,102,118,118,102,22,16,65,169,119,70,70,55,16,49,51,51,19,17,145,118,103,102,17,112,121,102,118,20,0,150,103,102,103,103,103,103,20,0,67,167,105,102,103,70,3,49,151,121,49,19,
+112,102,118,119,1,96,105,118,103,20,0,150,105,103,118,102,68,51,19,0,67,153,119,103,102,71,19,49,121,119,51,19,145,118,70,68,17,113,121,102,118,19,16,100,68,51,51,51,51,19,17,16,67,167,119,118,100,71,3,17,121,119,17,19,
+112,103,52,17,1,112,102,118,102,19,0,67,51,51,51,17,17,0,0,0,99,169,105,102,68,102,19,17,150,119,19,19,97,51,51,17,0,97,68,51,51,19,0,0,0,0,0,0,0,1,17,17,99,167,103,102,102,70,3,17,148,103,4,17,
+48,17,17,17,0,64,19,17,17,17,16,17,17,17,17,17,49,49,19,51,99,169,103,103,102,68,19,1,147,55,3,17,1,0,0,0,49,19,0,0,0,0,0,68,102,102,102,102,102,102,52,51,99,169,119,119,102,70,3,17,147,103,4,17,
+48,17,17,17,49,51,19,17,17,49,99,151,169,170,170,153,153,153,23,51,115,153,119,102,71,70,19,17,115,103,4,17,49,100,102,102,52,51,19,48,116,153,153,153,119,103,103,118,118,102,20,51,116,154,118,70,118,70,3,16,51,67,3,17,
+48,150,153,153,153,121,22,48,151,121,119,103,102,119,119,102,119,118,19,51,116,154,102,102,103,68,19,16,51,51,19,17,49,150,121,119,153,103,20,49,153,103,119,118,118,102,118,103,102,55,17,51,148,154,70,102,102,70,3,17,51,116,57,19,
+48,150,119,118,102,70,20,48,121,102,102,68,52,51,51,51,51,51,17,51,116,122,102,118,70,70,19,16,115,121,54,19,49,150,105,103,103,71,19,48,3,0,0,0,0,0,0,0,0,0,49,51,148,122,103,102,103,71,3,17,147,102,54,16,
+48,150,119,102,102,70,19,1,51,51,51,51,51,51,51,51,51,51,1,51,116,122,118,100,102,70,3,16,145,119,54,16,49,150,105,70,102,55,19,48,67,102,102,102,52,16,49,151,153,153,71,48,148,154,119,118,102,71,3,17,147,103,55,16,
+48,116,121,118,102,70,19,48,148,153,153,121,105,1,17,105,118,119,55,48,116,122,102,102,100,70,3,16,147,118,55,16,49,116,121,102,100,54,19,49,150,121,103,119,70,1,49,105,118,102,54,48,116,122,102,70,118,70,3,17,147,119,54,16,
+48,116,105,70,102,54,17,48,150,119,118,102,55,3,49,119,103,119,55,16,148,122,118,70,102,71,3,16,145,118,54,16,49,99,105,103,102,52,1,49,150,103,102,102,54,3,49,150,103,103,54,16,116,154,103,103,70,70,3,17,147,103,55,16,
+48,99,105,118,103,52,1,49,150,119,118,118,54,3,49,147,118,118,54,16,148,121,118,70,103,70,3,16,147,118,54,16,49,99,121,102,118,52,1,49,150,103,102,102,54,3,49,147,118,102,55,16,116,121,119,103,102,70,3,17,145,103,54,16,
+48,99,105,118,102,51,1,49,150,119,118,118,70,3,48,147,103,103,54,16,148,153,102,102,100,70,3,16,115,118,55,16,49,99,121,118,116,51,0,49,150,103,102,102,70,3,49,147,118,118,54,16,116,121,103,103,70,70,3,17,99,103,54,16,
+48,99,105,103,119,52,1,49,150,103,100,68,71,3,48,147,102,103,55,16,148,70,68,68,68,68,3,17,67,121,54,16,49,99,121,70,103,51,0,49,150,103,102,68,70,19,16,99,54,51,51,16,68,52,51,51,51,51,0,49,51,54,51,16,
+48,99,105,118,116,52,1,49,150,103,102,102,103,19,16,19,17,17,17,16,17,0,1,1,0,0,17,51,51,0,0,16,49,99,105,102,102,51,0,17,150,103,102,102,102,51,16,51,51,51,17,17,51,51,17,17,17,17,17,51,51,51,51,19,
+65,103,54,16,103,102,54,65,102,102,102,69,49,68,68,17,65,103,54,16,103,70,38,113,102,102,102,86,65,119,55,16,65,102,20,16,103,102,22,115,102,102,102,70,64,103,22,16,65,52,3,16,70,68,3,115,102,102,102,52,49,87,20,16,
+17,1,0,0,34,17,1,115,86,86,69,19,16,103,22,16,99,102,52,51,17,1,0,17,17,17,1,0,17,103,22,16,148,119,119,103,52,67,119,119,119,103,86,70,17,116,22,16,116,102,102,102,102,65,102,100,86,85,102,102,1,116,37,16,
+116,102,70,100,70,65,102,70,86,102,84,102,2,116,20,16,116,102,86,86,68,49,86,101,102,102,102,70,1,115,21,16,148,70,102,86,68,17,19,33,51,51,51,51,1,115,20,16,116,102,86,100,70,0,51,17,0,0,0,0,0,114,22,16,
+116,69,68,69,52,48,118,103,52,17,1,0,0,114,22,16,17,17,17,33,19,64,103,118,119,55,99,69,35,114,22,16,49,18,0,0,0,64,103,102,102,22,130,119,55,115,23,16,115,70,17,66,68,97,86,84,86,20,130,102,22,113,20,16,
+100,102,17,119,103,113,87,68,101,4,130,102,22,49,17,16,100,102,17,103,70,112,103,85,100,4,115,102,22,49,1,16,100,102,49,103,38,112,102,102,102,2,130,71,69,16,68,17,100,85,48,103,22,96,69,68,19,1,131,103,84,17,119,17,
+67,19,48,68,20,16,17,1,0,0,132,102,68,17,102,17,0,0,16,0,0,32,51,51,51,50,148,102,70,1,86,17,33,51,50,17,66,118,119,119,119,50,148,70,69,1,67,17,113,119,121,18,119,103,102,102,86,49,149,100,70,1,67,19,
+113,103,70,17,52,19,17,17,17,49,133,102,69,1,100,20,113,71,70,1,67,68,19,65,102,18,133,86,70,1,100,4,81,103,68,17,118,119,6,113,102,20,133,70,69,1,102,4,65,87,54,16,103,102,20,113,102,4,133,86,68,1,100,4,
+65,103,54,16,103,102,20,97,102,4,117,86,70,1,100,4,65,103,53,16,103,102,20,97,102,4,117,102,68,1,100,4,65,87,54,16,103,68,20,64,68,3,68,51,51,16,99,3,65,103,53,16,103,102,22,16,17,1,17,0,0,49,19,17,
+115,4,86,68,102,70,98,20,67,1,86,67,102,70,98,4,51,17,17,48,51,18,97,4,102,102,52,102,102,85,97,4,102,84,20,85,101,85,81,3,86,85,4,17,17,17,64,3,52,51,19,103,54,18,65,4,52,17,49,86,53,117,68,4,
+100,113,70,70,20,101,20,1,84,97,52,69,20,101,20,22,17,33,1,17,17,102,20,22,83,20,101,119,22,87,20,19,100,20,51,17,19,87,4,21,99,20,103,67,38,87,4,21,99,4,102,51,22,86,4,21,99,4,70,19,19,18,17,19,
+20,69,86,36,68,66,52,19,86,51,51,18,35,98,68,20,69,84,83,18,34,67,99,50,52,36,99,66,36,54,67,49,67,52,68,36,67,36,67,52,52,52,4,0,
+
+};
+
+// Runs of equal texels in every texture column (row of the transposed data)
+// Column i has the runs [greystone_run_offsets[i], greystone_run_offsets[i + 1]) in greystone_run_ends
+// Each entry is the exclusive end texel of a run, so a column's last run always ends at 64
+
+constexpr uint16_t greystone_run_offsets[64 + 1] = {
+0,22,59,99,150,204,252,298,343,381,419,441,465,497,532,580,623,670,713,752,792,827,854,884,913,946,983,1023,1055,1081,1113,1160,1203,1250,1294,1333,1378,1421,1470,1509,1551,1587,1618,1649,1675,1705,1748,1783,1826,1866,1902,1934,1980,2026,2076,2126,2178,2233,2277,2325,2376,2425,2463,2500,2521,
+
+};
+
+constexpr uint8_t greystone_run_ends[2521] = {
+1,3,4,5,8,10,11,12,14,15,16,17,18,22,26,27,28,29,30,45,63,64,
+1,3,4,5,6,7,9,10,11,12,13,15,16,17,18,22,23,25,26,28,29,30,31,32,44,45,46,47,48,49,51,52,59,60,61,63,64,
+1,3,4,5,6,8,9,10,11,12,14,16,17,18,21,22,23,24,25,26,27,28,29,30,31,32,45,46,47,48,49,51,52,58,59,60,61,62,63,64,
+1,3,4,5,6,7,8,10,11,12,13,16,17,18,19,20,21,22,24,25,26,27,28,29,30,32,33,35,36,37,38,40,41,42,43,44,45,46,47,48,49,51,52,53,58,59,60,61,62,63,64,
+1,3,4,5,6,7,9,10,12,14,16,17,18,19,20,21,22,25,26,27,28,29,30,32,33,34,35,36,37,38,39,40,41,42,44,45,46,47,48,49,50,51,52,53,55,56,57,58,59,60,61,62,63,64,
+1,3,4,6,8,9,11,12,13,14,16,17,18,19,20,21,23,24,26,27,28,29,30,31,32,33,34,36,37,38,39,41,42,44,45,47,49,50,51,52,53,54,58,59,60,62,63,64,
+1,3,5,7,10,11,13,16,17,19,20,21,22,23,25,26,27,29,30,31,33,34,35,37,38,39,40,42,44,45,46,49,50,51,52,53,55,56,57,58,59,60,61,62,63,64,
+1,3,5,7,10,11,12,13,14,16,17,18,24,26,27,28,29,30,31,32,33,35,36,37,38,39,40,42,43,44,45,46,49,50,51,52,54,55,56,57,59,60,62,63,64,
+1,3,13,15,16,17,20,25,27,29,30,31,32,33,34,35,36,37,38,39,40,42,43,45,46,49,51,52,53,54,55,56,58,59,60,62,63,64,
+1,7,8,9,10,11,16,17,27,28,29,30,32,33,35,36,37,38,39,40,41,42,46,49,50,51,52,53,54,55,57,58,59,60,61,62,63,64,
+1,11,12,16,28,30,31,32,34,42,47,51,52,53,54,55,58,59,60,62,63,64,
+1,5,8,9,10,11,12,22,28,29,43,50,52,53,54,55,56,57,58,59,60,62,63,64,
+1,5,6,8,9,10,13,14,15,16,23,24,31,34,37,38,39,40,43,44,47,48,49,52,53,54,55,58,59,60,61,64,
+1,4,5,6,7,8,10,11,12,17,18,19,23,25,26,27,28,31,34,36,40,44,46,47,48,49,52,53,54,55,58,59,60,62,64,
+1,3,6,10,11,14,15,16,18,20,21,22,23,24,25,26,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,44,45,46,47,48,49,50,52,53,54,55,56,58,59,60,62,64,
+1,2,3,4,5,7,8,10,13,14,15,16,18,19,20,21,23,24,26,27,31,32,34,35,37,38,39,43,45,47,48,49,50,52,53,54,55,56,57,59,60,61,64,
+1,3,6,7,8,11,12,14,15,17,18,19,20,21,23,24,25,26,27,29,30,32,34,35,36,37,38,40,42,43,44,45,46,48,49,50,51,53,54,55,56,57,58,59,60,62,64,
+1,4,5,9,10,12,13,14,18,19,20,21,22,23,24,25,28,29,30,32,33,35,36,38,39,41,42,44,45,46,47,48,49,50,52,53,54,55,56,59,60,61,64,
+1,4,5,11,12,15,16,17,18,19,20,21,23,25,28,29,30,32,33,34,35,36,40,41,45,46,48,49,50,52,53,54,55,56,58,59,60,62,64,
+1,3,6,11,12,13,14,15,19,20,21,23,24,26,27,29,32,33,34,35,37,38,39,40,41,42,43,44,47,49,50,51,53,54,55,57,59,60,62,64,
+1,4,5,7,8,10,11,15,16,17,18,19,21,23,25,26,29,35,37,44,45,48,49,50,52,53,54,55,56,57,58,59,60,61,64,
+1,4,6,12,13,14,15,18,19,21,23,24,25,29,31,49,50,52,53,54,55,56,58,59,60,62,64,
+1,2,4,10,11,12,13,15,16,17,18,19,20,21,23,24,28,29,42,50,51,53,54,55,57,58,59,60,62,64,
+1,3,6,7,8,9,10,11,12,14,15,18,19,20,23,32,33,34,35,52,53,54,55,56,58,59,60,61,64,
+1,4,7,8,9,10,11,12,13,15,16,17,18,19,20,22,23,25,31,32,37,39,40,41,51,53,54,55,58,59,60,62,64,
+1,3,4,6,7,8,9,10,12,13,14,16,17,18,19,20,22,23,24,26,30,33,34,35,36,41,43,52,53,54,55,56,58,59,60,62,64,
+1,2,3,9,10,11,12,15,16,17,18,20,22,23,24,25,26,27,29,31,33,35,36,37,38,41,46,47,48,49,50,53,54,55,56,58,59,60,61,64,
+1,10,15,19,22,23,24,25,27,28,31,36,37,38,39,40,41,42,45,46,47,49,51,53,54,55,56,58,59,60,62,64,
+1,8,22,23,24,25,27,28,29,32,38,39,40,41,42,43,50,51,54,55,56,58,59,60,62,64,
+1,3,4,5,9,13,14,15,22,23,25,30,31,38,39,41,42,43,44,47,49,50,51,52,54,55,56,58,59,60,61,64,
+1,2,4,6,7,12,15,19,20,21,22,23,24,26,27,28,29,30,31,32,34,35,36,37,38,39,40,41,42,43,44,45,47,48,49,50,51,53,54,55,56,57,58,59,60,62,64,
+1,4,8,9,11,12,13,19,21,22,23,24,25,26,27,28,29,30,31,32,33,37,38,39,40,41,42,43,44,45,47,48,50,51,52,53,54,56,58,59,60,62,64,
+1,2,5,6,7,8,9,10,11,12,14,15,17,19,20,21,22,23,25,26,27,29,32,33,34,36,37,38,39,40,41,42,43,44,45,48,49,50,51,53,54,56,57,59,60,61,64,
+1,2,4,5,8,10,11,12,13,14,16,17,19,20,22,23,24,26,27,29,30,32,33,37,38,40,41,42,43,44,45,46,47,49,50,51,52,54,55,56,58,60,62,64,
+1,2,4,5,8,10,11,12,14,15,17,18,20,21,22,23,25,29,30,31,32,34,36,37,38,39,40,41,42,45,48,49,50,51,53,56,58,61,64,
+1,2,3,5,6,7,8,10,11,12,13,14,16,17,18,20,21,22,23,24,26,27,28,29,31,32,34,35,37,38,40,41,42,43,44,45,49,50,51,52,54,58,59,62,64,
+1,2,4,5,6,7,8,10,11,12,13,15,17,18,19,20,22,23,25,26,27,31,32,33,34,37,38,39,41,42,43,44,46,47,48,49,50,51,52,53,55,61,64,
+1,2,3,5,8,10,11,12,13,14,17,18,19,20,22,23,24,25,28,29,30,31,32,33,34,35,36,37,38,40,41,42,43,44,45,48,49,51,52,53,54,55,56,57,59,60,61,63,64,
+1,2,5,8,9,11,12,13,15,17,18,19,20,22,23,25,26,27,29,30,32,34,37,38,40,41,42,44,47,50,51,52,53,55,56,57,60,63,64,
+1,2,3,4,5,8,11,12,13,14,17,18,19,20,21,22,23,24,26,35,38,39,40,41,42,43,44,46,47,48,49,50,51,52,53,54,56,57,60,62,63,64,
+1,3,4,5,6,9,11,12,15,16,18,19,20,22,23,24,30,34,40,41,42,43,44,45,48,50,52,53,56,57,58,60,61,62,63,64,
+1,2,6,8,10,11,12,14,19,20,34,35,36,40,41,42,43,44,45,51,52,53,54,56,57,58,59,60,61,62,64,
+1,2,8,11,12,13,20,21,33,34,35,37,38,41,42,43,44,45,46,47,50,52,53,55,56,57,58,59,61,62,64,
+1,8,9,11,12,22,24,36,37,41,42,43,44,48,51,52,53,54,56,57,58,59,60,61,62,64,
+1,2,9,13,19,21,22,23,25,30,36,37,38,41,42,44,46,48,49,50,51,52,53,56,57,59,60,61,62,64,
+1,2,3,8,9,13,14,15,16,17,18,24,27,28,29,31,32,33,34,36,37,38,40,41,42,43,44,45,46,47,48,49,50,51,52,53,55,56,59,60,61,62,64,
+1,2,3,11,12,13,14,15,16,17,19,23,26,30,32,34,35,36,37,38,40,41,42,43,44,48,49,50,52,53,54,55,56,61,64,
+1,2,3,5,8,10,11,12,13,15,16,18,19,20,22,23,24,25,26,29,31,34,35,36,38,40,41,42,43,44,45,46,51,52,53,54,56,58,59,60,61,63,64,
+1,2,3,4,6,7,8,11,13,14,15,16,17,18,22,25,36,38,40,41,42,43,44,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,63,64,
+1,2,3,5,6,7,8,9,10,11,12,13,14,15,17,36,37,40,41,42,43,45,48,49,50,51,52,53,54,56,57,58,61,62,63,64,
+1,2,3,4,6,11,12,13,15,16,36,37,38,40,41,42,43,44,45,46,47,51,52,53,55,57,58,60,61,62,63,64,
+1,2,3,5,7,8,10,11,13,14,15,17,18,24,25,26,27,29,30,31,36,37,38,39,40,41,42,43,44,46,47,48,50,51,52,53,54,56,57,58,59,60,61,62,63,64,
+1,2,3,4,5,6,7,8,11,12,13,14,15,16,17,23,24,25,26,27,28,30,31,33,37,38,39,40,41,42,43,44,48,49,51,52,53,55,56,57,58,59,61,62,63,64,
+1,2,3,4,5,6,8,9,11,13,15,16,17,19,21,22,24,25,26,27,28,29,30,31,33,34,37,38,39,40,41,42,43,44,47,48,49,50,51,52,53,54,56,57,58,60,61,62,63,64,
+1,2,3,4,5,7,8,11,12,14,15,16,17,18,20,21,22,24,25,27,28,29,30,33,34,37,38,39,40,41,42,43,44,45,46,47,48,50,51,52,53,55,57,58,59,60,61,62,63,64,
+1,3,4,5,6,7,10,11,12,13,14,15,16,17,18,19,25,27,28,29,30,31,32,33,34,35,37,38,39,40,41,42,43,44,45,46,47,49,50,51,52,53,54,56,57,58,59,60,61,62,63,64,
+1,3,4,5,7,9,10,11,12,13,14,15,16,17,18,20,21,22,23,24,25,27,28,29,31,32,33,34,35,36,37,38,39,40,41,43,44,45,46,47,48,49,51,52,53,55,56,57,58,59,60,61,62,63,64,
+1,3,4,5,6,9,10,11,12,13,14,15,16,17,18,19,25,27,28,29,31,32,33,34,36,37,38,39,40,41,42,43,47,51,52,53,54,57,58,59,61,62,63,64,
+1,3,4,5,7,8,10,12,13,14,15,16,17,18,20,21,22,23,24,25,26,27,29,31,32,33,34,35,37,38,39,40,41,44,48,49,51,52,53,55,56,57,58,59,61,62,63,64,
+1,3,4,5,6,7,8,9,10,12,14,15,16,17,18,19,25,26,27,28,29,31,32,33,34,35,36,37,38,39,40,41,42,43,45,46,47,49,50,51,52,53,54,56,57,58,59,61,62,63,64,
+1,3,4,5,6,7,8,10,11,12,13,14,15,16,17,18,19,20,21,22,24,25,26,27,29,31,32,34,35,36,37,38,39,40,41,42,43,52,53,54,56,57,58,59,60,61,62,63,64,
+1,3,4,5,6,7,8,9,10,12,14,15,16,17,18,19,22,24,25,26,27,28,29,30,31,33,38,39,40,43,52,54,55,58,59,62,63,64,
+1,3,4,5,7,8,9,10,11,12,13,14,15,16,17,18,19,24,25,26,27,28,29,30,31,38,39,42,44,45,46,47,52,54,58,63,64,
+1,3,4,5,10,12,14,16,17,18,19,26,28,29,30,36,40,44,54,63,64,
 
 };
 
@@ -1,78 +1,168 @@
 
 #pragma once
 
-// Generated by generate_texture.py on 2022-09-07T14:50:31.831256
+// Generated by generate_texture.py on 2026-10-16T14:06:49.998319
 
 #include <cstdint>
 
 namespace textures
 {
 
-constexpr uint8_t mossy[64 * 64] = {
-9,82,82,164,246,173,173,173,164,164,91,82,9,9,9,82,164,246,240,168,160,173,164,164,164,164,91,82,9,82,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,
-9,82,82,164,173,173,164,173,173,164,91,82,9,9,9,82,164,240,168,160,173,164,173,240,160,160,91,82,9,91,164,173,168,168,91,173,246,246,246,246,246,168,168,168,168,160,164,91,9,82,82,91,173,173,173,173,173,173,173,164,9,82,82,9,
-9,82,82,164,168,168,88,91,173,164,91,82,9,9,9,9,164,168,160,173,164,173,91,160,160,164,91,82,9,91,173,168,160,160,164,173,164,173,173,173,168,168,160,160,160,91,164,91,9,82,82,173,240,240,246,246,173,246,164,91,9,9,82,9,
-9,82,82,164,173,168,82,164,91,164,91,82,9,9,9,9,164,246,168,168,168,168,91,91,173,164,91,9,9,91,168,168,160,91,173,164,173,173,164,173,168,160,91,91,164,164,164,91,82,9,82,240,240,240,164,246,246,246,91,82,9,9,82,9,
-9,82,82,164,173,82,164,173,91,91,82,82,9,9,9,9,164,246,168,160,160,88,82,164,164,164,91,9,9,164,168,160,91,91,164,173,164,164,168,164,164,173,164,173,164,173,164,91,82,9,9,240,240,168,168,164,246,173,91,9,9,9,82,9,
-9,82,82,164,173,91,164,164,164,82,82,9,9,9,9,9,164,240,160,160,88,82,91,164,164,164,82,9,9,164,164,91,164,173,91,173,164,164,160,164,164,164,164,164,173,164,91,82,82,9,9,240,240,164,164,246,173,164,91,9,9,9,82,9,
-9,82,82,164,164,91,164,91,82,82,9,9,9,9,9,9,164,160,88,88,88,82,164,164,164,91,82,9,9,164,173,173,173,91,164,168,160,88,164,164,168,160,164,164,164,173,91,82,82,9,9,160,240,164,246,173,246,91,91,9,9,9,82,9,
-9,82,82,164,164,91,91,82,82,82,9,9,9,9,9,9,164,91,82,82,82,164,91,91,91,82,9,9,9,164,173,173,168,168,168,160,88,88,91,168,160,88,88,164,173,164,82,82,82,9,9,164,240,164,246,173,240,168,160,9,9,9,82,9,
-9,82,82,9,9,9,9,9,9,9,9,9,9,9,9,9,164,91,91,91,82,82,82,82,82,9,9,9,9,164,173,173,168,160,88,88,88,91,164,160,160,88,88,164,164,91,82,82,82,9,9,91,168,164,173,173,168,160,80,9,9,9,82,9,
-9,82,82,82,82,82,82,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,82,164,173,173,91,91,91,91,91,91,164,91,91,91,91,82,82,82,9,9,9,9,9,82,160,173,246,164,160,80,91,9,9,9,82,9,
-9,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,9,9,9,9,9,9,9,9,9,9,9,9,82,82,91,82,91,91,82,82,82,82,82,82,82,82,9,9,9,9,9,9,9,9,9,82,173,246,173,246,173,246,91,9,9,9,82,9,
-9,246,246,246,246,246,246,246,246,246,246,173,164,91,82,82,82,82,82,82,82,82,9,9,9,9,9,9,82,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,82,82,82,82,164,168,246,173,173,173,91,9,9,9,82,9,
-9,240,246,246,246,246,246,246,246,255,246,246,246,173,164,91,82,82,82,82,82,82,82,164,240,168,168,168,255,255,255,255,255,255,246,246,246,173,164,91,82,82,82,82,82,82,82,82,82,9,9,9,91,240,173,173,246,246,91,9,9,9,9,9,
-9,240,168,168,160,160,160,164,173,173,164,173,246,246,246,246,246,164,91,82,82,82,82,240,168,160,160,160,91,164,173,173,246,164,173,246,246,246,246,246,255,255,255,255,246,246,173,164,91,9,9,9,91,240,164,246,173,246,91,9,9,9,9,9,
-9,240,168,168,160,160,88,91,164,91,91,164,164,164,173,164,246,246,164,164,91,9,82,240,168,160,91,91,164,164,246,164,173,164,173,91,164,91,173,164,173,164,173,164,173,164,173,164,91,9,9,9,82,240,164,173,246,173,91,9,9,9,9,9,
-9,240,168,168,160,88,88,91,91,164,164,91,91,173,164,173,160,88,91,164,82,9,9,168,160,91,91,164,173,173,164,173,164,164,173,164,164,173,91,164,173,164,164,173,173,164,164,173,91,9,9,9,82,240,160,173,246,173,91,9,9,9,9,9,
-9,240,168,88,88,91,91,164,164,91,164,240,164,164,173,164,164,91,91,91,82,9,9,160,91,91,164,164,160,160,88,91,173,173,164,240,168,164,173,173,164,160,160,91,173,173,164,164,91,9,9,9,9,240,160,164,246,173,91,9,9,9,9,9,
-9,246,164,164,164,91,173,173,240,240,240,168,160,164,164,240,160,164,164,164,9,9,9,164,91,91,160,91,164,164,173,164,160,164,173,168,160,164,173,164,164,91,91,91,173,164,173,164,91,9,9,9,9,168,160,164,240,246,91,9,9,9,9,9,
-9,246,173,240,240,164,164,164,164,168,160,160,91,164,91,160,160,91,164,91,9,9,9,173,91,91,160,160,160,91,164,91,164,164,173,91,164,164,91,91,164,164,173,164,164,164,164,164,91,9,9,9,9,168,160,164,160,246,91,9,9,9,9,9,
-9,246,240,240,160,173,164,246,164,91,91,91,164,173,164,91,173,164,91,91,9,9,9,173,91,91,88,88,88,91,91,164,173,91,91,164,173,164,164,164,173,91,164,164,173,164,91,91,91,9,9,9,9,168,160,164,164,246,91,9,9,9,9,9,
-9,246,240,160,173,164,164,91,164,164,173,164,164,164,164,173,91,91,164,91,9,9,9,173,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,82,9,9,9,9,168,160,164,164,173,91,9,9,9,9,9,
-9,246,246,246,173,160,160,160,164,164,164,164,173,164,91,164,164,91,82,91,9,9,9,91,9,9,9,9,9,80,80,80,80,80,80,80,80,80,82,82,82,82,82,82,82,82,82,82,82,9,9,9,9,168,160,160,164,246,164,9,9,9,9,9,
-9,246,246,246,164,164,164,164,164,164,173,164,91,164,164,173,164,173,164,91,9,9,9,9,82,82,82,82,9,9,9,9,9,9,9,9,80,80,80,80,80,80,80,80,80,9,9,9,9,9,9,9,9,160,160,160,164,173,173,9,9,9,9,9,
-9,168,246,246,164,91,164,173,164,173,164,91,164,164,173,164,164,164,91,82,9,9,9,82,82,82,82,82,82,82,82,82,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,91,160,160,164,246,164,9,9,9,9,9,
-9,168,240,160,164,164,91,164,173,164,173,164,160,91,160,88,91,91,82,91,9,9,82,91,160,164,164,164,164,164,164,91,82,82,82,82,82,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,91,164,164,164,173,91,9,9,9,9,9,
-9,168,240,168,160,160,164,164,164,164,164,91,164,91,82,82,91,164,91,82,9,9,82,160,240,255,255,255,255,255,255,164,164,173,164,91,82,82,82,82,82,9,9,9,9,9,9,9,9,9,9,9,9,91,164,164,173,91,91,9,9,9,9,9,
-9,246,164,91,82,82,82,82,82,82,82,91,82,82,82,91,82,91,82,82,9,9,82,240,168,164,240,240,168,168,173,240,160,255,255,246,173,164,82,82,82,91,88,88,9,9,9,9,9,9,9,9,82,91,246,246,173,173,91,9,9,9,9,9,
-9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,82,82,82,82,9,9,9,82,240,91,164,173,173,164,173,240,160,88,173,246,246,246,246,164,9,82,160,240,240,168,164,246,173,173,164,164,82,82,91,173,246,164,246,91,9,9,9,9,9,
-9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,82,240,164,160,164,240,240,160,160,88,91,240,240,160,88,164,164,9,9,160,240,168,168,164,246,246,246,246,164,82,82,82,173,240,240,173,91,9,9,9,9,9,
-9,164,164,173,164,82,82,82,82,82,9,9,9,9,9,9,9,9,9,9,9,9,82,168,173,164,240,160,88,88,88,91,91,240,160,88,91,91,91,9,9,160,240,168,160,164,246,246,246,173,91,9,82,82,173,240,160,164,91,9,9,9,9,9,
-9,173,246,246,246,173,91,91,82,82,82,82,82,9,82,82,82,82,82,9,9,9,82,246,173,240,160,91,91,91,91,91,164,160,88,91,91,91,91,9,9,160,240,168,160,160,160,160,91,164,91,9,9,82,173,164,164,164,91,9,9,9,9,9,
-9,246,173,173,164,240,160,164,91,9,9,82,91,173,173,173,240,240,91,173,164,9,164,255,164,173,164,164,173,164,164,173,164,164,91,91,164,91,82,9,9,160,240,168,160,160,88,91,91,173,91,9,9,82,173,246,91,91,82,9,9,9,9,9,
-9,246,164,164,164,160,160,173,91,9,9,82,173,249,240,240,240,91,164,164,91,82,164,255,173,164,240,240,164,91,173,164,173,91,164,164,173,91,82,9,9,160,240,168,160,160,88,91,164,164,91,9,9,82,164,91,91,82,82,9,9,9,9,9,
-9,246,240,91,164,173,168,164,82,9,9,82,249,240,160,160,91,164,91,91,9,9,164,255,164,164,240,160,173,164,173,164,91,91,164,173,164,91,82,9,82,160,240,168,160,160,88,91,164,173,91,9,9,82,82,9,9,9,9,9,9,9,9,9,
-9,246,91,240,173,164,164,173,82,9,9,91,249,160,91,91,91,91,164,164,9,9,160,240,160,91,173,164,164,173,164,91,164,91,164,164,160,91,9,9,82,160,240,168,160,160,88,91,168,168,160,9,9,82,82,82,9,9,9,9,9,9,9,9,
-9,246,240,91,173,164,173,164,9,9,9,173,246,164,173,164,173,164,240,91,9,9,160,240,91,173,164,173,91,164,173,164,91,91,173,168,91,91,80,9,82,91,160,160,160,88,91,91,168,168,88,9,9,9,82,82,82,82,9,9,9,9,9,9,
-9,240,160,88,91,91,173,164,9,9,9,173,246,164,164,240,240,160,91,82,9,9,160,240,160,160,160,164,168,168,168,168,168,168,160,160,91,91,82,9,82,91,173,173,88,88,91,164,160,88,88,82,9,9,9,82,82,82,82,82,82,9,9,9,
-9,240,160,160,160,80,91,164,9,9,9,173,246,173,240,240,240,88,91,9,9,9,160,240,160,91,173,164,160,160,160,160,160,160,160,91,91,91,82,9,82,164,246,246,164,91,164,164,173,164,164,91,82,9,9,82,160,168,91,173,9,82,82,9,
-9,240,160,88,88,82,91,173,9,9,9,173,246,164,240,91,91,91,91,9,9,9,160,168,160,160,160,91,91,91,164,91,91,91,91,91,91,82,82,9,91,164,173,173,246,173,173,160,164,173,173,91,82,9,9,82,168,160,160,160,80,80,82,9,
-9,91,88,82,82,91,91,91,9,9,9,246,246,173,164,164,164,173,82,9,9,9,91,160,160,88,91,91,91,82,82,82,82,82,82,9,9,9,9,9,91,164,246,173,173,246,246,173,164,164,91,91,82,9,9,9,168,160,160,88,80,80,82,9,
-9,164,82,91,91,82,9,9,9,9,9,246,246,160,160,160,88,164,82,9,9,9,82,160,88,80,80,80,80,80,80,80,9,9,9,9,9,9,9,9,91,173,164,246,173,173,164,173,173,173,91,164,82,9,9,9,168,160,88,91,82,9,82,9,
-9,164,82,82,82,82,9,9,9,9,9,88,240,91,82,82,82,82,82,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,91,173,246,240,160,164,173,173,164,164,164,168,82,9,9,9,91,91,91,164,91,9,9,9,
-9,82,9,9,9,9,9,9,9,9,9,9,88,80,88,80,9,9,9,9,9,9,9,9,9,9,9,9,9,9,88,9,9,88,160,82,82,82,82,82,91,173,173,160,160,91,164,164,173,164,173,173,82,9,9,9,82,246,173,91,91,9,9,9,
-9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,91,91,164,164,164,164,240,168,160,160,160,164,164,164,91,82,82,82,91,173,246,164,173,164,164,173,173,164,240,88,82,9,9,9,82,246,173,164,91,9,9,9,
-9,82,9,9,9,9,9,9,9,9,9,9,9,9,9,82,82,9,9,91,91,164,246,246,246,240,168,91,255,255,246,246,246,246,246,246,173,9,82,82,91,173,246,173,173,246,164,240,173,240,168,88,82,9,9,9,82,173,173,164,91,9,9,9,
-9,82,91,160,160,160,160,160,91,91,91,91,82,9,9,82,240,168,160,160,164,173,246,246,173,164,91,164,173,246,173,246,173,246,173,164,91,9,82,82,91,173,246,164,164,164,240,173,164,168,88,91,82,9,9,9,82,82,91,91,91,9,9,9,
-9,82,160,240,240,240,160,88,91,173,173,173,164,9,9,82,168,168,160,160,160,164,173,246,173,164,164,173,246,246,173,168,168,168,160,88,88,80,9,82,91,173,240,168,246,164,240,164,168,88,173,91,82,9,9,9,82,82,82,82,82,9,9,9,
-9,82,160,240,168,88,88,91,164,173,91,164,91,9,9,82,168,160,82,91,164,173,246,173,246,173,173,246,173,173,168,160,88,80,88,80,80,80,9,82,91,240,168,160,164,173,164,164,173,164,164,91,82,9,9,9,82,160,164,164,91,82,82,9,
-9,82,160,160,88,91,91,164,91,164,160,91,91,9,9,82,91,91,91,82,82,82,91,91,240,160,88,80,82,82,82,82,82,82,80,80,80,9,9,82,160,240,160,173,173,240,164,173,168,173,173,91,82,9,9,9,88,240,91,164,91,82,82,9,
-9,82,160,88,91,164,91,164,173,160,82,91,91,9,9,82,82,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,82,82,160,240,160,164,240,91,91,164,173,246,164,91,82,9,9,9,168,240,91,173,164,82,9,9,
-9,82,91,164,91,173,240,91,173,91,164,91,82,9,9,9,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,160,168,160,240,168,91,91,164,164,164,164,164,82,9,9,9,160,240,91,164,173,88,9,9,
-9,82,91,173,173,240,240,240,91,164,173,91,82,9,9,82,82,91,164,164,164,164,164,91,240,160,80,9,9,9,88,91,164,246,246,246,173,91,9,82,160,160,173,240,168,91,164,164,173,173,164,164,82,9,9,9,160,160,91,173,240,80,9,9,
-9,82,91,246,246,240,240,91,164,91,240,160,80,9,9,82,91,246,240,240,173,173,164,164,173,80,9,9,9,9,160,160,91,173,173,173,173,82,9,82,91,246,173,168,91,164,164,173,168,164,173,164,82,9,9,9,88,91,91,240,240,82,9,9,
-9,82,91,240,240,91,91,91,173,91,91,9,9,9,9,82,164,240,240,240,91,164,173,173,164,91,9,9,9,9,160,88,91,173,164,173,164,82,9,82,91,246,240,91,164,173,240,168,160,164,91,91,82,9,9,9,88,240,173,240,160,82,9,9,
-9,82,91,240,240,160,88,88,91,164,164,82,9,9,9,82,164,240,240,91,164,173,240,164,173,91,82,9,9,9,160,160,160,160,160,160,160,82,9,9,91,240,168,164,164,173,168,160,164,173,164,91,82,9,9,9,80,173,173,173,91,82,9,9,
-9,82,82,240,240,160,160,88,82,91,91,82,9,9,9,82,164,240,91,164,164,164,164,164,164,240,80,9,9,9,168,160,160,88,88,88,160,82,9,9,91,168,246,246,173,164,173,173,173,164,164,173,82,9,9,9,82,173,164,173,173,88,9,9,
-9,82,82,91,82,82,82,82,91,91,164,91,9,9,9,82,164,246,240,160,160,173,164,173,240,168,80,9,9,9,168,160,160,91,164,91,91,82,9,9,91,246,246,168,91,164,173,164,173,164,240,91,82,9,9,9,82,246,240,160,160,80,9,9,
-9,82,82,91,91,91,91,91,164,164,91,82,9,9,9,82,164,168,160,160,91,91,173,164,240,160,80,9,9,9,160,168,160,91,91,164,164,82,9,9,91,240,168,160,91,164,164,164,164,164,164,91,82,9,9,9,82,240,160,160,91,82,9,9,
-9,82,82,240,240,160,91,91,164,164,164,82,9,9,9,82,164,173,91,91,91,173,164,240,91,88,80,9,9,9,160,168,88,80,164,164,91,82,9,9,91,168,168,168,168,168,168,91,168,173,164,91,82,9,9,9,82,173,91,91,91,82,9,9,
-9,82,82,240,240,160,82,164,164,164,91,82,9,9,9,82,164,173,173,164,173,91,173,164,173,80,82,9,9,9,82,168,88,91,91,164,91,82,9,9,91,160,168,160,91,91,91,91,168,91,164,91,82,9,9,9,82,164,173,164,164,82,9,9,
-9,82,82,164,160,88,82,91,164,164,91,82,9,9,9,82,164,240,240,240,240,173,173,91,164,91,82,9,9,9,82,160,88,91,164,173,164,82,9,9,91,246,160,91,91,91,91,91,91,91,91,91,82,9,9,82,82,91,246,173,164,82,9,9,
-9,82,82,164,91,82,91,91,173,164,164,82,9,9,9,82,164,240,160,160,160,160,91,173,164,91,82,9,9,9,82,164,91,91,91,82,82,82,9,9,91,91,91,82,82,82,82,82,82,82,82,82,9,9,9,82,82,82,164,82,82,82,9,9,
-9,82,82,164,246,164,168,160,91,173,91,82,9,9,9,82,164,240,160,160,160,88,91,164,173,82,82,9,9,9,82,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,82,82,82,82,9,9,9,9,9,9,
-9,82,82,164,246,164,91,91,91,164,91,82,9,9,9,82,164,246,91,91,164,91,164,173,164,91,82,82,9,9,82,82,82,82,82,82,9,9,9,9,82,82,82,82,9,9,9,9,9,9,9,9,9,82,82,82,82,82,82,82,82,82,82,9,
+// Colors of all levels in rgb233, texels are indices into the palette packed in mossy_index_bits each
+constexpr auto mossy_index_bits = 6;
+
+constexpr uint8_t mossy_palette[34] = {
+8,9,16,17,18,80,81,82,88,89,90,91,96,97,98,99,100,160,161,162,163,164,168,169,170,171,172,173,177,182,240,246,249,255,
+
+};
+
+// Palette indices of the 64x64 texels followed by prefiltered mip levels 1 to 6 (32x32 down to 1x1),
+// box-filtered from the source texture
+// Levels are transposed (stored column by column) and packed least significant bit first, with a byte of padding at the end
+
+constexpr uint8_t mossy_texels[4097] = {
+193,113,84,223,182,109,85,181,28,65,16,28,213,231,89,209,86,85,85,181,28,193,177,44,203,178,44,203,178,44,203,178,44,203,113,28,199,113,28,199,113,28,199,113,28,199,113,4,193,113,84,219,86,109,91,181,28,65,16,28,149,103,69,91,
+181,121,81,180,28,193,82,109,150,181,108,223,247,125,159,101,89,86,84,45,193,113,44,219,182,109,219,182,85,193,113,4,193,113,84,150,133,44,91,181,28,65,16,4,149,21,109,213,182,68,81,181,28,193,178,89,81,84,109,213,182,109,150,21,
+69,209,82,45,193,113,108,158,247,125,219,87,45,65,112,4,193,113,84,155,117,84,75,181,28,65,16,4,213,103,89,150,181,44,91,181,4,193,98,89,209,178,85,219,86,109,86,180,44,85,85,45,71,112,120,158,87,125,223,183,28,65,112,4,
+193,113,84,219,81,109,203,114,28,65,16,4,213,103,69,17,114,84,85,181,4,65,101,69,203,82,109,85,101,85,213,86,109,213,86,45,71,16,120,158,101,85,223,182,4,65,112,4,193,113,84,219,82,85,213,113,4,65,16,4,149,23,69,200,
+177,84,85,117,4,65,85,45,213,182,108,85,21,85,85,85,85,91,181,28,71,16,120,94,85,125,91,181,4,65,112,4,193,113,84,213,82,45,199,17,4,65,16,4,85,132,32,200,81,85,213,114,4,65,181,109,219,82,89,17,82,85,86,84,
+85,213,182,28,71,16,68,94,245,109,223,178,4,65,112,4,193,113,84,213,178,28,199,17,4,65,16,4,213,114,28,71,181,44,203,17,4,65,181,109,150,101,69,8,178,88,17,130,84,91,117,28,71,16,84,94,245,109,158,21,5,65,112,4,
+193,113,4,65,16,4,65,16,4,65,16,4,213,178,44,199,113,28,71,16,4,65,181,109,86,132,32,200,82,69,17,130,84,213,114,28,71,16,44,86,181,109,86,84,4,65,112,4,193,113,28,199,113,4,65,16,4,65,16,4,65,16,4,65,
+16,4,65,16,4,71,181,109,203,178,44,203,82,45,203,178,28,199,17,4,65,16,28,209,246,85,81,177,4,65,112,4,193,113,28,199,113,28,199,113,28,199,113,28,65,16,4,65,16,4,65,16,4,199,177,28,203,114,28,199,113,28,199,17,
+4,65,16,4,65,16,28,219,183,125,219,183,4,65,112,4,193,247,125,223,247,125,223,247,109,213,114,28,199,113,28,199,17,4,65,16,4,71,16,4,65,16,4,65,16,4,65,16,4,65,16,4,199,113,28,149,245,109,219,182,4,65,112,4,
+129,247,125,223,247,125,95,248,125,223,86,45,199,113,28,199,113,84,158,101,89,97,24,134,97,248,125,223,86,45,199,113,28,199,113,28,71,16,4,139,183,109,223,183,4,65,16,4,129,103,89,81,20,85,219,86,109,223,247,125,95,181,28,199,
+113,120,86,20,69,75,181,109,95,181,125,223,247,125,97,24,134,223,183,85,75,16,4,139,87,125,219,183,4,65,16,4,129,103,89,81,132,44,213,178,84,85,181,85,223,87,85,75,112,120,86,180,44,85,245,85,91,181,45,213,178,85,91,181,
+85,91,181,85,75,16,4,135,87,109,223,182,4,65,16,4,129,103,89,17,130,44,75,85,45,203,86,109,17,178,84,71,16,88,209,178,84,219,86,109,85,181,85,213,182,84,91,85,109,91,85,109,75,16,4,135,23,109,223,182,4,65,16,4,
+129,103,33,200,178,84,213,82,121,85,181,85,213,178,44,71,16,68,203,82,85,81,132,44,219,86,121,86,181,109,85,20,45,219,86,85,75,16,4,129,23,85,223,182,4,65,16,4,193,87,85,213,178,109,158,231,89,81,85,121,81,85,85,65,
+16,84,203,18,45,85,181,85,81,181,89,81,181,85,213,178,44,91,181,85,75,16,4,129,21,85,222,183,4,65,16,4,193,183,121,94,85,85,149,21,69,75,181,68,209,82,45,65,16,108,203,18,69,209,82,45,85,181,45,85,181,44,85,181,
+85,85,85,85,75,16,4,129,21,85,209,183,4,65,16,4,193,231,121,209,86,125,213,178,44,213,86,45,91,181,44,65,16,108,203,130,32,200,178,84,219,178,84,91,85,85,219,82,85,91,181,44,75,16,4,129,21,85,213,183,4,65,16,4,
+193,231,69,91,85,45,85,181,85,85,85,109,203,82,45,65,16,108,203,178,44,203,178,44,203,178,44,203,178,44,203,178,44,203,178,44,71,16,4,129,21,85,213,182,4,65,16,4,193,247,125,91,20,69,85,85,85,91,181,84,213,114,44,65,
+16,44,65,16,4,65,81,20,69,81,20,69,113,28,199,113,28,199,113,28,71,16,4,129,21,69,213,87,5,65,16,4,193,247,125,85,85,85,85,181,85,75,85,109,213,86,45,65,16,4,199,113,28,65,16,4,65,16,4,69,81,20,69,81,
+20,69,16,4,65,16,4,65,20,69,213,182,5,65,16,4,129,245,125,213,82,109,213,86,45,85,181,85,85,181,28,65,16,28,199,113,28,199,113,28,65,16,4,65,16,4,65,16,4,65,16,4,65,16,4,193,18,69,213,87,5,65,16,4,
+129,229,69,85,181,84,91,181,85,209,18,33,203,114,44,65,112,44,81,85,85,85,85,45,199,113,28,71,16,4,65,16,4,65,16,4,65,16,4,193,82,85,213,182,4,65,16,4,129,229,89,81,84,85,85,85,45,213,114,28,75,181,28,65,
+112,68,94,24,134,97,24,86,213,86,45,199,113,28,71,16,4,65,16,4,65,16,4,193,82,85,219,178,4,65,16,4,193,87,45,199,113,28,199,113,44,199,113,44,199,114,28,65,112,120,86,229,121,150,181,121,81,24,126,91,117,28,199,130,
+32,65,16,4,65,16,4,199,242,125,219,182,4,65,16,4,65,16,4,65,16,4,65,16,4,65,16,28,199,113,4,65,112,120,75,181,109,213,230,69,200,246,125,223,87,5,71,228,121,86,245,109,91,85,29,199,178,125,213,183,4,65,16,4,
+65,16,4,65,16,4,65,16,4,65,16,4,65,16,4,65,112,120,85,84,121,94,20,33,139,231,69,72,85,5,65,228,89,86,245,125,223,87,29,199,177,121,222,182,4,65,16,4,65,85,109,213,113,28,199,17,4,65,16,4,65,16,4,65,
+112,88,91,229,69,8,130,44,139,23,33,203,178,4,65,228,89,81,245,125,223,182,4,199,177,121,81,181,4,65,16,4,193,246,125,223,182,44,199,113,28,71,112,28,199,113,4,65,112,124,155,23,45,203,178,44,85,132,44,203,178,4,65,228,
+89,81,20,69,75,181,4,193,177,85,85,181,4,65,16,4,193,183,109,149,23,85,75,16,28,203,182,109,158,183,108,85,80,133,213,86,85,91,85,109,85,181,44,213,114,4,65,228,89,81,132,44,203,182,4,193,177,125,203,114,4,65,16,4,
+193,87,85,85,20,109,75,16,28,27,232,121,222,82,85,203,81,133,91,229,121,213,178,85,219,82,85,219,114,4,65,228,89,81,132,44,85,181,4,193,81,45,203,113,4,65,16,4,193,231,45,213,102,85,71,16,28,160,23,69,75,181,44,65,
+80,133,85,229,69,91,181,85,203,82,109,213,114,4,71,228,89,81,132,44,213,182,4,193,113,4,65,16,4,65,16,4,193,183,120,91,85,109,71,16,44,96,180,44,203,82,85,65,16,121,209,178,85,213,86,45,213,82,85,209,18,4,71,228,
+89,81,132,44,150,21,5,193,113,28,65,16,4,65,16,4,193,231,45,91,181,85,65,16,108,95,181,85,91,229,45,65,16,121,203,86,109,75,181,85,203,178,89,203,82,4,199,18,69,17,178,44,150,133,4,65,112,28,199,17,4,65,16,4,
+129,23,33,203,178,85,65,16,108,95,85,121,94,180,28,65,16,121,81,20,85,150,101,89,150,21,69,203,114,4,199,178,109,8,178,84,17,130,28,65,16,28,199,113,28,71,16,4,129,23,69,81,177,84,65,16,108,223,230,121,30,178,4,65,
+16,121,209,178,85,81,20,69,81,20,45,203,114,4,71,245,125,213,82,85,91,85,45,71,16,28,145,181,108,193,113,4,129,23,33,200,177,108,65,16,108,95,229,45,203,178,4,65,16,89,81,20,45,203,82,45,203,178,44,203,113,4,75,181,
+109,223,182,69,213,182,45,71,16,28,86,20,69,69,113,4,193,130,28,199,178,44,65,16,124,223,86,85,213,118,4,65,176,68,17,178,44,203,113,28,199,113,4,65,16,4,75,245,109,219,247,109,85,181,44,71,16,4,86,20,33,69,113,4,
+65,117,44,203,17,4,65,16,124,95,20,69,72,117,4,65,112,68,72,81,20,69,81,20,65,16,4,65,16,4,203,86,125,219,86,109,219,182,84,71,16,4,86,132,44,71,112,4,65,117,28,199,17,4,65,16,32,222,114,28,199,113,4,65,
+16,4,65,16,4,65,16,4,65,16,4,65,16,4,203,246,121,81,181,109,85,85,89,71,16,4,203,178,84,75,16,4,193,17,4,65,16,4,65,16,4,72,129,20,65,16,4,65,16,4,65,16,4,65,128,4,1,18,29,199,113,28,203,182,
+69,209,82,85,91,181,109,71,16,4,199,183,45,75,16,4,65,16,4,65,16,4,65,16,4,65,16,4,65,16,4,65,176,44,85,85,85,158,21,69,81,85,85,203,113,28,203,246,85,91,85,109,91,229,33,71,16,4,199,183,85,75,16,4,
+193,17,4,65,16,4,65,16,4,65,16,28,71,16,44,75,245,125,159,103,45,97,248,125,223,247,125,91,112,28,203,246,109,219,87,121,155,103,33,71,16,4,199,182,85,75,16,4,193,177,68,81,20,69,203,178,44,71,16,28,158,21,69,213,
+246,125,91,181,84,219,183,125,219,183,85,75,112,28,203,246,85,85,229,109,149,133,44,71,16,4,199,177,44,75,16,4,193,17,121,158,23,33,203,182,109,85,16,28,150,21,69,81,181,125,91,85,109,223,183,89,150,21,33,72,17,28,203,230,
+89,95,229,85,22,178,45,71,16,4,199,113,28,71,16,4,193,17,121,22,130,44,213,182,84,75,16,28,86,116,44,213,246,109,223,182,125,219,102,69,72,129,20,69,17,28,139,103,69,213,86,85,91,85,45,71,16,4,71,84,85,203,113,4,
+193,17,69,200,178,84,75,21,45,75,16,28,203,178,28,199,177,44,94,132,20,199,113,28,199,81,20,69,16,28,145,23,109,155,87,109,214,182,45,71,16,4,136,183,84,203,113,4,193,17,33,75,181,84,91,116,44,75,16,28,71,16,4,65,
+16,4,65,16,4,65,16,4,65,16,4,65,112,28,145,23,85,222,178,84,219,87,45,71,16,4,150,183,108,213,17,4,193,177,84,203,230,45,219,82,45,71,16,4,199,113,28,199,113,28,199,113,28,199,113,28,199,113,28,199,113,28,145,21,
+121,214,178,84,85,85,85,71,16,4,145,183,84,27,18,4,193,177,108,155,231,121,75,181,45,71,16,28,199,82,85,85,85,45,94,84,4,65,128,44,213,247,125,219,18,28,81,180,121,214,82,85,219,86,85,71,16,4,81,180,108,94,17,4,
+193,177,124,159,231,45,213,226,69,69,16,28,203,231,121,219,86,85,91,17,4,65,16,69,203,182,109,219,17,28,203,183,89,75,85,109,86,181,85,71,16,4,200,178,120,222,17,4,193,177,120,222,178,44,219,178,4,65,16,28,149,231,121,75,
+181,109,213,18,4,65,16,33,203,86,109,213,17,28,203,231,45,213,230,89,81,181,44,71,16,4,136,183,121,209,17,4,193,177,120,94,132,32,75,85,29,65,16,28,149,231,45,213,230,85,219,114,4,65,16,69,81,20,69,209,17,4,139,103,
+85,213,102,69,213,86,45,71,16,4,197,182,109,203,17,4,193,113,120,94,20,33,199,178,28,65,16,28,149,183,84,85,85,85,149,87,4,65,96,69,17,130,32,209,17,4,139,245,125,91,181,109,91,85,109,71,16,4,199,86,109,27,18,4,
+193,113,44,199,113,28,203,82,45,65,16,28,213,231,69,209,86,109,158,85,4,65,96,69,209,82,45,203,17,4,203,247,89,75,181,85,91,229,45,71,16,4,199,231,69,81,17,4,193,113,44,203,178,44,85,181,28,65,16,28,149,21,69,203,
+178,85,94,84,4,65,16,89,209,178,84,213,17,4,139,103,69,75,85,85,85,85,45,71,16,4,135,23,69,203,17,4,193,113,120,94,180,44,85,85,29,65,16,28,213,182,44,203,86,121,11,82,4,65,16,89,72,81,85,203,17,4,139,101,
+89,150,101,45,214,86,45,71,16,4,199,182,44,203,17,4,193,113,120,94,116,84,85,181,28,65,16,28,213,182,85,219,178,85,91,113,4,65,112,88,200,178,84,203,17,4,75,100,69,203,178,44,214,82,45,71,16,4,71,181,85,213,17,4,
+193,113,84,17,114,44,85,181,28,65,16,28,149,231,121,222,182,45,213,114,4,65,112,68,200,82,109,213,17,4,203,23,45,203,178,44,203,178,44,71,16,28,199,242,109,213,17,4,193,113,84,203,177,44,91,85,29,65,16,28,149,23,69,81,
+180,108,213,114,4,65,112,84,203,178,28,199,17,4,203,178,28,199,113,28,199,113,28,65,16,28,199,81,29,199,17,4,193,113,84,95,101,69,203,182,28,65,16,28,149,23,69,17,178,84,219,113,4,65,112,4,65,16,4,65,16,4,65,16,
+4,65,16,4,65,16,4,65,112,28,199,17,4,65,16,4,193,113,84,95,181,44,75,181,28,65,16,28,213,183,44,213,82,109,213,114,28,65,112,28,199,113,28,65,16,4,199,113,28,65,16,4,65,16,4,193,113,28,199,113,28,199,113,4,
+193,178,85,213,17,4,153,69,81,211,17,44,205,82,85,79,147,28,193,177,44,203,18,4,193,114,41,208,17,4,148,52,41,20,65,92,72,85,85,81,162,44,129,226,109,219,18,4,193,178,84,75,16,4,89,132,44,85,112,52,11,84,77,85,
+85,45,1,114,81,27,17,4,193,178,44,71,16,4,138,113,44,75,112,108,142,132,56,204,82,29,129,129,109,216,16,4,65,16,4,65,16,4,4,17,4,65,112,108,73,162,40,137,114,4,65,48,109,72,16,4,71,85,85,213,114,28,65,16,
+4,65,16,4,68,16,4,65,16,4,65,144,109,27,17,4,72,150,105,219,182,85,203,113,40,86,180,117,221,182,85,85,85,45,65,32,109,27,17,4,136,133,36,203,2,85,212,18,32,204,82,85,21,4,65,85,85,85,68,32,81,27,17,4,
+138,163,64,210,69,81,202,18,24,139,50,45,20,54,85,138,82,85,68,128,76,26,17,4,203,53,85,78,2,41,207,18,44,11,146,44,208,82,45,80,85,45,68,128,76,26,17,4,75,70,37,85,85,65,203,18,16,4,49,24,134,97,28,199,
+113,28,65,128,72,21,17,4,202,183,84,21,180,84,213,18,4,199,17,4,65,0,0,0,0,4,65,48,68,213,17,4,136,53,45,21,164,24,203,17,24,216,182,85,203,17,4,65,16,4,65,64,84,16,17,4,4,17,4,65,16,16,71,16,
+72,14,54,93,212,183,29,70,100,44,7,113,108,27,17,4,193,65,4,65,16,4,65,16,36,212,197,32,82,164,16,133,53,125,219,113,96,19,17,4,203,150,41,68,112,44,210,17,84,153,178,44,148,178,4,133,21,33,11,17,108,75,16,4,
+203,68,77,65,192,89,206,18,108,149,5,85,75,181,4,133,21,37,21,17,28,65,16,4,139,84,85,1,129,45,203,20,88,74,5,65,11,165,0,70,132,40,150,16,28,65,16,4,8,146,64,193,178,93,17,17,88,8,21,69,17,178,4,199,
+150,44,142,18,4,201,18,4,6,98,44,193,178,77,75,16,48,136,114,28,7,17,4,203,182,105,213,18,4,17,82,4,199,113,4,193,49,37,71,16,12,0,0,0,65,16,4,144,70,85,149,19,4,137,18,4,65,16,4,65,0,0,65,16,
+16,199,129,32,137,114,28,16,245,84,213,20,4,21,68,4,193,80,20,4,17,4,72,2,125,153,210,109,219,70,28,208,86,97,24,18,4,199,66,4,129,101,33,16,68,4,81,66,109,219,182,73,8,82,4,142,85,81,206,18,4,198,66,4,
+1,162,44,143,66,4,68,16,16,8,16,4,1,0,4,214,132,65,218,18,4,214,114,4,193,66,89,203,18,4,199,178,28,73,16,24,75,181,4,209,213,44,85,21,4,209,210,4,1,133,41,75,2,4,148,7,85,75,16,32,80,181,4,213,
+4,97,211,18,4,8,150,4,129,100,33,203,17,4,152,83,81,84,16,68,8,146,4,141,86,77,21,20,4,75,165,4,193,113,28,203,18,4,84,164,84,22,16,68,201,114,4,212,181,84,149,19,4,83,100,4,129,100,45,213,17,4,213,2,
+81,74,16,48,197,114,4,73,212,40,206,18,4,203,114,4,193,146,28,213,17,4,152,37,65,75,16,40,202,114,4,139,114,28,199,17,4,71,117,4,193,178,37,203,17,4,89,146,64,75,16,4,65,16,4,65,16,4,65,16,28,71,16,4,
+199,179,4,147,163,40,74,213,40,6,181,4,199,18,4,137,114,40,142,226,44,67,166,4,199,65,4,65,16,28,3,49,4,129,166,4,141,83,85,139,209,108,91,85,65,193,180,4,206,35,61,75,160,40,207,179,64,65,178,4,212,3,65,75,
+64,4,193,48,4,1,178,4,201,113,24,199,144,101,207,49,12,193,178,4,139,18,16,195,49,41,9,193,76,139,162,4,10,21,96,139,50,65,11,129,32,73,16,4,136,66,100,73,145,36,73,0,61,75,144,4,65,16,24,65,48,8,67,64,
+61,79,176,4,6,178,4,72,85,105,211,64,81,78,160,4,134,179,4,4,81,4,71,16,57,80,208,12,70,163,4,82,117,8,206,64,81,79,224,12,134,178,4,211,83,8,74,208,40,79,160,4,135,178,4,146,115,4,68,64,4,65,112,4,
+74,224,40,143,162,16,202,66,40,139,162,16,207,67,28,202,49,16,10,49,76,74,162,12,138,146,56,135,67,4,195,112,40,6,117,16,9,161,12,199,116,36,7,225,12,131,50,28,135,162,28,138,162,16,134,162,12,135,162,28,138,162,28,10,
+0,
+
+};
+
+// Runs of equal texels in every texture column (row of the transposed data)
+// Column i has the runs [mossy_run_offsets[i], mossy_run_offsets[i + 1]) in mossy_run_ends
+// Each entry is the exclusive end texel of a run, so a column's last run always ends at 64
+
+constexpr uint16_t mossy_run_offsets[64 + 1] = {
+0,24,66,114,159,205,245,286,324,354,376,396,414,439,475,524,569,610,652,690,730,755,779,800,825,856,886,921,954,981,1016,1049,1095,1140,1187,1229,1274,1311,1354,1393,1427,1463,1487,1515,1542,1576,1620,1663,1715,1757,1793,1824,1867,1912,1959,2002,2041,2087,2127,2168,2214,2256,2288,2314,2342,
+
+};
+
+constexpr uint8_t mossy_run_ends[2342] = {
+1,3,4,5,8,10,11,12,15,16,17,18,19,20,21,22,26,27,28,29,30,45,63,64,
+1,3,4,6,7,9,10,11,12,15,16,17,18,19,20,21,22,23,24,26,27,28,29,30,31,32,34,35,36,41,45,46,47,48,49,51,52,59,60,61,63,64,
+1,3,4,6,7,8,9,10,11,12,16,17,18,19,20,21,22,23,25,26,27,28,29,30,31,32,34,35,36,37,40,42,45,46,47,48,49,51,52,54,56,57,58,59,60,62,63,64,
+1,3,4,5,6,7,8,9,10,11,12,16,17,18,22,24,25,26,27,29,30,32,33,34,35,36,38,39,40,41,42,44,47,48,49,50,51,54,55,58,59,60,62,63,64,
+1,3,4,5,6,7,8,10,12,16,17,18,19,21,22,23,26,27,29,30,31,32,34,35,36,38,39,41,42,43,44,45,46,47,48,49,51,53,55,56,57,58,59,62,63,64,
+1,3,4,5,6,9,11,16,17,18,20,21,22,23,26,27,29,31,32,33,34,35,36,38,39,44,45,46,47,49,51,53,55,56,57,58,59,62,63,64,
+1,3,5,6,7,8,10,16,17,18,21,22,25,26,27,29,30,33,34,35,36,37,38,40,41,42,45,46,47,49,51,52,53,54,55,56,57,59,62,63,64,
+1,3,5,7,10,16,17,18,21,22,25,26,29,30,32,35,36,38,39,40,41,43,44,45,46,49,51,52,53,54,55,56,57,58,59,62,63,64,
+1,3,16,17,20,25,29,30,32,33,34,37,38,39,41,43,45,46,49,51,52,53,54,56,57,58,59,62,63,64,
+1,7,28,29,30,32,38,39,43,46,51,52,53,54,55,56,57,58,59,62,63,64,
+1,16,28,30,31,32,34,42,51,52,53,54,55,56,57,58,59,62,63,64,
+1,11,12,13,14,22,28,29,48,52,53,54,55,58,59,62,63,64,
+1,2,9,10,13,14,15,16,23,24,25,28,34,37,38,39,40,49,52,53,54,56,58,59,64,
+1,2,4,7,8,10,11,12,17,18,19,23,24,25,28,29,30,32,33,34,35,40,44,46,47,48,49,52,53,54,55,56,57,58,59,64,
+1,2,4,6,7,8,9,11,14,15,16,18,20,21,22,23,24,25,26,28,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,52,53,54,55,56,57,58,59,64,
+1,2,4,5,7,9,11,13,14,15,16,17,18,19,20,21,23,24,25,27,28,30,31,32,34,35,37,38,39,40,41,43,45,47,48,49,52,53,54,55,56,57,58,59,64,
+1,2,3,5,7,9,10,11,12,14,15,17,20,21,23,24,26,28,30,31,32,34,35,36,37,38,40,41,43,44,46,48,49,53,54,55,56,57,58,59,64,
+1,2,5,6,8,11,12,13,15,16,17,20,23,24,26,27,28,30,31,32,33,34,35,36,37,38,39,41,44,45,46,47,48,49,53,54,55,56,57,58,59,64,
+1,2,3,5,9,10,12,13,14,15,17,18,19,20,23,24,26,29,30,31,32,34,35,36,38,40,42,43,48,49,53,54,55,56,57,58,59,64,
+1,2,4,5,6,7,8,9,12,13,14,15,16,17,18,20,23,24,26,29,31,32,33,35,36,37,40,41,42,44,45,46,49,53,54,55,57,58,59,64,
+1,2,3,4,5,7,8,10,11,15,16,18,19,20,23,24,48,49,53,54,55,57,58,59,64,
+1,4,5,8,12,13,14,15,17,18,19,20,23,24,29,38,49,53,54,56,57,58,59,64,
+1,4,10,11,12,13,15,16,17,18,19,20,24,28,36,45,53,56,57,59,64,
+1,2,4,5,6,7,8,9,10,11,12,14,15,18,19,20,23,32,53,54,56,57,58,59,64,
+1,2,3,4,6,7,8,9,10,11,12,13,14,15,16,18,19,20,22,23,24,25,31,32,37,53,54,57,58,59,64,
+1,2,3,4,6,11,12,13,14,16,17,18,19,20,22,23,24,25,31,33,34,35,36,41,53,54,56,57,59,64,
+1,2,3,4,11,12,15,16,17,18,20,22,23,24,25,26,28,30,31,32,33,35,36,37,38,41,42,44,52,53,54,56,58,59,64,
+15,19,22,23,24,25,26,28,29,30,31,32,33,34,38,39,40,41,42,44,45,46,47,49,51,53,54,55,56,57,58,59,64,
+22,23,24,25,26,27,29,31,32,33,35,36,37,39,41,42,43,45,46,50,51,54,55,57,58,59,64,
+1,3,4,5,10,22,23,24,25,26,27,28,31,33,34,35,36,39,41,42,43,44,45,46,49,50,51,52,54,55,56,57,58,59,64,
+1,2,5,6,8,13,14,19,22,23,24,25,26,27,32,33,34,35,39,41,42,43,44,48,49,50,51,53,54,55,58,59,64,
+1,2,4,5,6,7,8,9,11,12,13,16,18,19,20,21,22,23,24,25,26,28,29,31,32,34,36,37,38,39,41,42,43,44,46,47,49,50,51,53,54,55,56,58,59,64,
+1,2,5,7,8,9,11,12,13,14,17,18,20,21,22,23,24,25,26,28,29,30,31,32,33,34,36,37,38,39,41,42,43,44,46,47,48,50,51,53,54,55,57,59,64,
+1,2,3,4,5,6,7,8,9,11,12,13,14,16,17,18,20,22,23,24,26,27,28,29,30,31,32,34,35,36,37,38,39,40,41,42,43,44,46,47,48,49,50,51,53,55,64,
+1,2,3,4,5,7,8,9,11,12,13,14,18,20,22,23,24,25,26,27,29,30,31,32,33,34,36,37,38,40,41,42,43,44,46,47,48,50,51,53,56,64,
+1,2,3,4,5,6,7,8,11,12,13,14,15,16,17,18,19,20,22,23,24,25,26,27,28,29,30,31,32,34,35,36,38,39,40,41,42,45,46,48,50,51,54,58,64,
+1,2,3,4,6,7,8,11,12,13,15,17,18,19,20,22,23,24,27,28,34,36,38,39,40,41,42,44,46,47,48,49,51,52,55,61,64,
+1,2,5,6,7,8,11,12,13,14,17,18,19,22,23,24,25,26,27,28,35,38,39,40,41,42,44,45,46,48,49,51,52,53,55,56,57,58,59,60,61,63,64,
+1,2,3,5,6,7,8,11,12,13,14,15,19,22,23,24,27,30,31,37,39,40,41,42,44,45,47,48,49,51,52,53,55,56,57,60,62,63,64,
+1,2,3,5,8,11,13,14,17,18,19,22,23,25,26,29,35,40,41,42,43,45,47,48,50,52,53,56,57,59,60,62,63,64,
+1,2,3,5,6,11,13,16,17,18,19,22,23,24,25,32,40,41,42,43,44,46,47,50,51,52,53,56,57,58,59,60,61,62,63,64,
+1,2,6,11,12,13,14,19,40,41,42,43,44,45,46,48,51,52,53,56,59,60,61,64,
+1,2,12,13,14,15,16,30,31,33,34,35,40,41,43,45,46,48,49,50,52,53,56,57,58,59,61,64,
+22,24,28,29,30,33,36,37,40,41,42,43,44,45,47,49,50,51,52,53,56,57,58,59,60,61,64,
+1,2,15,17,19,21,22,25,26,27,28,30,36,37,38,40,41,42,43,45,46,47,48,49,50,51,52,53,56,57,59,60,61,64,
+1,2,3,8,12,13,15,16,17,18,20,21,22,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,40,41,42,43,46,47,48,49,50,51,52,53,56,58,61,64,
+1,2,3,6,7,8,9,12,13,15,16,18,21,22,23,24,25,27,28,30,31,34,35,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,56,61,64,
+1,2,3,4,5,7,8,9,10,11,12,13,15,16,17,18,19,20,21,22,23,24,25,27,28,30,31,32,33,34,35,38,39,40,41,42,43,44,45,46,48,49,51,52,53,56,57,58,60,61,63,64,
+1,2,4,5,7,8,9,10,11,13,15,16,19,22,24,25,26,27,28,34,37,39,40,41,42,43,45,46,47,48,49,51,52,53,56,57,58,59,60,61,63,64,
+1,2,3,4,5,6,7,8,9,10,11,13,15,17,38,40,41,42,43,44,45,47,48,49,50,51,52,53,56,57,58,59,60,61,62,64,
+1,2,3,4,5,6,7,8,9,10,11,12,13,16,40,41,42,43,44,45,47,52,53,56,57,58,59,60,61,62,64,
+1,2,3,5,8,9,10,11,12,13,15,17,18,23,24,25,26,27,30,31,32,33,36,37,38,39,40,42,43,44,45,46,48,50,52,53,56,58,59,60,61,62,64,
+1,2,3,5,7,8,9,10,11,12,13,15,16,17,18,20,22,24,25,26,30,32,33,37,38,39,40,41,42,43,44,45,47,48,49,50,51,52,53,56,57,59,61,62,64,
+1,2,3,5,8,9,11,15,16,17,20,21,22,24,25,26,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,52,53,56,57,58,59,60,61,62,64,
+1,2,3,5,6,8,9,11,12,15,16,17,19,20,21,22,23,24,25,26,27,30,37,38,40,41,42,43,45,46,47,48,49,50,51,52,53,56,57,60,61,62,64,
+1,3,5,7,8,9,11,12,15,16,17,18,19,25,26,27,30,31,33,36,37,38,40,41,42,44,45,46,49,51,52,53,56,57,58,59,61,62,64,
+1,3,4,8,10,11,12,15,16,17,18,19,21,22,23,24,25,26,27,30,31,33,34,35,37,38,40,41,43,44,45,46,47,48,49,50,51,52,53,56,57,58,59,61,62,64,
+1,3,8,10,11,12,15,16,17,18,20,22,23,24,25,26,27,30,31,32,33,35,37,38,40,41,42,43,44,45,51,52,53,56,57,58,60,61,62,64,
+1,3,5,6,8,11,12,15,16,17,18,21,22,23,24,25,26,27,30,31,32,33,34,36,37,38,40,41,47,48,49,50,51,52,53,56,57,58,61,62,64,
+1,3,5,6,7,10,11,12,15,16,17,19,20,21,22,23,24,25,26,27,30,31,32,33,35,36,37,38,40,41,42,43,44,48,49,50,51,52,53,56,57,58,59,61,62,64,
+1,3,4,5,6,7,8,10,11,12,15,16,17,21,23,24,25,26,27,30,31,32,33,34,35,36,37,38,40,41,42,43,52,53,55,57,58,59,60,61,62,64,
+1,3,4,5,6,8,9,11,12,15,16,17,18,22,23,24,25,26,27,30,31,32,35,38,40,43,52,55,58,59,62,64,
+1,3,4,5,6,7,8,9,10,11,12,15,16,17,18,21,22,23,24,25,27,30,31,54,58,64,
+1,3,4,5,6,9,10,11,12,15,16,17,18,20,21,22,23,24,25,26,28,30,36,40,44,53,63,64,
 
 };
 
@@ -1,78 +1,157 @@
 
 #pragma once
 
-// Generated by generate_texture.py on 2022-09-07T14:50:30.814746
+// Generated by generate_texture.py on 2026-10-16T14:06:50.002516
 
 #include <cstdint>
 
 namespace textures
 {
 
-constexpr uint8_t purplestone[64 * 64] = {
-67,81,81,81,132,132,67,132,67,66,66,66,66,66,66,66,66,66,66,66,67,81,81,81,81,66,66,132,66,66,67,67,66,66,66,132,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,72,72,72,91,
-67,132,81,81,81,81,132,132,132,67,66,66,66,66,66,66,66,66,66,66,67,132,81,81,72,66,66,132,67,67,132,132,132,67,67,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,72,72,82,
-67,132,132,81,72,72,81,81,81,81,72,72,72,72,66,66,66,66,66,66,67,132,81,81,72,72,66,132,67,132,67,67,67,132,132,132,132,67,132,67,66,67,67,132,132,67,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,72,72,9,
-66,67,132,132,67,132,67,132,67,66,67,67,67,67,67,67,67,67,67,66,66,67,132,72,72,72,72,72,81,81,81,72,72,72,81,81,72,72,67,66,67,132,81,81,72,72,72,72,72,72,8,8,66,8,66,66,66,66,66,66,67,132,72,72,
-66,66,132,67,132,132,132,67,66,67,67,132,132,132,132,132,132,67,67,67,66,66,67,67,67,72,72,72,81,81,81,72,72,72,81,72,72,67,66,66,67,81,81,67,67,67,67,67,67,66,66,66,66,66,66,66,66,66,66,72,81,81,81,72,
-66,66,67,66,67,67,67,67,67,132,132,132,132,132,81,81,81,81,81,67,67,67,66,66,132,67,67,66,66,132,67,132,132,67,67,67,67,66,66,66,67,81,81,67,132,66,132,132,67,66,66,66,66,66,66,67,67,67,67,81,81,66,67,72,
-66,66,66,66,66,67,132,67,132,132,132,132,132,81,81,81,67,67,67,132,132,67,66,66,67,67,66,132,67,66,66,67,66,67,132,132,67,66,66,66,67,132,72,72,72,72,132,132,67,66,66,66,66,66,67,132,132,132,132,81,81,67,132,72,
-66,66,66,66,66,66,67,132,81,81,81,81,67,81,81,67,132,132,132,67,66,66,66,67,67,132,67,67,66,66,67,132,67,67,132,67,66,66,66,66,66,67,67,66,132,67,67,67,66,66,66,66,66,66,132,132,132,132,72,81,81,132,66,72,
-66,67,67,66,66,67,132,81,81,81,81,81,81,81,67,132,132,132,66,66,66,67,66,132,132,132,67,66,66,66,66,67,66,66,66,66,66,66,66,66,67,132,67,66,67,67,132,132,67,66,66,66,66,67,132,132,132,66,72,67,81,72,72,72,
-67,132,67,66,66,67,132,81,81,81,81,81,72,81,67,132,132,66,67,132,67,66,67,132,132,132,67,66,66,66,66,66,66,67,132,132,67,67,66,66,66,67,66,67,132,132,132,132,132,67,66,66,66,67,132,81,81,72,72,132,67,132,72,72,
-132,67,66,67,66,132,132,132,81,81,81,72,72,72,67,132,67,66,132,67,67,66,132,132,132,67,66,72,72,66,66,67,132,132,132,132,132,132,67,66,66,66,67,132,132,132,67,67,67,66,67,66,66,132,81,81,66,67,72,67,67,66,72,72,
-66,67,67,67,66,132,132,81,81,81,72,72,67,66,67,132,67,66,66,66,132,67,66,67,67,66,72,72,67,66,67,132,133,133,132,132,132,132,67,67,66,67,67,132,81,81,72,66,66,66,67,66,66,132,81,72,67,132,72,67,132,67,72,72,
-67,66,67,66,66,132,81,81,72,72,72,72,72,72,8,8,8,8,8,8,67,132,66,66,66,66,81,72,67,67,67,132,133,132,81,67,67,132,132,67,67,132,132,132,81,132,66,132,66,66,66,66,66,132,81,72,67,67,132,67,132,72,72,72,
-66,66,67,66,66,132,67,67,67,67,67,67,66,66,66,66,66,66,66,66,66,67,66,66,66,66,81,81,81,72,72,132,132,81,81,81,72,72,67,66,132,132,132,81,81,81,132,66,66,67,66,67,66,132,81,72,67,132,67,67,72,72,81,72,
-66,66,66,66,66,132,67,66,66,66,66,66,67,66,66,66,66,66,66,66,67,66,66,66,72,81,81,66,67,132,72,132,81,81,72,72,72,72,72,72,132,132,81,81,81,66,66,66,67,66,66,67,66,132,81,72,72,67,132,67,72,72,81,72,
-66,66,66,66,66,67,132,67,66,66,67,67,66,81,81,81,81,81,132,67,132,66,66,81,81,67,66,66,67,132,72,132,81,81,72,72,72,72,66,66,132,132,81,81,81,66,66,67,67,67,66,66,66,67,132,81,72,72,72,72,72,72,81,72,
-66,66,66,66,66,67,132,67,66,67,67,81,81,81,81,81,132,132,132,132,67,66,66,81,72,66,67,66,132,67,72,67,81,81,67,132,67,66,66,66,132,132,72,72,72,72,66,132,132,67,66,66,66,66,67,132,67,67,67,67,72,72,81,72,
-66,66,66,66,66,66,67,67,66,66,81,81,81,81,81,81,72,72,67,132,67,66,66,72,72,72,72,72,67,66,72,72,132,81,72,72,72,72,72,66,67,132,72,72,72,72,72,132,67,72,72,72,72,72,66,66,66,66,67,132,72,72,81,72,
-66,66,66,66,66,66,67,132,67,66,81,81,81,67,66,66,66,66,132,67,66,66,67,66,66,66,72,66,66,66,66,72,72,67,132,67,66,66,66,66,66,132,67,66,66,66,67,72,72,67,66,66,8,72,72,72,72,8,8,8,72,72,81,9,
-66,67,132,132,67,66,66,67,67,66,81,81,67,67,132,132,67,67,67,66,66,66,67,67,67,67,67,67,66,66,66,72,66,66,66,66,66,66,66,66,66,66,67,66,66,67,132,132,67,132,67,66,72,81,81,81,81,132,66,66,66,72,81,82,
-67,132,132,132,132,67,66,66,66,66,72,81,81,132,67,66,66,66,66,66,66,67,132,132,132,132,132,132,67,66,66,67,132,132,132,132,67,66,66,66,66,67,132,67,66,66,67,67,66,67,66,72,81,72,72,72,72,132,132,66,66,72,72,91,
-67,132,81,81,132,132,67,66,67,66,72,81,81,81,81,72,72,72,66,66,66,132,81,81,81,81,81,132,132,132,132,132,132,132,132,132,132,67,66,66,66,66,67,66,66,66,66,66,66,66,66,81,72,72,72,66,66,66,132,66,132,72,72,91,
-67,81,81,81,67,67,66,66,66,67,66,67,132,132,132,67,66,66,66,66,132,81,81,81,81,81,81,81,81,132,132,132,132,132,67,66,67,67,66,66,66,66,66,66,66,66,66,66,66,81,132,81,72,72,66,66,66,66,66,66,66,72,72,82,
-67,81,81,132,66,132,132,66,66,67,66,66,67,67,67,66,66,66,132,132,81,81,81,67,67,81,67,67,132,132,132,132,81,81,81,72,72,81,72,72,72,8,8,72,72,72,72,81,81,81,81,81,72,8,8,8,66,132,66,66,72,72,72,9,
-67,81,81,67,67,132,67,67,67,67,66,66,66,66,66,66,66,81,145,81,133,132,81,132,132,81,66,66,132,132,132,81,81,81,72,66,66,66,66,66,66,66,66,66,66,72,81,145,81,81,72,81,81,72,72,72,72,72,72,72,72,81,72,72,
-67,81,81,67,132,67,67,66,67,67,67,66,66,66,66,66,81,145,81,67,133,132,81,81,81,72,66,67,132,132,132,81,81,72,66,66,67,66,67,66,66,66,66,66,72,81,145,81,81,72,81,81,72,72,66,66,66,66,66,72,72,132,81,72,
-66,67,81,81,81,72,72,72,81,72,72,66,66,66,66,72,81,145,81,133,132,132,81,72,72,72,67,81,132,132,132,81,72,66,66,67,67,66,66,66,66,66,66,66,72,81,81,81,81,81,81,72,81,81,72,72,66,132,66,72,72,81,81,72,
-66,66,66,67,67,66,66,66,67,66,66,66,66,66,66,72,81,145,81,132,132,81,81,72,72,72,67,81,132,132,67,72,72,72,66,66,66,66,66,132,67,66,66,66,72,81,81,81,81,72,72,81,81,72,72,72,66,66,66,72,72,81,81,72,
-66,66,66,66,66,66,81,81,81,81,72,72,72,66,66,72,81,145,81,132,132,72,72,66,66,67,132,81,132,132,81,72,72,72,72,72,72,72,72,67,66,66,66,66,72,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,81,145,72,
-66,66,66,66,66,81,81,81,81,81,66,67,66,66,66,66,81,81,81,132,72,72,66,67,132,132,132,72,72,72,72,72,67,72,72,72,72,72,72,72,8,8,72,72,81,81,81,81,81,81,81,72,72,66,66,67,66,66,67,67,72,81,81,72,
-66,66,66,66,81,81,81,72,66,67,132,132,66,66,67,67,72,81,81,81,132,72,67,132,66,72,72,72,72,72,72,67,132,132,132,67,66,66,66,66,66,66,66,66,132,132,132,67,81,81,81,72,72,66,132,132,67,67,66,67,72,72,81,72,
-66,66,66,66,81,81,72,66,132,132,67,66,66,66,132,67,66,66,72,72,72,72,72,66,72,72,72,72,67,66,67,132,132,132,67,66,66,66,66,66,66,66,66,66,132,132,133,132,132,81,81,72,72,66,67,132,132,132,67,66,72,72,81,72,
-66,66,66,66,81,81,72,66,67,132,67,67,66,66,132,67,67,66,66,72,72,72,66,72,72,72,72,72,67,132,132,67,67,66,66,66,66,67,66,66,66,66,67,66,66,132,132,132,132,132,67,81,72,67,67,132,132,67,66,66,72,72,81,72,
-66,66,66,66,132,81,81,72,72,72,72,72,66,66,67,67,66,67,66,72,72,72,72,72,72,72,72,72,72,132,132,67,132,67,66,66,66,66,66,66,66,66,67,66,66,66,81,81,132,132,132,81,81,67,66,132,132,67,66,66,72,72,81,72,
-66,66,66,66,67,132,132,67,132,67,66,66,66,66,66,66,66,66,66,66,66,72,72,72,72,72,66,72,72,72,72,72,66,67,67,67,66,66,66,66,67,67,66,66,66,66,72,81,81,132,132,132,81,72,72,72,8,8,66,66,72,72,81,72,
-66,66,66,66,66,67,67,66,67,72,72,72,66,66,66,66,66,66,66,66,66,66,72,81,72,72,66,132,132,66,66,66,67,67,132,132,67,132,66,67,132,132,66,67,67,67,67,72,81,81,81,81,81,72,72,72,72,8,8,8,8,72,81,72,
-66,67,67,67,66,66,66,72,72,81,72,72,72,72,72,72,72,72,72,72,72,72,72,81,72,72,67,132,132,67,66,67,132,132,132,132,132,66,67,132,132,67,66,66,67,132,132,132,67,72,72,72,81,81,72,8,8,66,66,67,72,72,81,72,
-67,132,132,132,67,66,72,72,81,72,81,72,72,72,72,66,66,67,67,67,67,67,72,81,72,72,72,72,72,72,72,67,132,132,67,67,66,66,67,132,67,66,66,66,67,132,132,67,132,67,66,66,72,81,72,8,66,66,67,66,66,72,72,72,
-132,132,132,67,132,67,72,81,81,72,67,67,132,132,132,132,132,132,67,132,67,66,66,66,72,72,72,67,67,67,66,67,132,132,66,66,66,67,66,66,66,66,66,66,66,67,67,132,67,67,66,66,66,72,72,72,72,72,72,72,72,72,72,72,
-132,132,132,132,67,72,81,81,81,145,145,145,81,81,81,81,81,66,66,66,66,66,66,66,67,72,72,72,72,72,72,72,72,72,72,72,72,67,67,67,66,67,66,66,66,67,132,67,132,67,66,66,66,72,72,72,72,8,8,8,8,8,72,72,
-67,132,67,67,66,72,81,81,145,145,81,81,81,81,66,132,132,132,66,72,66,66,67,67,67,72,72,72,72,72,72,72,72,72,72,72,72,72,72,66,66,66,66,66,66,66,67,67,67,67,67,66,66,66,66,66,66,66,66,66,66,67,72,72,
-66,67,132,67,66,81,81,81,145,81,81,81,81,72,72,72,72,72,72,72,72,72,72,67,67,132,72,72,72,72,72,72,72,72,72,66,66,67,66,72,72,66,66,66,66,66,66,66,67,132,81,81,72,72,72,72,66,66,67,66,67,132,72,72,
-66,132,67,66,81,81,81,81,81,81,81,81,72,66,67,66,72,81,81,81,81,132,132,132,132,67,67,72,72,72,72,72,72,72,72,67,67,132,67,66,66,66,66,66,66,66,67,67,81,81,81,81,132,67,66,66,66,66,66,66,66,67,72,72,
-66,67,67,66,81,81,81,81,81,81,81,72,66,67,132,72,81,81,81,72,72,72,72,72,72,67,132,67,66,66,67,67,67,67,67,66,66,67,67,67,132,66,66,66,66,67,132,81,81,81,81,67,67,132,67,66,66,66,66,66,67,67,72,9,
-66,66,66,66,81,81,81,81,81,81,72,72,67,132,132,72,81,81,72,72,8,8,8,67,132,67,67,66,66,66,66,66,66,66,66,66,66,67,132,132,67,66,66,67,67,132,81,81,81,81,81,72,72,72,72,72,72,72,72,72,132,132,72,82,
-66,66,66,66,81,81,81,72,72,72,72,72,72,67,132,81,81,81,72,8,66,67,66,66,67,132,67,66,66,66,72,66,66,66,66,66,66,67,132,132,66,132,67,132,132,81,81,81,81,81,66,66,66,67,132,132,67,66,66,67,132,132,72,82,
-66,66,66,66,81,81,72,72,66,66,66,72,72,72,81,81,81,72,8,66,67,67,66,66,67,132,132,67,66,66,66,66,66,66,66,66,66,67,132,67,66,72,132,132,132,132,132,132,81,81,66,66,72,81,67,67,67,66,66,67,132,132,72,82,
-66,66,66,66,81,81,72,72,72,72,66,132,72,72,81,81,81,72,72,72,66,66,66,66,132,67,67,66,66,81,81,81,72,72,72,72,72,72,72,72,72,81,81,81,72,72,72,72,81,81,66,66,81,72,72,72,72,72,66,66,67,72,72,82,
-66,66,66,66,72,81,72,66,66,66,66,66,132,81,81,72,81,72,8,66,67,66,67,66,132,67,66,66,81,81,81,132,67,67,66,66,66,66,66,66,72,81,81,81,132,132,67,67,66,81,66,67,81,72,66,66,66,66,66,132,66,72,72,9,
-66,66,66,66,72,81,72,72,72,72,132,132,132,81,72,72,72,72,72,72,72,8,67,132,67,66,66,66,81,81,132,132,132,67,66,66,66,66,66,67,81,81,81,72,72,72,66,66,72,132,67,132,72,72,72,72,72,72,81,72,72,72,72,72,
-66,66,66,66,72,72,72,66,67,132,132,72,72,72,72,67,72,72,72,8,8,66,66,67,132,67,66,66,81,66,132,132,132,67,67,66,66,66,67,132,81,81,72,72,66,66,66,66,72,132,67,132,72,72,72,72,72,72,67,132,72,72,72,72,
-66,66,66,66,72,81,72,66,67,132,72,72,72,72,67,132,67,67,67,67,67,66,67,66,67,66,66,66,66,66,132,67,67,66,66,66,66,66,67,132,132,81,66,66,66,66,66,72,81,81,81,81,81,81,81,66,66,72,81,67,72,72,81,72,
-66,66,66,66,66,72,81,81,72,72,72,72,72,72,67,67,67,132,67,66,66,67,66,66,66,66,66,66,66,67,132,67,66,67,66,66,66,66,67,132,132,81,72,72,66,66,66,72,81,81,72,72,132,132,67,66,66,66,72,72,72,72,81,72,
-66,66,66,66,66,66,72,72,66,67,67,72,72,132,67,66,66,67,66,67,67,66,66,66,66,66,66,66,67,132,132,132,132,132,67,66,66,66,67,132,132,132,67,67,66,67,72,81,81,81,66,67,132,67,66,67,132,66,66,72,72,72,81,72,
-66,66,66,66,66,66,66,72,72,72,72,72,72,72,72,67,132,67,66,66,66,66,66,66,66,66,67,132,132,132,132,132,132,132,132,67,66,66,66,67,132,67,132,132,67,132,81,81,81,81,81,81,67,67,66,66,66,66,66,66,72,81,81,72,
-66,66,67,67,67,67,66,66,66,66,72,72,72,72,72,72,72,67,132,132,67,67,66,66,66,67,132,81,81,81,81,81,81,81,81,81,72,72,72,66,67,67,67,132,132,132,132,81,81,72,72,72,72,72,72,72,72,72,72,72,72,81,81,72,
-66,67,132,132,132,132,67,66,66,66,66,67,67,67,67,72,72,72,67,67,67,66,72,72,81,81,81,81,81,81,132,132,132,132,67,67,66,66,66,66,67,132,132,132,67,67,132,132,67,66,66,67,132,67,132,67,66,66,67,66,72,81,81,72,
-66,132,132,81,81,67,132,132,67,66,66,66,67,132,132,67,72,72,72,72,72,72,72,81,81,81,81,81,81,132,133,133,132,132,132,132,67,66,66,66,66,67,132,67,66,66,67,67,67,66,67,132,132,72,67,66,66,67,66,66,72,81,81,72,
-66,132,81,81,81,81,81,81,81,81,66,66,66,66,67,67,67,72,66,66,66,66,132,81,81,81,132,81,81,133,132,67,67,67,67,67,67,67,66,66,66,66,67,132,67,66,67,132,132,67,132,132,72,81,67,67,66,66,66,81,81,145,81,72,
-66,81,81,81,81,81,81,81,72,72,72,72,72,66,66,66,66,66,66,66,66,67,132,81,81,132,132,81,81,133,132,67,66,66,66,66,67,67,66,66,66,66,66,67,66,67,67,67,67,67,132,67,81,81,72,72,72,66,81,145,145,81,72,72,
-66,81,81,81,72,72,72,72,72,72,72,72,72,66,66,66,66,66,66,66,67,132,81,81,132,132,132,81,81,81,132,132,132,67,67,66,66,67,66,66,66,66,66,66,67,132,132,67,67,67,67,66,72,81,72,72,72,81,145,81,81,72,72,72,
-66,81,81,72,66,67,132,132,67,132,67,66,66,66,66,66,66,66,66,66,67,81,81,81,132,67,66,81,81,81,132,132,132,72,72,66,66,67,66,66,66,66,66,66,66,67,67,67,132,132,132,67,66,72,72,72,72,72,81,81,67,132,72,9,
-66,81,81,72,72,72,72,72,72,72,66,66,66,66,66,66,66,66,66,66,67,81,81,81,132,67,67,66,81,81,81,81,72,72,72,72,81,81,81,81,72,72,72,72,8,8,8,66,67,67,67,66,66,66,66,66,66,72,81,81,72,67,72,82,
-66,81,81,66,67,132,67,66,66,66,66,66,66,66,66,66,66,66,66,67,67,81,81,81,81,67,66,66,67,132,81,81,72,72,72,72,81,81,81,81,72,72,72,8,66,66,66,66,72,72,72,66,72,72,66,66,66,66,72,132,72,72,72,91,
+// Colors of all levels in rgb233, texels are indices into the palette packed in purplestone_index_bits each
+constexpr auto purplestone_index_bits = 5;
+
+constexpr uint8_t purplestone_palette[20] = {
+0,1,2,8,9,64,65,66,67,68,72,73,74,75,81,82,91,132,133,145,
+
+};
+
+// Palette indices of the 64x64 texels followed by prefiltered mip levels 1 to 6 (32x32 down to 1x1),
+// box-filtered from the source texture
+// Levels are transposed (stored column by column) and packed least significant bit first, with a byte of padding at the end
+
+constexpr uint8_t purplestone_texels[3415] = {
+200,57,23,35,138,232,156,115,206,57,231,156,131,156,115,238,156,120,14,66,231,156,120,206,57,231,156,115,206,57,231,156,115,206,57,231,156,163,148,130,40,58,231,92,140,17,157,115,206,57,231,156,131,162,115,234,156,136,80,140,17,161,115,206,
+57,231,156,115,206,57,231,156,115,206,57,231,156,115,148,122,40,70,167,148,115,206,41,165,212,57,231,156,131,162,115,74,157,136,34,66,40,198,24,81,68,7,161,24,209,57,231,156,115,206,57,231,156,115,148,34,7,197,136,34,138,232,32,132,
+16,66,8,161,115,80,84,74,41,229,156,83,74,57,167,20,58,40,58,167,148,82,74,141,113,198,57,231,156,131,162,82,231,68,20,99,68,7,161,24,99,140,17,33,116,14,66,72,41,229,156,83,74,57,165,208,57,200,57,132,16,66,232,156,
+115,206,57,231,28,229,156,83,231,160,131,16,66,40,198,24,163,115,206,57,132,208,57,17,161,115,34,138,17,33,132,206,57,200,57,20,79,140,232,156,115,206,65,8,33,231,14,82,231,156,115,80,68,49,198,24,157,115,8,161,24,209,57,8,
+157,136,206,65,7,197,136,206,57,40,42,165,84,140,232,156,115,14,138,49,70,231,80,84,231,156,115,14,138,206,57,135,156,67,49,70,116,206,65,40,34,116,14,138,8,69,116,206,57,7,161,19,17,66,231,156,115,78,140,49,42,231,226,81,
+7,161,115,80,116,206,57,231,28,138,49,158,115,208,137,49,162,115,206,65,231,156,115,206,57,40,162,131,80,140,232,156,115,80,140,241,40,228,148,82,40,162,115,80,116,206,57,167,28,138,241,160,136,14,138,49,162,115,206,57,7,197,136,208,
+57,7,29,20,99,140,17,157,115,80,116,78,169,136,162,82,17,29,116,98,140,206,57,165,20,138,232,68,132,78,140,17,29,165,206,65,49,198,24,35,58,231,160,24,35,66,232,160,115,162,115,7,41,132,142,82,7,33,116,98,116,206,41,133,
+14,138,232,156,19,209,65,232,40,133,14,138,82,198,24,35,66,7,161,232,156,58,231,160,115,162,83,40,42,20,145,82,232,160,115,162,115,74,41,165,212,24,99,140,129,226,57,231,56,133,16,138,50,58,132,98,68,40,198,232,226,137,231,156,
+115,162,83,8,69,20,149,82,231,160,115,34,66,8,33,116,206,57,231,156,115,208,57,231,56,231,148,138,209,57,167,20,58,49,70,231,92,60,7,29,116,162,83,40,34,164,148,83,231,156,115,34,58,231,156,131,206,57,231,156,131,206,57,202,
+185,131,162,138,206,41,165,148,82,49,58,231,206,57,232,28,116,162,83,10,69,164,148,83,231,156,115,80,68,231,32,116,156,115,206,69,20,207,113,14,157,131,162,138,206,41,165,212,57,49,58,231,206,65,8,157,115,80,116,74,41,165,148,83,
+231,156,115,80,68,7,33,231,156,115,49,198,136,206,113,234,160,19,145,66,206,161,136,206,57,49,42,165,212,137,17,157,115,14,138,8,33,164,148,83,231,156,115,14,66,231,56,231,156,115,74,161,136,206,81,74,41,133,142,82,209,41,165,148,
+58,40,42,165,148,138,72,41,165,212,57,231,160,168,148,83,231,156,115,14,138,232,56,231,208,57,231,68,116,14,58,231,168,115,206,81,10,69,116,206,57,39,162,115,14,82,10,157,51,148,82,106,140,161,148,35,7,197,136,206,65,232,56,135,
+80,140,8,161,115,14,66,8,33,116,206,81,231,156,115,206,57,231,160,115,80,140,40,162,163,156,115,46,158,115,148,123,40,198,24,209,57,231,40,231,34,58,231,156,115,80,140,49,198,136,206,65,49,198,136,206,57,7,69,116,14,66,7,29,
+229,148,82,42,198,115,148,130,40,58,23,35,58,232,40,231,156,83,74,157,115,162,115,206,185,24,99,140,49,198,24,209,57,231,160,115,206,57,231,28,167,148,58,231,196,19,149,130,200,57,135,208,57,7,29,20,99,68,231,156,19,157,115,206,
+57,231,98,140,49,162,131,208,57,231,156,115,206,57,199,69,167,212,57,231,156,115,148,122,200,185,120,98,60,7,157,131,16,58,231,196,232,156,67,200,33,20,99,140,206,57,165,156,82,106,12,165,148,114,206,57,167,198,24,39,158,163,148,34,
+200,57,132,34,66,8,157,115,206,57,199,77,39,163,139,209,157,19,99,116,206,169,115,206,57,231,156,115,148,155,206,41,231,148,82,74,41,165,156,82,200,57,20,17,58,8,161,115,206,57,110,58,36,163,115,78,29,20,99,116,78,157,131,14,
+58,231,156,163,220,116,78,57,167,212,57,231,28,165,162,83,7,57,231,148,82,78,169,115,206,81,110,58,25,163,83,74,33,23,99,116,234,28,132,206,57,231,156,163,156,115,206,57,229,156,82,39,30,165,156,83,231,28,132,206,57,232,156,115,
+206,81,110,186,24,157,83,74,33,23,35,82,74,157,115,206,137,232,156,163,156,115,78,41,231,148,82,231,28,165,156,83,231,156,115,142,115,206,41,165,206,81,110,186,24,149,58,7,69,23,163,83,74,41,165,148,66,231,156,163,156,115,206,41,
+165,148,82,74,41,165,220,84,231,156,115,156,115,206,29,116,206,57,206,185,168,212,65,49,70,165,148,82,72,41,165,148,82,99,40,229,156,115,206,57,165,206,65,231,32,164,156,83,231,156,227,156,83,7,197,120,14,66,202,57,23,21,138,71,
+41,165,148,66,49,70,116,206,57,231,156,19,99,68,206,57,165,78,140,8,29,164,148,83,231,156,227,156,58,49,162,115,78,68,231,40,165,148,58,74,41,133,14,138,49,162,115,206,57,231,156,19,163,140,209,57,165,14,138,49,162,163,148,83,
+231,156,227,156,58,40,34,116,78,68,232,28,165,212,81,74,41,133,98,68,232,156,115,208,57,231,160,115,98,140,49,34,167,16,138,17,157,163,148,83,231,156,19,157,83,74,41,117,14,66,7,29,165,148,82,74,41,165,98,68,17,157,115,206,
+57,231,160,115,142,115,49,70,231,208,137,17,157,163,148,83,231,156,131,98,68,17,157,115,206,57,231,156,115,148,82,74,29,165,148,82,7,33,116,206,57,8,157,115,142,114,46,198,232,148,82,99,156,163,148,83,231,156,115,16,58,72,41,117,
+206,57,231,156,115,142,114,74,157,24,207,57,8,197,136,226,65,49,30,132,16,82,206,57,231,148,82,106,140,49,148,83,7,33,116,206,81,202,41,165,148,82,74,41,165,148,114,74,161,24,209,65,49,198,24,15,138,17,157,131,98,140,72,41,
+229,156,26,227,28,164,148,83,40,198,136,142,82,78,57,165,148,58,7,33,132,144,114,74,41,165,148,66,49,34,116,14,138,232,156,131,98,68,17,157,163,156,26,231,160,115,148,82,49,70,20,145,114,78,33,20,99,140,49,162,136,206,57,74,
+41,132,208,65,49,158,115,208,57,231,156,115,16,138,8,157,115,148,82,74,41,165,148,82,49,198,136,148,115,110,206,233,156,115,238,156,115,206,57,72,41,165,148,82,74,41,165,16,66,7,157,115,80,68,17,157,115,148,82,106,140,49,134,82,
+40,34,116,148,115,115,58,231,220,137,49,30,117,14,66,72,41,165,148,82,74,41,165,148,58,231,156,115,14,66,8,161,115,206,57,231,156,115,144,82,7,69,116,156,115,211,57,231,148,82,74,41,165,148,66,40,42,165,148,82,74,169,115,208,
+81,234,156,115,206,57,40,58,167,148,82,231,160,131,162,82,39,162,227,156,115,206,57,167,14,58,202,57,231,98,140,17,33,165,148,82,74,41,132,34,58,231,156,115,14,66,206,57,23,209,57,231,156,115,144,82,7,161,227,156,115,206,57,117,
+80,84,206,57,165,148,82,10,69,116,14,66,8,161,115,16,66,241,156,115,80,116,206,57,132,34,58,231,156,131,144,34,231,156,227,156,115,206,41,133,98,84,206,41,53,198,64,17,161,115,206,57,231,156,115,80,140,232,28,132,162,115,206,57,
+165,148,82,74,41,21,163,122,231,156,227,156,83,74,41,165,80,116,206,169,113,208,57,40,162,115,142,58,231,156,115,80,140,39,162,24,157,115,206,157,115,80,140,232,28,20,163,122,231,156,227,156,82,231,28,165,148,115,78,141,131,208,57,40,
+70,116,206,57,231,156,115,80,68,71,197,24,99,140,206,157,163,28,66,232,28,20,163,122,231,156,227,156,82,74,157,168,148,115,78,41,117,206,57,17,161,115,156,115,74,41,165,148,82,202,57,167,148,82,206,157,227,148,82,74,157,131,148,122,
+231,156,163,156,58,231,156,19,157,83,78,141,131,14,58,17,157,227,156,139,8,157,115,206,57,202,57,23,35,66,199,29,228,212,57,231,156,120,148,34,231,156,163,156,82,74,197,24,157,82,74,41,165,6,138,232,156,227,92,140,17,157,115,206,
+65,206,57,165,212,57,42,162,168,148,82,74,57,165,148,82,231,156,163,148,58,40,70,165,148,66,74,169,49,206,65,17,157,227,78,140,17,161,115,14,138,206,41,117,206,57,42,162,168,148,82,74,161,168,148,82,231,156,163,156,58,40,42,165,
+20,138,8,33,132,14,58,232,156,115,78,68,232,156,115,14,138,209,157,115,206,81,206,57,231,156,59,71,57,164,148,83,231,156,115,148,115,74,41,165,20,66,40,162,115,208,57,231,156,115,80,68,7,157,115,14,138,209,41,117,206,81,206,41,
+21,35,58,231,40,165,148,83,231,156,115,142,82,7,33,165,34,58,7,29,132,206,57,231,156,131,98,140,49,162,115,14,138,49,34,116,144,114,206,29,20,209,65,241,28,165,148,83,231,156,115,206,81,74,41,165,148,66,17,157,115,206,57,231,
+160,24,99,140,49,70,116,206,65,17,197,136,162,115,206,57,135,208,57,231,156,163,156,83,231,32,132,208,57,231,40,165,148,82,10,197,136,208,57,7,69,231,156,115,206,57,167,148,58,8,161,24,99,116,78,41,165,148,82,74,41,165,156,83,
+7,197,24,35,58,231,28,132,16,82,74,33,132,142,82,206,57,231,92,140,49,34,116,206,57,40,198,136,80,140,232,28,20,81,68,231,160,163,156,83,39,70,231,80,140,232,156,131,98,68,74,41,165,148,114,206,57,231,162,148,49,198,136,206,
+57,7,69,116,14,66,232,160,24,21,58,7,157,163,156,83,39,58,231,156,115,206,157,115,14,66,72,157,115,78,116,206,69,231,100,68,8,33,132,208,57,231,160,136,14,138,17,197,168,28,66,231,28,231,166,83,199,57,231,156,115,74,41,165,
+206,57,231,156,115,80,116,46,70,231,100,68,231,156,131,208,57,231,28,116,16,66,8,69,228,156,82,234,184,57,157,82,199,57,167,148,82,74,41,165,206,57,231,156,131,162,115,49,70,231,92,140,17,161,115,208,57,231,156,131,98,68,8,161,
+163,156,82,202,77,231,148,82,199,57,117,80,140,40,162,115,206,57,231,156,131,156,115,17,29,231,92,140,81,169,115,208,57,231,156,115,16,66,49,70,116,148,82,74,57,135,162,34,199,57,165,148,82,74,157,115,206,57,231,156,131,156,115,17,
+161,227,156,115,74,41,229,156,115,74,41,53,198,56,8,161,115,206,57,71,57,167,144,122,199,185,131,34,58,231,156,115,206,57,231,28,132,156,115,14,157,131,162,115,74,41,229,156,115,74,169,113,206,57,74,169,163,212,57,231,168,168,148,130,
+199,49,132,206,57,231,28,103,208,65,231,156,115,206,57,231,156,115,78,89,8,25,182,140,57,231,160,165,12,51,134,25,132,152,49,38,132,115,206,25,7,33,132,80,100,236,156,115,12,59,198,156,195,24,66,231,156,115,204,90,231,28,196,24,
+91,8,157,131,208,65,7,157,131,140,65,231,28,20,23,51,232,28,230,156,66,232,28,20,207,57,7,157,131,14,138,232,28,100,204,81,232,32,228,148,65,231,32,132,138,65,49,198,115,16,59,231,32,133,12,82,231,32,102,140,9,33,160,115,
+148,57,104,25,132,208,66,231,32,133,144,81,231,28,116,206,89,235,28,179,12,58,78,41,19,221,58,231,156,85,140,82,231,28,116,150,115,7,29,83,12,42,203,24,131,148,58,199,152,115,144,82,7,29,116,220,65,7,157,115,206,49,230,156,
+115,206,57,231,12,181,66,33,136,161,115,212,50,230,28,198,16,66,49,162,115,208,57,199,168,114,144,113,108,161,115,14,66,7,173,181,24,138,204,24,19,130,49,107,141,112,78,25,140,161,131,206,57,107,197,181,78,100,202,156,115,142,114,74,
+41,99,202,82,103,25,99,204,49,142,33,165,88,60,229,156,115,142,114,74,41,117,140,82,231,24,231,140,49,142,25,131,206,81,69,169,18,140,114,78,21,99,140,82,231,56,133,208,65,70,153,83,148,57,17,157,115,78,76,75,25,132,142,82,
+231,44,101,204,65,199,168,162,212,65,232,156,115,206,97,145,25,132,142,82,231,32,116,204,57,231,24,165,142,49,7,157,131,206,89,139,41,53,194,80,8,157,162,148,42,198,24,165,140,57,17,29,132,14,66,199,168,17,78,81,17,29,165,24,
+99,231,156,83,138,49,199,156,115,206,65,232,24,53,198,80,8,25,231,156,50,167,152,115,148,82,170,24,99,206,57,104,25,115,14,82,231,56,231,148,57,74,173,115,142,49,230,160,115,206,57,110,161,115,206,25,231,56,165,212,57,110,132,128,
+206,49,231,156,120,16,114,206,152,99,76,92,231,56,101,142,114,10,156,131,144,89,198,24,163,216,57,238,40,99,206,89,231,168,98,16,83,10,4,132,142,67,232,156,163,212,57,6,41,99,76,25,231,40,131,140,58,38,132,131,142,65,232,28,
+180,204,49,139,41,85,142,82,231,24,101,138,57,232,156,115,14,66,232,28,132,204,81,206,160,115,138,82,231,28,99,148,42,7,157,115,16,99,140,25,131,16,90,74,25,99,140,82,7,33,116,14,58,202,24,229,220,138,17,157,131,208,65,7,
+29,116,142,82,199,57,167,140,57,230,28,182,88,67,231,160,115,208,65,8,41,99,150,83,75,153,99,140,57,231,28,135,152,139,199,156,115,14,66,8,41,165,220,25,107,25,99,206,57,231,48,119,14,115,74,57,167,70,8,198,152,99,86,89,
+231,156,115,142,57,231,28,19,194,49,7,157,115,206,57,231,156,115,206,89,231,168,115,208,57,232,28,116,206,49,231,152,16,142,57,203,160,115,204,81,231,152,117,142,49,199,28,115,140,24,231,152,115,24,67,200,4,99,192,89,231,28,179,142,
+65,230,28,165,148,81,103,157,179,140,49,198,132,163,204,81,231,152,99,74,57,231,156,115,76,24,200,40,115,76,49,231,28,116,70,24,103,41,179,140,41,230,156,179,204,49,71,149,53,2,50,230,156,179,140,57,71,29,3,196,57,231,172,115,
+148,25,199,20,115,206,57,231,156,163,142,81,135,153,99,204,66,232,156,131,142,81,203,24,115,214,97,102,5,113,202,90,231,156,115,206,49,199,156,115,206,49,231,156,115,140,49,230,44,99,140,50,199,24,115,142,1,102,25,99,142,49,198,156,
+115,142,41,198,152,115,206,89,231,28,115,142,49,198,28,99,206,49,199,24,99,0,0,
+
+};
+
+// Runs of equal texels in every texture column (row of the transposed data)
+// Column i has the runs [purplestone_run_offsets[i], purplestone_run_offsets[i + 1]) in purplestone_run_ends
+// Each entry is the exclusive end texel of a run, so a column's last run always ends at 64
+
+constexpr uint16_t purplestone_run_offsets[64 + 1] = {
+0,18,36,63,94,119,148,181,212,243,281,319,362,397,429,462,495,531,560,593,624,656,683,707,737,765,803,837,867,892,917,949,981,1014,1042,1067,1095,1126,1162,1188,1210,1230,1257,1282,1312,1336,1369,1400,1424,1462,1489,1521,1553,1583,1617,1639,1658,1689,1722,1753,1780,1805,1836,1859,1886,
+
+};
+
+constexpr uint8_t purplestone_run_ends[1886] = {
+1,4,6,7,8,9,20,21,25,27,28,30,32,35,36,60,63,64,
+1,2,6,9,10,20,21,22,24,25,27,28,30,33,35,61,63,64,
+1,3,4,6,10,14,20,21,22,24,26,27,28,29,30,33,37,38,39,40,41,43,45,46,61,63,64,
+1,2,4,5,6,7,8,9,10,19,21,22,23,28,31,34,36,38,39,40,41,42,44,50,52,53,54,60,61,62,64,
+2,3,4,7,8,9,11,17,20,22,25,28,31,34,35,37,38,40,41,43,49,59,60,63,64,
+2,3,4,9,14,19,22,24,25,27,29,30,31,33,37,40,41,43,44,45,46,48,49,55,59,61,62,63,64,
+5,6,7,8,13,16,19,21,22,24,26,27,28,29,31,32,33,34,36,37,40,41,42,46,48,49,54,55,59,61,62,63,64,
+6,7,8,12,13,15,16,19,20,23,25,26,28,30,31,32,34,35,36,41,43,44,45,48,54,58,59,61,62,63,64,
+1,3,5,6,7,14,15,18,21,22,23,26,27,31,32,40,41,42,43,44,46,48,49,53,54,57,58,59,60,61,64,
+1,2,3,5,6,7,12,13,14,15,17,18,19,20,21,22,23,26,27,33,34,36,38,41,42,43,44,49,50,53,54,55,57,59,60,61,62,64,
+1,2,3,4,5,8,11,14,15,16,17,18,19,21,22,25,26,27,29,31,32,38,39,42,43,46,49,50,51,53,54,56,57,58,59,61,62,64,
+1,4,5,7,10,12,13,14,15,16,17,20,21,22,23,25,26,28,29,30,31,32,34,38,40,41,43,44,46,47,50,51,53,54,55,56,57,58,59,60,61,62,64,
+1,2,3,5,6,8,14,20,21,22,26,27,28,31,32,33,34,35,37,39,41,44,45,46,47,48,53,54,55,56,58,59,60,61,64,
+2,3,5,6,12,21,22,26,29,31,33,36,38,39,40,43,46,47,49,50,51,52,53,54,55,56,57,58,60,62,63,64,
+5,6,7,12,13,20,21,24,25,27,28,29,30,31,32,34,40,42,45,48,49,51,52,53,54,55,57,58,59,60,62,63,64,
+5,6,7,8,10,12,13,18,19,20,21,23,25,26,28,29,30,31,32,34,38,40,42,45,47,50,53,54,55,56,62,63,64,
+5,6,7,8,9,11,16,20,21,23,24,25,26,27,28,29,30,31,32,34,35,36,37,40,42,46,47,49,50,54,55,56,60,62,63,64,
+6,8,10,16,18,19,20,21,23,28,29,30,32,33,34,39,40,41,42,47,48,49,54,58,59,60,62,63,64,
+6,7,8,9,10,13,14,18,19,20,22,23,26,27,31,33,34,35,36,41,42,43,46,47,49,50,52,53,57,60,62,63,64,
+1,2,4,5,7,9,10,12,14,16,19,22,28,31,32,42,43,45,46,48,49,50,51,52,53,57,58,61,62,63,64,
+1,5,6,10,11,13,14,15,21,22,28,29,31,32,36,37,41,42,43,44,46,48,49,50,51,52,53,57,59,61,63,64,
+1,2,4,6,7,8,9,10,11,15,18,21,22,27,37,38,42,43,51,52,55,58,59,60,61,63,64,
+1,4,6,9,10,11,12,15,16,20,21,29,34,35,36,38,49,50,51,52,54,61,63,64,
+1,3,4,5,7,9,10,12,15,18,20,23,25,26,28,32,35,37,38,41,43,47,52,53,56,57,58,60,63,64,
+1,3,5,6,10,17,18,19,20,21,22,23,25,26,28,31,34,35,45,46,47,48,50,51,53,61,62,64,
+1,3,4,5,7,8,11,16,17,18,19,20,21,22,25,26,27,28,31,33,34,36,37,38,39,44,45,46,47,49,50,52,54,59,61,62,63,64,
+1,2,5,8,9,11,15,16,17,18,19,20,22,23,26,27,28,31,32,33,35,37,44,45,51,52,54,56,57,58,59,61,63,64,
+3,5,8,9,15,16,17,18,19,21,23,26,27,28,30,31,34,39,40,41,44,45,49,51,53,56,59,61,63,64,
+6,10,13,15,16,17,18,19,21,23,25,26,27,28,30,31,39,40,44,45,50,61,62,63,64,
+5,10,11,12,16,19,20,22,23,24,27,32,33,40,42,44,51,53,55,56,58,60,61,63,64,
+4,7,8,9,10,12,14,16,17,20,21,22,23,24,25,31,32,35,36,44,47,48,51,53,54,56,58,59,60,62,63,64,
+4,6,7,8,10,11,14,15,16,18,23,24,28,29,30,31,34,35,44,46,47,49,51,53,54,55,58,59,60,62,63,64,
+4,6,7,8,9,10,12,14,15,17,19,22,23,28,29,31,33,37,38,42,43,45,50,51,52,53,55,57,58,60,62,63,64,
+4,5,7,12,14,16,17,18,19,29,31,32,33,34,42,43,46,48,51,53,54,55,57,58,60,62,63,64,
+4,5,7,8,9,10,21,26,27,32,33,36,40,42,46,47,49,52,53,56,58,60,62,63,64,
+5,7,8,9,12,22,23,24,26,27,29,32,34,36,37,38,39,40,42,43,47,48,53,57,61,62,63,64,
+1,4,7,9,10,23,24,26,27,29,30,31,32,37,38,39,41,42,44,45,48,49,52,54,55,57,59,60,62,63,64,
+1,4,5,6,8,9,10,11,15,17,22,23,24,31,32,34,36,38,39,40,41,44,45,47,48,49,50,52,53,54,55,56,58,59,61,64,
+3,4,5,6,7,9,10,12,18,19,20,21,24,27,30,31,32,34,37,38,45,47,48,50,53,64,
+4,5,6,9,12,17,24,25,37,40,41,42,45,46,47,48,49,50,53,57,62,64,
+1,2,4,5,6,8,10,14,15,18,19,20,22,25,39,46,51,61,62,64,
+1,2,3,4,5,8,9,13,23,25,26,35,37,38,39,41,48,49,50,52,56,58,59,60,61,62,64,
+1,2,3,4,12,13,14,15,16,17,21,25,27,35,37,38,39,46,48,52,53,54,61,62,64,
+1,3,4,11,12,13,14,15,16,19,25,26,27,28,30,35,37,40,41,45,46,47,51,53,54,55,60,62,63,64,
+4,10,12,13,15,16,18,20,23,24,25,27,37,38,40,41,43,45,46,51,60,62,63,64,
+4,7,13,14,15,18,19,20,21,22,24,25,26,27,30,31,37,38,40,41,42,43,45,50,53,54,56,57,59,60,62,63,64,
+4,6,8,11,14,17,18,19,20,22,24,25,27,28,37,38,39,40,41,42,48,50,52,53,54,57,59,60,62,63,64,
+4,6,10,11,12,14,17,20,24,25,27,29,32,41,44,48,50,52,53,58,60,61,63,64,
+4,5,6,7,12,13,15,16,17,18,19,20,21,22,23,24,25,26,28,31,32,34,40,41,44,46,48,49,50,51,52,53,54,59,60,61,63,64,
+4,5,6,10,13,14,21,22,23,24,25,28,30,33,34,39,40,43,46,48,49,50,51,52,58,59,64,
+4,7,8,9,11,15,16,19,21,23,24,25,26,28,29,30,33,35,38,39,40,42,44,48,49,50,51,52,58,59,60,64,
+4,5,6,7,8,9,10,14,15,16,21,22,23,24,25,30,31,33,38,39,41,42,47,48,55,57,58,59,60,62,63,64,
+5,6,8,14,17,18,19,21,22,29,30,31,32,33,34,38,39,41,42,44,47,48,50,52,54,55,58,62,63,64,
+6,8,9,11,13,14,15,17,18,19,21,28,29,34,35,38,39,42,44,45,46,47,50,51,52,53,54,55,56,57,59,62,63,64,
+7,15,16,17,18,26,27,35,36,39,40,41,42,44,45,46,52,54,60,61,63,64,
+2,6,10,17,18,20,22,25,26,27,36,39,40,43,47,49,61,63,64,
+1,2,6,7,11,15,18,21,22,24,30,34,36,40,41,44,46,48,49,51,52,53,54,55,56,58,59,60,61,63,64,
+1,3,5,6,8,9,12,13,15,16,23,29,30,32,36,37,41,42,43,44,46,49,50,51,53,54,55,57,58,60,61,63,64,
+1,2,10,14,17,18,22,23,26,27,29,30,31,38,42,43,44,45,46,47,49,50,52,53,54,56,59,61,62,63,64,
+1,8,13,21,22,23,25,27,29,30,31,32,36,38,43,44,45,50,51,52,54,57,58,59,61,62,64,
+1,4,13,20,21,22,24,27,30,33,35,37,38,44,45,47,51,52,53,54,57,58,59,61,64,
+1,3,4,5,6,8,9,10,11,20,21,24,25,26,27,30,33,35,37,38,45,48,51,52,53,58,60,61,62,63,64,
+1,3,10,20,21,24,25,27,28,32,36,40,44,47,48,51,57,58,60,61,62,63,64,
+1,3,4,5,6,7,19,21,25,26,28,29,30,32,36,40,43,44,48,51,52,54,58,59,60,63,64,
 
 };
 
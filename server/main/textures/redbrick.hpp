@@ -1,78 +1,146 @@
 
 #pragma once
 
-// Generated by generate_texture.py on 2022-09-07T14:50:30.460999
+// Generated by generate_texture.py on 2026-10-16T14:06:50.006504
 
 #include <cstdint>
 
 namespace textures
 {
 
-constexpr uint8_t redbrick[64 * 64] = {
-9,82,9,82,82,82,82,82,82,82,82,82,192,128,128,64,128,64,64,64,9,82,82,82,9,82,82,82,82,82,82,82,128,128,128,128,128,128,64,64,9,82,9,82,82,82,9,82,9,82,9,82,192,64,128,128,64,64,64,64,64,9,9,82,
-9,9,192,192,192,192,192,128,128,64,82,9,192,128,128,128,128,128,128,64,9,82,192,192,192,128,128,128,192,128,82,82,128,128,64,64,128,128,64,64,9,82,192,192,192,192,192,192,192,128,82,9,192,128,64,64,128,128,128,128,64,9,82,82,
-9,82,192,192,128,64,128,64,128,64,9,9,192,128,128,128,128,64,64,64,9,82,192,128,128,64,128,64,128,128,9,82,128,128,128,128,64,64,128,64,9,82,192,128,128,128,128,128,128,64,9,82,192,64,64,64,64,64,64,64,64,9,9,82,
-9,82,192,128,64,128,64,128,64,64,9,9,192,128,128,128,128,128,64,64,9,9,192,128,128,128,128,64,64,64,9,82,128,128,128,128,128,128,128,64,9,9,192,128,64,64,128,64,64,64,9,9,192,128,128,64,128,128,64,128,64,9,82,82,
-9,82,192,128,128,128,128,128,128,64,9,9,128,128,64,128,128,64,64,64,9,9,192,128,128,128,128,128,64,64,9,82,128,128,128,64,128,64,64,64,9,82,192,128,128,128,128,128,128,64,9,82,192,128,64,128,64,64,64,64,64,9,9,82,
-9,82,192,192,128,64,128,64,64,64,9,82,128,64,128,64,64,128,64,64,9,82,192,64,128,64,64,64,64,64,9,82,128,192,128,128,128,128,64,64,9,9,192,128,128,64,128,128,64,64,9,82,128,64,128,64,64,128,128,64,64,9,9,82,
-9,82,192,128,128,128,64,128,64,64,9,82,128,128,128,128,64,64,64,64,9,82,192,128,128,128,128,128,64,64,9,82,128,128,64,64,128,64,128,64,9,9,192,64,64,128,64,64,128,64,9,82,128,128,64,128,128,64,128,128,64,9,9,82,
-9,82,192,128,128,128,128,128,64,64,9,82,128,64,64,64,128,128,128,64,9,9,192,64,64,64,64,64,64,64,9,9,128,128,128,128,64,128,64,64,9,82,192,128,128,64,128,128,64,64,9,82,128,64,128,64,64,128,64,64,64,9,82,82,
-9,82,192,192,64,128,64,64,64,64,9,82,128,128,128,128,64,64,64,64,9,82,192,128,64,128,64,128,64,64,9,82,128,192,128,128,128,128,64,64,9,82,192,128,128,64,128,64,128,64,9,82,128,128,64,64,128,128,128,64,64,9,82,82,
-9,82,192,128,128,64,128,128,64,64,9,9,128,128,128,128,128,128,128,64,9,9,192,64,128,64,128,64,64,64,9,9,128,128,64,64,64,64,64,64,9,9,128,64,128,128,64,128,128,64,9,82,128,64,64,128,64,64,64,64,64,9,82,82,
-9,82,192,192,128,128,128,64,128,64,9,9,128,128,64,128,128,64,64,64,9,82,128,128,128,128,128,128,64,64,9,9,128,64,64,64,64,64,64,64,9,9,128,128,64,64,128,64,64,64,9,82,128,192,128,64,128,128,64,128,64,9,82,82,
-9,82,192,128,64,64,64,64,64,64,9,9,128,64,128,64,64,128,64,64,9,82,128,128,128,64,128,64,64,64,9,9,82,9,9,9,9,9,9,9,9,9,128,128,128,128,128,128,128,64,9,82,128,64,64,64,64,64,64,64,64,9,82,82,
-9,82,128,64,64,64,64,64,64,64,9,9,128,128,128,128,128,128,128,64,9,9,128,128,128,128,64,128,128,64,9,82,9,82,82,82,82,82,82,82,82,9,128,64,64,128,64,64,128,64,9,91,128,128,64,128,64,64,128,128,64,9,82,82,
-9,82,82,9,9,9,9,9,9,9,9,9,128,128,128,128,64,128,64,64,9,9,128,128,128,128,64,64,64,64,9,82,82,9,82,9,82,82,82,82,82,82,128,128,128,64,128,128,128,64,9,91,128,64,64,128,64,128,64,64,64,9,82,82,
-9,82,82,82,82,82,82,82,9,9,9,82,128,128,64,64,64,64,64,64,9,9,128,128,128,128,128,128,128,64,9,91,192,192,192,192,192,192,128,128,82,82,128,64,64,128,64,64,128,64,9,82,128,128,128,64,64,128,128,64,64,9,9,82,
-9,82,82,82,82,82,82,82,82,82,82,9,128,64,64,64,64,64,64,64,9,9,128,192,128,128,64,128,64,64,9,91,192,128,64,64,128,64,64,64,9,9,128,128,128,128,128,128,128,64,9,82,128,64,64,128,128,64,64,128,64,9,82,82,
-9,82,192,192,192,192,128,128,128,64,82,82,82,9,9,9,9,9,9,9,9,82,128,128,128,64,128,64,64,64,9,82,192,64,128,128,64,128,128,64,9,9,128,128,128,64,128,64,128,64,9,82,128,128,128,64,64,128,128,64,64,9,82,82,
-9,9,192,128,128,128,128,192,128,64,9,82,82,82,82,9,9,82,82,82,82,82,128,128,64,128,64,128,128,64,9,82,192,128,64,128,128,64,128,64,9,9,128,64,64,128,64,64,64,64,9,9,128,64,64,64,64,64,64,64,64,9,82,82,
-9,82,192,128,128,128,128,128,64,64,9,82,82,82,82,82,82,82,82,82,9,82,128,128,128,128,64,128,64,64,9,82,192,64,128,64,64,64,64,64,9,82,128,128,128,128,128,128,128,64,9,82,82,9,9,9,9,9,9,9,9,9,82,82,
-9,82,192,128,128,128,128,128,64,64,9,82,192,192,192,192,192,192,128,128,82,82,128,128,64,64,128,128,64,64,9,82,192,128,128,128,128,128,128,64,9,82,128,64,64,128,64,64,64,64,9,82,82,82,82,82,82,82,82,82,82,82,82,82,
-9,82,192,128,128,128,128,64,64,64,9,82,192,64,128,64,64,128,128,64,9,82,128,128,128,128,64,64,64,64,9,82,192,128,64,128,64,128,64,64,9,82,128,128,128,64,128,128,64,64,9,82,82,82,82,82,82,82,82,82,82,82,82,82,
-9,82,192,128,128,128,128,128,128,64,9,82,192,128,64,128,128,64,64,64,9,82,128,128,128,128,128,128,64,64,9,82,192,64,128,64,64,64,64,64,9,82,128,128,128,64,128,64,64,64,9,82,192,192,192,192,192,192,192,192,128,82,82,82,
-9,82,192,128,64,64,128,64,64,64,9,82,192,192,128,128,128,128,128,64,9,82,128,128,64,128,128,64,128,64,9,82,128,128,128,128,128,128,128,64,9,82,128,128,128,128,64,128,128,64,9,82,192,128,64,64,128,64,64,128,64,9,82,82,
-9,82,192,128,128,128,128,128,64,64,9,9,192,64,64,128,64,64,64,64,9,9,128,64,128,64,64,128,64,64,9,82,128,128,64,64,128,128,64,64,9,82,128,64,64,64,128,64,64,64,9,9,192,128,128,64,64,128,128,64,64,9,82,82,
-9,82,192,64,128,128,64,64,128,64,9,9,192,128,128,128,128,128,64,64,9,82,128,128,128,64,128,64,128,64,9,9,128,128,128,128,128,128,128,64,9,82,128,128,128,128,128,128,128,64,9,9,192,128,64,64,64,128,64,64,64,9,82,82,
-9,82,192,128,64,128,128,128,64,64,9,9,192,64,128,128,64,128,128,64,9,9,128,192,64,128,64,64,64,64,9,9,128,128,128,128,128,128,64,64,9,82,128,64,64,64,64,64,64,64,9,9,192,128,128,128,128,64,128,128,64,9,82,82,
-9,82,192,128,128,64,64,64,64,64,9,82,192,128,128,64,128,64,64,64,9,82,128,64,128,64,64,128,64,64,9,82,128,64,128,128,64,128,128,64,9,82,128,128,128,128,128,128,128,64,9,82,192,64,64,64,64,128,64,64,64,9,82,82,
-9,82,192,128,128,128,128,128,64,64,9,82,192,128,128,128,128,128,128,64,9,9,128,64,64,64,64,64,64,64,9,9,128,128,64,64,128,64,64,64,9,9,128,128,64,64,128,64,64,64,9,82,192,128,64,64,128,64,64,128,64,9,82,82,
-9,82,192,128,128,64,128,128,128,64,9,82,192,128,64,128,64,64,64,64,9,82,82,9,9,9,9,9,9,9,9,9,128,128,128,128,128,128,128,64,9,9,128,64,128,128,128,128,128,64,9,82,192,64,64,64,64,64,64,64,64,9,82,82,
-9,82,192,128,64,128,64,64,64,64,9,82,192,128,128,64,64,128,64,64,9,82,82,82,82,82,82,82,9,9,82,82,128,64,128,64,64,64,64,64,9,9,128,64,64,128,64,64,64,64,9,82,192,128,64,128,128,128,128,128,64,9,82,82,
-9,82,192,64,128,64,128,64,128,64,9,9,192,192,64,128,128,64,128,64,9,82,82,82,82,91,82,82,82,82,82,82,128,128,128,128,128,64,128,64,9,82,128,128,128,64,64,128,128,64,9,82,192,64,128,64,64,64,64,64,64,9,82,82,
-9,82,192,128,128,128,64,128,64,64,9,9,192,128,64,128,64,64,64,64,9,82,192,192,192,192,192,192,192,128,82,82,128,128,128,128,128,128,128,64,9,82,128,64,64,64,64,64,64,64,9,9,128,128,64,128,128,64,128,128,64,9,82,82,
-9,82,192,64,64,64,128,64,64,64,9,82,192,128,128,64,128,128,64,64,9,82,192,128,128,128,64,192,128,64,9,82,128,64,64,128,64,64,64,64,9,82,9,9,9,9,9,9,9,9,9,82,128,64,128,64,64,64,64,64,64,9,82,82,
-9,82,192,128,128,128,64,128,128,64,9,82,192,128,128,128,128,128,128,64,9,9,192,64,128,64,128,64,64,64,9,82,128,128,128,128,128,128,128,64,9,82,82,82,82,9,9,9,9,82,82,82,128,128,128,128,128,128,128,128,64,9,82,82,
-9,82,192,192,128,64,128,64,64,64,9,82,128,64,64,128,64,64,64,64,9,82,192,192,128,128,64,128,128,64,9,82,128,128,64,64,128,128,64,64,9,82,9,82,82,82,82,82,82,82,9,82,128,64,64,128,64,64,64,64,64,9,9,82,
-9,82,192,128,64,64,64,64,64,64,9,82,128,128,128,64,128,64,128,64,9,82,192,128,64,64,128,64,64,64,9,9,128,64,128,128,64,64,128,64,9,9,192,192,192,192,192,192,192,128,82,9,128,128,128,64,128,128,128,64,64,9,82,82,
-9,82,128,64,64,64,64,64,64,64,9,82,128,128,64,64,64,64,64,64,9,82,192,128,128,128,128,128,128,64,9,82,128,128,128,128,128,128,128,64,9,82,192,128,128,128,128,128,64,64,9,82,128,128,128,128,64,64,64,128,64,9,82,82,
-9,82,82,9,9,9,9,9,9,9,9,82,128,128,128,64,128,128,128,64,9,9,192,128,64,64,64,128,64,64,9,82,128,64,64,64,128,64,64,64,9,9,192,128,128,128,64,64,128,64,9,82,128,128,64,64,64,64,64,64,64,9,82,82,
-9,82,9,82,82,82,9,9,9,9,82,82,128,128,64,128,64,64,64,64,9,9,192,128,128,128,128,128,64,64,9,82,128,128,128,128,64,128,64,64,9,82,192,64,64,64,128,64,64,64,9,82,128,64,64,128,128,64,128,64,64,9,82,82,
-9,82,82,9,82,82,82,82,82,82,82,9,128,128,128,128,128,128,128,64,9,9,192,128,64,64,128,128,64,64,9,82,128,64,64,64,64,64,64,64,9,9,192,128,128,64,128,128,128,64,9,82,128,128,128,64,64,64,128,128,64,9,9,82,
-9,82,192,192,192,192,128,128,128,128,9,82,128,128,128,128,128,64,128,64,9,82,192,128,128,128,64,64,64,64,9,82,82,9,9,9,9,9,9,9,9,82,192,64,64,128,64,64,64,64,9,82,128,64,64,128,128,128,64,64,64,9,9,82,
-9,82,192,128,128,64,64,128,64,64,9,82,128,64,128,64,64,128,64,64,9,82,192,128,128,128,128,128,64,64,9,9,82,82,82,82,82,82,82,82,82,82,192,128,64,128,128,64,128,64,9,82,128,128,128,64,128,64,128,128,64,9,82,82,
-9,82,192,192,128,128,128,128,64,64,9,82,128,192,64,128,128,128,128,64,9,82,192,128,64,64,64,64,64,64,9,82,82,82,82,91,91,82,82,82,82,82,192,64,64,64,64,64,64,64,9,82,128,64,64,128,64,64,64,64,64,9,9,82,
-9,82,192,128,64,64,64,64,64,64,9,82,128,64,128,64,64,64,64,64,9,82,128,128,128,128,128,128,128,64,9,9,192,192,192,192,192,192,192,128,82,82,192,128,128,64,128,128,64,64,9,82,128,128,128,128,64,128,128,128,64,9,9,82,
-9,82,192,192,64,128,128,128,64,64,9,82,128,192,128,128,128,128,64,64,9,82,128,64,64,64,64,64,64,64,9,82,192,128,128,128,64,128,128,64,9,82,192,64,64,128,64,64,128,64,9,82,128,64,64,64,128,64,64,64,64,9,82,82,
-9,82,192,128,128,128,128,128,64,64,9,82,128,128,128,64,64,128,128,64,9,82,128,64,128,128,128,64,128,64,9,82,192,64,64,64,128,64,64,64,9,9,128,128,128,64,128,128,64,64,9,82,128,64,128,64,64,64,128,128,64,9,82,82,
-9,82,192,128,128,64,64,64,64,64,9,91,128,128,64,128,128,64,64,64,9,9,128,128,128,128,128,64,64,64,9,82,192,128,128,128,128,128,128,64,9,82,128,64,64,64,64,64,64,64,9,82,128,64,64,64,64,64,64,64,64,9,82,82,
-9,82,192,192,64,128,128,128,128,64,9,91,128,128,128,64,64,128,64,64,9,9,128,128,64,64,64,64,128,64,9,82,192,64,64,64,64,128,64,64,9,82,128,128,128,128,64,128,128,64,9,82,82,9,9,9,9,9,9,9,9,9,9,82,
-9,82,192,64,128,64,64,64,64,64,9,82,128,192,128,128,128,128,128,64,9,82,128,64,128,128,128,128,64,64,9,82,192,128,128,128,128,64,128,64,9,82,128,128,64,128,64,64,64,64,9,82,9,82,82,82,82,82,9,9,82,9,82,82,
-9,82,192,192,128,128,64,128,64,64,9,82,128,128,64,128,64,64,64,64,9,82,128,128,64,64,64,64,64,64,9,82,192,128,128,128,64,128,128,64,9,82,128,64,128,64,128,128,128,64,9,82,82,82,82,82,82,82,82,82,82,82,82,82,
-9,82,192,64,64,64,128,64,64,64,9,82,128,192,128,64,128,128,128,64,9,82,128,128,128,64,128,128,128,64,9,82,192,64,64,128,128,128,128,64,82,91,128,128,64,128,64,64,64,64,9,82,192,192,192,192,192,192,192,192,128,82,82,82,
-9,9,192,192,128,128,128,128,128,64,9,82,128,128,64,64,64,64,64,64,9,82,128,64,64,128,64,64,64,64,9,9,192,128,128,128,128,128,128,64,9,82,128,128,128,64,128,128,128,64,9,82,192,128,64,64,128,64,64,64,64,9,82,82,
-9,9,192,128,128,128,64,128,64,64,9,82,128,64,64,64,64,64,64,64,9,82,128,128,128,128,128,128,64,64,9,82,192,64,128,128,64,64,128,64,9,82,128,64,64,64,64,64,64,64,9,82,192,64,128,128,64,128,128,64,64,9,9,82,
-9,9,192,192,128,128,128,128,64,64,9,82,82,9,9,9,9,9,9,9,9,82,128,128,128,64,128,64,128,64,9,82,192,128,128,128,64,128,128,64,9,82,128,128,128,128,128,128,128,64,9,82,192,128,64,64,64,128,64,64,64,9,82,82,
-9,82,192,128,128,64,128,64,64,64,9,9,82,82,82,82,9,9,82,82,82,82,128,128,128,128,128,128,64,64,9,82,128,64,64,64,128,64,64,64,9,82,128,128,64,64,128,64,64,64,9,9,192,128,128,64,128,128,64,128,64,9,82,82,
-9,82,192,128,128,128,128,128,128,64,9,82,82,9,82,82,82,82,82,9,82,9,128,128,64,128,64,128,128,64,9,82,128,128,128,128,64,128,128,64,9,9,128,64,128,128,128,64,128,64,9,9,192,64,64,128,128,64,64,64,64,9,82,82,
-9,82,192,128,64,128,128,64,64,64,9,82,192,192,192,192,192,128,128,128,82,82,128,128,128,128,128,128,64,64,9,82,128,64,128,64,128,64,64,64,9,82,128,128,128,64,128,128,64,64,9,9,128,128,128,128,64,128,128,128,64,9,82,82,
-9,82,192,64,128,64,64,128,64,64,9,9,192,192,128,64,128,64,128,64,9,82,128,64,128,128,64,64,128,64,9,9,128,128,128,128,128,128,128,64,9,82,128,64,64,128,64,64,128,64,9,9,128,64,64,128,64,128,64,64,64,9,82,82,
-9,82,192,192,128,128,128,128,64,64,9,82,192,64,64,128,64,128,64,64,9,9,128,128,64,64,128,64,64,64,9,82,128,128,64,128,128,128,64,64,9,82,128,128,128,64,64,128,64,64,9,9,128,128,128,64,128,64,128,128,64,9,82,82,
-9,82,128,128,64,64,64,64,128,64,9,82,192,128,128,128,128,128,64,64,9,82,128,128,128,128,128,64,128,64,9,82,128,128,128,128,128,128,128,64,9,82,128,64,128,128,128,128,128,64,9,9,128,64,128,128,64,64,64,64,64,9,9,82,
-9,82,128,192,128,128,128,128,64,64,9,82,192,128,128,128,64,64,64,64,9,82,128,64,64,64,64,128,64,64,9,82,128,64,64,128,128,64,64,64,9,82,128,128,64,64,128,64,64,64,9,82,128,128,64,64,128,64,64,128,64,9,82,82,
-9,82,128,128,64,64,128,64,128,64,9,82,192,128,64,64,128,128,64,64,9,82,128,128,64,64,64,64,64,64,9,82,128,128,128,64,64,128,128,64,9,9,128,128,128,128,128,64,128,64,9,82,128,64,128,64,64,128,64,64,64,9,82,82,
-9,82,128,64,64,64,64,64,64,64,9,82,192,128,128,128,128,64,128,64,9,82,128,64,64,64,64,64,64,64,9,82,128,64,128,128,64,128,128,64,9,82,128,64,64,64,64,64,64,64,9,82,128,128,128,64,64,64,128,128,64,9,82,82,
-9,9,82,9,9,9,9,9,9,9,9,9,192,128,128,64,64,128,64,64,9,82,82,9,9,9,9,9,9,9,9,9,128,128,64,64,128,64,64,64,9,9,82,9,9,9,9,9,9,9,9,82,128,64,64,128,128,128,64,64,64,9,82,82,
+// Colors of all levels in rgb233, texels are indices into the palette packed in redbrick_index_bits each
+constexpr auto redbrick_index_bits = 4;
+
+constexpr uint8_t redbrick_palette[10] = {
+0,9,18,64,73,82,91,128,137,192,
+
+};
+
+// Palette indices of the 64x64 texels followed by prefiltered mip levels 1 to 6 (32x32 down to 1x1),
+// box-filtered from the source texture
+// Levels are transposed (stored column by column) and packed least significant bit first, with a byte of padding at the end
+
+constexpr uint8_t redbrick_texels[2732] = {
+81,81,85,85,85,85,121,55,55,51,81,85,81,85,85,85,119,119,119,51,81,81,85,81,81,81,57,119,51,51,19,81,17,153,153,121,55,21,121,119,119,55,81,153,121,119,121,85,119,51,119,51,81,153,153,153,121,21,121,51,119,119,19,85,
+81,153,55,55,55,17,121,119,55,51,81,121,55,55,119,81,119,119,51,55,81,121,119,119,55,81,57,51,51,51,19,81,81,121,115,115,51,17,121,119,119,51,17,121,119,55,51,81,119,119,119,55,17,121,51,55,51,17,121,55,119,115,19,85,
+81,121,119,119,55,17,119,115,55,51,17,121,119,119,51,81,119,55,55,51,81,121,119,119,55,81,121,115,51,51,19,81,81,153,55,55,51,81,55,55,115,51,81,57,55,51,51,81,151,119,119,51,17,121,55,119,51,81,55,55,115,55,19,81,
+81,121,119,115,51,81,119,119,51,51,81,121,119,119,51,81,119,51,55,55,17,57,115,51,55,81,119,115,55,119,19,81,81,121,119,119,51,81,55,51,119,55,17,57,51,51,51,17,119,119,115,51,81,121,55,119,51,81,55,55,115,51,19,85,
+81,153,115,51,51,81,119,119,51,51,81,121,115,115,51,81,151,119,119,51,81,121,55,55,55,81,119,51,119,55,19,85,81,121,55,119,51,17,119,119,119,55,17,57,55,55,51,17,119,51,51,51,17,55,119,115,55,81,55,115,51,51,19,85,
+81,153,119,55,55,17,119,115,55,51,81,119,119,119,51,17,55,51,51,51,17,119,51,55,51,81,151,55,119,115,19,85,81,121,51,51,51,17,55,55,115,51,81,119,55,55,51,17,21,17,17,17,17,119,119,119,55,81,55,51,51,51,19,85,
+81,55,51,51,51,17,119,119,119,55,17,119,119,115,55,81,81,85,85,85,21,55,115,51,55,97,119,115,51,119,19,85,81,21,17,17,17,17,119,119,115,51,17,119,119,51,51,81,21,21,85,85,85,119,55,119,55,97,55,115,115,51,19,85,
+81,85,85,85,17,81,119,51,51,51,17,119,119,119,55,97,153,153,153,119,85,55,115,51,55,81,119,55,115,55,19,81,81,85,85,85,85,21,55,51,51,51,17,151,119,115,51,97,121,51,55,51,17,119,119,119,55,81,55,115,55,115,19,85,
+81,153,153,119,55,85,21,17,17,17,81,119,55,55,51,81,57,119,115,55,17,119,55,55,55,81,119,55,115,55,19,85,17,121,119,151,55,81,85,21,81,85,85,119,115,115,55,81,121,115,55,55,17,55,115,51,51,17,55,51,51,51,19,85,
+81,121,119,119,51,81,85,85,85,85,81,119,119,115,51,81,57,55,51,51,81,119,119,119,55,81,21,17,17,17,17,85,81,121,119,119,51,81,153,153,153,119,85,119,51,119,51,81,121,119,119,55,81,55,115,51,51,81,85,85,85,85,85,85,
+81,121,119,55,51,81,57,55,115,55,81,119,119,51,51,81,121,115,115,51,81,119,55,119,51,81,85,85,85,85,85,85,81,121,119,119,55,81,121,115,55,51,81,119,119,119,51,81,57,55,51,51,81,119,55,55,51,81,153,153,153,153,87,85,
+81,121,51,55,51,81,153,119,119,55,81,119,115,55,55,81,119,119,119,55,81,119,119,115,55,81,121,51,55,115,19,85,81,121,119,119,51,17,57,115,51,51,17,55,55,115,51,81,119,51,119,51,81,55,51,55,51,17,121,55,115,55,19,85,
+81,57,119,51,55,17,121,119,119,51,81,119,55,55,55,17,119,119,119,55,81,119,119,119,55,17,121,51,115,51,19,85,81,121,115,119,51,17,57,119,115,55,17,151,115,51,51,17,119,119,119,51,81,55,51,51,51,17,121,119,55,119,19,85,
+81,121,55,51,51,81,121,55,55,51,81,55,55,115,51,81,55,119,115,55,81,119,119,119,55,81,57,51,115,51,19,85,81,121,119,119,51,81,121,119,119,55,17,55,51,51,51,17,119,51,55,51,17,119,51,55,51,81,121,51,55,115,19,85,
+81,121,55,119,55,81,121,115,51,51,81,21,17,17,17,17,119,119,119,55,17,55,119,119,55,81,57,51,51,51,19,85,81,121,115,51,51,81,121,55,115,51,81,85,85,85,17,85,55,55,51,51,17,55,115,51,51,81,121,115,119,119,19,85,
+81,57,55,55,55,17,153,115,55,55,81,85,101,85,85,85,119,119,55,55,81,119,55,115,55,81,57,55,51,51,19,85,81,121,119,115,51,17,121,115,51,51,81,153,153,153,121,85,119,119,119,55,81,55,51,51,51,17,119,115,55,119,19,85,
+81,57,51,55,51,81,121,55,119,51,81,121,119,147,55,81,55,115,51,51,81,17,17,17,17,81,55,55,51,51,19,85,81,121,119,115,55,81,121,119,119,55,17,57,55,55,51,81,119,119,119,55,81,85,21,17,81,85,119,119,119,119,19,85,
+81,153,55,55,51,81,55,115,51,51,81,153,119,115,55,81,119,51,119,51,81,81,85,85,85,81,55,115,51,51,19,81,81,121,51,51,51,81,119,55,55,55,81,121,51,55,51,17,55,119,51,55,17,153,153,153,121,21,119,55,119,55,19,85,
+81,55,51,51,51,81,119,51,51,51,81,121,119,119,55,81,119,119,119,55,81,121,119,119,51,81,119,119,51,115,19,85,81,21,17,17,17,81,119,55,119,55,17,121,51,115,51,81,55,51,55,51,17,121,119,51,55,81,119,51,51,51,19,85,
+81,81,85,17,17,85,119,115,51,51,17,121,119,119,51,81,119,119,115,51,81,57,51,55,51,81,55,115,55,55,19,85,81,21,85,85,85,21,119,119,119,55,17,121,51,119,51,81,55,51,51,51,17,121,55,119,55,81,119,55,51,119,19,81,
+81,153,153,119,119,81,119,119,55,55,81,121,119,51,51,81,21,17,17,17,81,57,115,51,51,81,55,115,119,51,19,81,81,121,55,115,51,81,55,55,115,51,81,121,119,119,51,17,85,85,85,85,85,121,115,55,55,81,119,55,55,119,19,85,
+81,153,119,119,51,81,151,115,119,55,81,121,51,51,51,81,85,101,86,85,85,57,51,51,51,81,55,115,51,51,19,81,81,121,51,51,51,81,55,55,51,51,81,119,119,119,55,17,153,153,153,121,85,121,55,119,51,81,119,119,115,119,19,81,
+81,153,115,119,51,81,151,119,119,51,81,55,51,51,51,81,121,119,115,55,81,57,115,51,55,81,55,51,55,51,19,85,81,121,119,119,51,81,119,55,115,55,81,55,119,55,55,81,57,51,55,51,17,119,55,119,51,81,55,55,51,119,19,85,
+81,121,55,51,51,97,119,115,55,51,17,119,119,55,51,81,121,119,119,55,81,55,51,51,51,81,55,51,51,51,19,85,81,153,115,119,55,97,119,55,115,51,17,119,51,51,55,81,57,51,115,51,81,119,119,115,55,81,21,17,17,17,17,81,
+81,57,55,51,51,81,151,119,119,55,81,55,119,119,51,81,121,119,55,55,81,119,115,51,51,81,81,85,85,17,21,85,81,153,119,115,51,81,119,115,51,51,81,119,51,51,51,81,121,119,115,55,81,55,55,119,55,81,85,85,85,85,85,85,
+81,57,51,55,51,81,151,55,119,55,81,119,55,119,55,81,57,115,119,55,101,119,115,51,51,81,153,153,153,153,87,85,17,153,119,119,55,81,119,51,51,51,81,55,115,51,51,17,121,119,119,55,81,119,55,119,55,81,121,51,55,51,19,85,
+17,121,119,115,51,81,55,51,51,51,81,119,119,119,51,81,57,119,51,55,81,55,51,51,51,81,57,119,115,55,19,81,17,153,119,119,51,81,21,17,17,17,81,119,55,55,55,81,121,119,115,55,81,119,119,119,55,81,121,51,115,51,19,85,
+81,121,55,55,51,17,85,85,17,85,85,119,119,119,51,81,55,51,55,51,81,119,51,55,51,17,121,55,119,115,19,85,81,121,119,119,55,81,21,85,85,21,21,119,115,115,55,81,119,119,115,55,17,55,119,55,55,17,57,115,55,51,19,85,
+81,121,115,55,51,81,153,153,121,119,85,119,119,119,51,81,55,55,55,51,81,119,55,119,51,17,119,119,115,119,19,85,81,57,55,115,51,17,153,55,55,55,81,55,119,51,55,17,119,119,119,55,81,55,115,51,55,17,55,115,115,51,19,85,
+81,153,119,119,51,81,57,115,115,51,17,119,51,55,51,81,119,115,119,51,81,119,55,115,51,17,119,55,55,119,19,85,81,119,51,51,55,81,121,119,119,51,81,119,119,55,55,81,119,119,119,55,81,55,119,119,55,17,55,119,51,51,19,81,
+81,151,119,119,51,81,121,119,51,51,81,55,51,115,51,81,55,115,55,51,81,119,51,55,51,81,119,51,55,115,19,85,81,119,51,55,55,81,121,51,119,51,81,119,51,51,51,81,119,55,115,55,17,119,119,55,55,81,55,55,115,51,19,85,
+81,55,51,51,51,81,121,119,55,55,81,55,51,51,51,81,55,119,115,55,81,55,51,51,51,81,119,55,51,119,19,85,17,21,17,17,17,17,121,55,115,51,81,21,17,17,17,17,119,51,55,51,17,21,17,17,17,81,55,115,119,51,19,85,
+49,72,20,55,51,129,67,84,55,55,49,56,19,55,51,16,113,51,19,119,51,113,51,19,119,51,113,51,19,55,51,16,113,51,19,51,51,113,51,19,55,51,113,115,19,55,51,16,113,55,19,51,51,113,51,19,55,51,113,51,19,51,51,16,
+113,51,19,119,51,113,51,19,55,51,113,51,19,51,51,80,113,51,19,51,51,113,51,19,3,0,113,51,19,55,51,80,49,0,16,119,51,113,55,19,17,85,49,51,35,51,51,80,81,85,17,51,51,113,55,35,119,55,49,51,19,51,51,16,
+113,119,19,17,17,113,51,19,55,51,49,51,19,51,51,80,113,119,19,136,72,113,51,19,55,51,49,51,19,17,17,81,113,55,19,55,51,113,55,19,55,51,113,51,19,136,136,84,113,51,19,55,51,49,51,19,55,55,49,51,19,55,51,80,
+113,51,19,119,51,113,51,19,119,55,49,51,19,55,51,80,113,51,19,55,51,49,51,19,51,51,113,51,19,55,51,80,113,51,19,55,51,17,17,17,51,51,49,51,19,55,51,80,113,51,19,55,51,129,136,84,119,51,49,51,19,55,51,80,
+113,51,19,55,55,113,51,19,51,51,17,17,17,51,51,80,113,51,19,51,51,113,51,19,51,51,49,136,20,51,51,16,49,0,16,55,51,113,51,19,51,51,113,55,19,55,51,80,17,21,17,55,51,113,115,19,51,51,113,51,19,51,51,16,
+113,55,19,51,51,113,55,19,17,17,113,51,19,51,51,16,113,51,19,55,51,113,51,19,136,72,117,51,19,51,51,16,113,115,19,55,51,49,51,19,55,51,113,51,19,51,51,80,113,51,35,55,51,113,51,19,55,51,49,51,19,3,0,16,
+113,51,19,55,51,49,51,19,119,51,49,51,19,81,21,81,113,51,19,55,51,49,51,19,55,55,114,51,19,119,119,83,113,55,19,3,0,113,51,19,119,51,49,51,19,55,51,16,113,51,19,81,17,113,51,19,51,51,49,51,19,55,51,80,
+113,51,19,121,55,49,55,19,51,51,49,51,19,51,51,80,113,51,19,55,51,113,51,19,55,55,49,51,19,51,51,16,113,51,19,55,51,49,51,19,51,51,113,51,19,51,51,80,49,0,16,55,51,49,0,16,51,51,49,0,16,51,51,80,
+51,112,51,67,51,51,48,19,51,48,51,3,51,51,48,19,51,48,51,3,3,51,48,19,17,49,51,3,67,51,51,19,115,64,52,3,55,51,48,16,51,112,51,3,51,51,48,19,51,112,51,3,51,51,48,19,51,112,19,20,51,48,48,19,
+51,48,51,3,51,65,49,19,17,49,51,3,51,51,48,19,51,48,51,3,68,51,48,19,51,48,51,3,51,51,48,16,51,48,51,3,55,51,48,19,51,16,49,3,51,51,48,19,51,112,51,3,51,51,48,19,51,112,3,0,51,48,48,19,
+51,51,51,51,51,51,51,51,51,51,51,67,51,51,51,51,51,51,51,51,51,51,51,3,51,51,51,51,51,3,51,51,51,51,51,51,51,51,51,51,51,51,3,0,
+
+};
+
+// Runs of equal texels in every texture column (row of the transposed data)
+// Column i has the runs [redbrick_run_offsets[i], redbrick_run_offsets[i + 1]) in redbrick_run_ends
+// Each entry is the exclusive end texel of a run, so a column's last run always ends at 64
+
+constexpr uint16_t redbrick_run_offsets[64 + 1] = {
+0,31,64,102,139,173,216,257,293,335,370,406,435,468,498,526,558,593,628,655,682,716,749,790,827,862,897,937,971,1001,1037,1076,1109,1146,1177,1215,1253,1283,1315,1351,1382,1413,1452,1483,1515,1554,1594,1623,1656,1695,1729,1766,1799,1835,1869,1904,1942,1977,2021,2060,2094,2133,2173,2208,2233,
+
+};
+
+constexpr uint8_t redbrick_run_ends[2233] = {
+1,2,3,12,13,15,16,17,20,21,24,25,32,38,40,41,42,43,46,47,48,49,50,51,52,53,54,56,61,63,64,
+2,7,9,10,11,12,13,19,20,21,22,25,28,29,30,32,34,36,38,40,41,42,49,50,51,52,53,54,56,60,61,62,64,
+1,2,4,5,6,7,8,9,10,12,13,17,20,21,22,23,25,26,27,28,30,31,32,36,38,39,40,41,42,43,49,50,51,52,53,61,63,64,
+1,2,3,4,5,6,7,8,10,12,13,18,20,22,23,27,30,31,32,39,40,42,43,44,46,47,50,52,53,55,56,58,59,60,61,62,64,
+1,2,3,9,10,12,14,15,17,20,22,23,28,30,31,32,35,36,37,40,41,42,43,49,50,51,52,53,54,55,56,61,63,64,
+1,2,4,5,6,7,10,11,12,13,14,15,17,18,20,21,22,23,24,25,30,31,32,33,34,38,40,42,43,45,46,48,50,51,52,53,54,55,57,59,61,63,64,
+1,2,3,6,7,8,10,11,12,16,20,21,22,23,28,30,31,32,34,36,37,38,39,40,42,43,45,46,48,49,50,51,52,54,55,57,58,60,61,63,64,
+1,2,3,8,10,11,12,13,16,19,20,22,23,30,32,36,37,38,40,41,42,43,45,46,48,50,51,52,53,54,55,57,58,61,62,64,
+1,2,4,5,6,10,11,12,16,20,21,22,23,24,25,26,27,28,30,31,32,33,34,38,40,41,42,43,45,46,47,48,49,50,51,52,54,56,59,61,62,64,
+1,2,3,5,6,8,10,12,19,20,22,23,24,25,26,27,30,32,34,40,42,43,44,46,47,49,50,51,52,53,55,56,61,62,64,
+1,2,4,7,8,9,10,12,14,15,17,20,21,22,28,30,32,33,40,42,44,46,47,50,51,52,53,54,55,56,58,59,60,61,62,64,
+1,2,3,4,10,12,13,14,15,17,18,20,21,22,25,26,27,30,32,33,42,49,50,51,52,53,61,62,64,
+1,2,3,10,12,19,20,22,26,27,29,30,31,32,33,41,42,43,45,46,48,49,50,51,52,54,55,56,58,60,61,62,64,
+1,3,12,16,17,18,20,22,26,30,31,33,34,35,36,42,45,46,49,50,51,52,53,55,56,57,58,61,62,64,
+1,8,11,12,14,20,22,29,30,31,32,38,40,42,43,45,46,48,49,50,51,52,55,57,59,61,63,64,
+1,11,12,13,20,22,23,24,26,27,28,30,31,32,33,34,36,37,40,42,49,50,51,52,53,55,57,59,60,61,62,64,
+1,2,6,9,10,13,21,22,25,26,27,30,31,32,33,34,36,37,39,40,42,45,46,47,48,49,50,51,52,55,57,59,61,62,64,
+2,3,7,8,9,10,11,15,17,22,24,25,26,27,29,30,31,32,33,34,35,37,38,39,40,42,43,45,46,50,52,53,61,62,64,
+1,2,3,8,10,11,20,21,22,26,27,28,30,31,32,33,34,35,40,41,42,49,50,51,53,62,64,
+1,2,3,8,10,11,12,18,20,22,24,26,28,30,31,32,33,39,40,41,42,43,45,46,50,51,64,
+1,2,3,7,10,11,12,13,14,15,17,19,20,21,22,26,30,31,32,33,34,35,36,37,38,40,41,42,45,46,48,50,51,64,
+1,2,3,9,10,11,12,13,14,15,17,20,21,22,28,30,31,32,33,34,35,40,41,42,45,46,47,50,51,52,60,61,64,
+1,2,3,4,6,7,10,11,12,14,19,20,21,22,24,25,27,28,29,30,31,32,39,40,41,42,46,47,49,50,51,52,53,54,56,57,59,60,61,62,64,
+1,2,3,8,10,12,13,15,16,20,22,23,24,25,27,28,30,31,32,34,36,38,40,41,42,43,46,47,50,52,53,55,57,59,61,62,64,
+1,2,3,4,6,8,9,10,12,13,18,20,21,22,25,26,27,28,29,30,32,39,40,41,42,49,50,52,53,54,57,58,61,62,64,
+1,2,3,4,5,8,10,12,13,14,16,17,19,20,22,23,24,25,26,30,32,38,40,41,42,43,50,52,53,57,58,60,61,62,64,
+1,2,3,5,10,11,12,13,15,16,17,20,21,22,23,24,25,27,28,30,31,32,33,34,36,37,39,40,41,42,49,50,51,52,53,57,58,61,62,64,
+1,2,3,8,10,11,12,13,19,20,22,23,30,32,34,36,37,40,42,44,46,47,50,51,52,53,54,56,57,59,60,61,62,64,
+1,2,3,5,6,9,10,11,12,13,14,15,16,20,21,23,32,39,40,42,43,44,49,50,51,52,53,61,62,64,
+1,2,3,4,5,6,10,11,12,13,15,17,18,20,21,28,30,32,33,34,35,40,42,43,45,46,50,51,52,53,54,55,60,61,62,64,
+1,2,3,4,5,6,7,8,9,10,12,14,15,17,18,19,20,21,25,26,32,37,38,39,40,41,42,45,47,49,50,51,52,53,54,55,61,62,64,
+1,2,3,6,7,8,10,12,13,14,15,16,20,21,22,29,30,32,39,40,41,42,43,50,52,54,55,57,58,60,61,62,64,
+1,2,3,6,7,10,11,12,13,15,16,18,20,21,22,23,26,27,28,29,30,31,32,33,35,36,40,41,42,51,52,53,54,55,61,62,64,
+1,2,3,6,7,9,10,11,12,13,19,20,22,23,24,25,26,27,30,31,32,39,40,41,45,49,52,60,61,62,64,
+1,2,4,5,6,7,10,11,12,13,15,16,20,21,22,24,26,27,29,30,31,32,34,36,38,40,41,42,43,50,51,52,53,55,56,61,63,64,
+1,2,3,4,10,11,12,15,16,17,18,19,20,21,22,23,24,26,27,30,32,33,34,36,38,39,40,42,49,50,51,52,55,56,59,61,62,64,
+1,2,3,10,11,12,14,20,21,22,23,29,30,31,32,39,40,41,42,43,48,50,51,52,56,59,60,61,62,64,
+1,3,11,12,15,16,19,20,22,23,24,27,28,30,31,32,33,36,37,40,42,43,46,48,49,50,51,52,54,61,62,64,
+1,2,3,6,10,12,14,15,16,20,22,23,28,30,31,32,36,37,38,40,41,42,43,46,47,50,51,52,53,55,57,58,59,61,62,64,
+1,3,4,11,12,19,20,22,23,24,26,28,30,31,32,33,40,42,43,45,46,49,50,51,52,55,58,60,61,63,64,
+1,2,6,10,11,12,17,18,19,20,21,22,23,26,30,31,33,41,42,43,45,46,50,51,52,53,55,58,61,63,64,
+1,2,3,5,7,8,10,11,12,13,14,15,17,18,20,21,22,23,28,30,32,42,43,44,45,47,48,49,50,51,52,55,56,57,58,60,61,62,64,
+1,2,4,8,10,11,12,13,14,15,19,20,21,22,23,24,30,31,35,37,42,43,50,51,52,53,55,56,61,63,64,
+1,2,3,4,10,11,12,13,14,15,20,21,22,29,30,32,39,40,42,43,45,46,48,50,51,52,56,57,60,61,63,64,
+1,2,4,5,8,10,11,12,13,14,18,20,21,22,23,30,31,32,33,36,37,39,40,41,42,43,45,46,48,49,50,51,52,53,56,57,61,62,64,
+1,2,3,8,10,11,12,15,17,19,20,21,22,23,24,27,28,29,30,31,32,33,36,37,40,42,45,46,48,50,51,52,53,54,55,58,60,61,62,64,
+1,2,3,5,10,11,12,14,15,17,20,22,27,30,31,32,33,39,40,41,42,43,50,51,52,53,61,62,64,
+1,2,4,5,9,10,11,12,15,17,18,20,22,24,28,29,30,31,32,33,37,38,40,41,42,46,47,49,50,51,53,63,64,
+1,2,3,4,5,10,11,12,13,14,19,20,21,22,23,24,28,30,31,32,33,37,38,39,40,41,42,44,45,46,50,51,52,53,58,60,61,62,64,
+1,2,4,6,7,8,10,11,12,14,15,16,20,21,22,24,30,31,32,33,36,37,39,40,41,42,43,44,45,46,49,50,51,64,
+1,2,3,6,7,10,11,12,13,14,15,16,19,20,21,22,25,26,29,30,31,32,33,35,39,40,41,42,44,45,46,50,51,52,60,61,64,
+2,4,9,10,11,12,14,20,21,22,23,25,26,30,32,33,39,40,41,42,45,46,49,50,51,52,53,54,56,57,61,62,64,
+2,3,6,7,8,10,11,12,13,20,21,22,28,30,31,32,33,34,36,38,39,40,41,42,43,50,51,52,53,54,56,57,59,61,63,64,
+2,4,8,10,11,13,21,22,25,26,27,28,29,30,31,32,33,36,37,39,40,41,42,49,50,51,52,53,54,57,58,61,62,64,
+1,2,3,5,6,7,10,12,16,18,22,28,30,31,32,33,36,37,40,41,42,44,46,47,50,52,53,55,56,58,59,60,61,62,64,
+1,2,3,9,10,11,13,14,19,20,21,22,24,25,26,27,29,30,31,32,36,37,39,40,42,43,44,47,48,49,50,52,53,55,57,61,62,64,
+1,2,3,4,5,7,10,11,12,17,20,22,28,30,31,32,33,34,35,36,37,40,41,42,45,46,48,50,52,56,57,60,61,62,64,
+1,2,3,4,5,7,8,10,12,14,15,16,17,18,19,20,21,22,23,24,26,28,29,30,32,39,40,41,42,43,45,46,48,49,50,52,53,55,56,57,58,61,62,64,
+1,2,4,8,10,11,12,13,15,16,17,18,20,22,24,26,27,30,31,32,34,35,38,40,41,42,45,47,48,50,52,55,56,57,58,60,61,62,64,
+1,2,4,8,9,10,11,12,13,18,20,21,22,27,28,29,30,31,32,39,40,41,42,43,44,49,50,52,53,54,56,61,63,64,
+1,2,3,4,8,10,11,12,13,16,20,21,22,23,27,28,30,31,32,33,35,37,40,41,42,44,46,47,50,51,52,54,56,57,59,60,61,62,64,
+1,2,4,6,7,8,9,10,11,12,13,14,16,18,20,21,22,24,30,31,32,35,37,39,40,42,47,48,49,50,51,52,53,54,55,57,58,61,62,64,
+1,2,3,10,11,12,13,17,18,19,20,21,22,23,30,31,32,33,34,36,37,39,40,41,42,43,50,51,52,55,58,60,61,62,64,
+2,3,12,13,15,17,18,20,21,23,32,34,36,37,40,42,43,51,52,53,55,58,61,62,64,
 
 };
 
@@ -10,19 +10,114 @@
 #include "mossy.hpp"
 #include "wood.hpp"
 #include "colorstone.hpp"
+#include "barrel.hpp"
 
-constexpr auto num_textures   =  8;
+constexpr auto num_textures   =  9;
 constexpr auto texture_width  = 64;
 constexpr auto texture_height = 64;
+constexpr auto num_texture_mip_levels = 6; // Excluding level 0
 
-constexpr const uint8_t* texture_map[num_textures] = {
-    textures::eagle,
-    textures::redbrick,
-    textures::purplestone,
-    textures::greystone,
-    textures::bluestone,
-    textures::mossy,
-    textures::wood,
-    textures::colorstone,
+// Texels are indices into a palette of rgb233 colors per texture, packed in as few bits as its colors need
+constexpr const uint8_t* texture_palettes_map[num_textures] = {
+    textures::eagle_palette,
+    textures::redbrick_palette,
+    textures::purplestone_palette,
+    textures::greystone_palette,
+    textures::bluestone_palette,
+    textures::mossy_palette,
+    textures::wood_palette,
+    textures::colorstone_palette,
+    textures::barrel_palette,
 };
 
+constexpr int texture_index_bits_map[num_textures] = {
+    textures::eagle_index_bits,
+    textures::redbrick_index_bits,
+    textures::purplestone_index_bits,
+    textures::greystone_index_bits,
+    textures::bluestone_index_bits,
+    textures::mossy_index_bits,
+    textures::wood_index_bits,
+    textures::colorstone_index_bits,
+    textures::barrel_index_bits,
+};
+
+constexpr const uint8_t* texture_texels_map[num_textures] = {
+    textures::eagle_texels,
+    textures::redbrick_texels,
+    textures::purplestone_texels,
+    textures::greystone_texels,
+    textures::bluestone_texels,
+    textures::mossy_texels,
+    textures::wood_texels,
+    textures::colorstone_texels,
+    textures::barrel_texels,
+};
+
+// First texel of mip level (0 to num_texture_mip_levels) of a texture, levels are packed one after the other
+constexpr auto get_texture_mip_offset(int level) -> int
+{
+    auto offset = 0;
+    for (auto i = 0; i < level; i++) offset += (texture_width >> i) * (texture_height >> i);
+    return offset;
+}
+
+// Color of texel i of a texture, counting from the first texel of level 0
+inline auto get_texel(int tex_id, int i) -> uint8_t
+{
+    const auto index_bits = texture_index_bits_map[tex_id];
+    const auto bit = i * index_bits;
+    const auto src = texture_texels_map[tex_id] + (bit >> 3);
+
+    // Indices are at most 8 bits, so they are within two bytes
+    const auto bits = src[0] | (src[1] << 8);
+    return texture_palettes_map[tex_id][(bits >> (bit & 7)) & ((1 << index_bits) - 1)];
+}
+
+// Colors of num_texels texels of a texture from texel first on
+inline auto unpack_texels(int tex_id, int first, int num_texels, uint8_t* dst) -> void
+{
+    const auto index_bits = texture_index_bits_map[tex_id];
+    const auto mask = (1U << index_bits) - 1;
+    const auto palette = texture_palettes_map[tex_id];
+
+    const auto bit = first * index_bits;
+    auto src = texture_texels_map[tex_id] + (bit >> 3);
+    auto bits = static_cast<uint32_t>(*src++) >> (bit & 7);
+    auto num_bits = 8 - (bit & 7);
+    for (auto i = 0; i < num_texels; i++)
+    {
+        if (num_bits < index_bits)
+        {
+            bits |= static_cast<uint32_t>(*src++) << num_bits;
+            num_bits += 8;
+        }
+        dst[i] = palette[bits & mask];
+        bits >>= index_bits;
+        num_bits -= index_bits;
+    }
+}
+
+constexpr const uint16_t* texture_run_offsets_map[num_textures] = {
+    textures::eagle_run_offsets,
+    textures::redbrick_run_offsets,
+    textures::purplestone_run_offsets,
+    textures::greystone_run_offsets,
+    textures::bluestone_run_offsets,
+    textures::mossy_run_offsets,
+    textures::wood_run_offsets,
+    textures::colorstone_run_offsets,
+    textures::barrel_run_offsets,
+};
+
+constexpr const uint8_t* texture_run_ends_map[num_textures] = {
+    textures::eagle_run_ends,
+    textures::redbrick_run_ends,
+    textures::purplestone_run_ends,
+    textures::greystone_run_ends,
+    textures::bluestone_run_ends,
+    textures::mossy_run_ends,
+    textures::wood_run_ends,
+    textures::colorstone_run_ends,
+    textures::barrel_run_ends,
+};
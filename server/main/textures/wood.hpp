@@ -1,78 +1,125 @@
 
 #pragma once
 
-// Generated by generate_texture.py on 2022-09-07T14:50:32.183555
+// Generated by generate_texture.py on 2026-10-16T14:06:50.011174
 
 #include <cstdint>
 
 namespace textures
 {
 
-constexpr uint8_t wood[64 * 64] = {
-72,81,145,72,72,72,72,72,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,
-72,81,145,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,81,81,81,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,72,81,81,
-72,81,145,72,81,81,81,72,72,72,72,72,72,72,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,81,81,81,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,81,
-72,81,145,72,81,81,81,81,81,72,72,72,72,72,72,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,81,81,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,81,
-72,81,145,72,81,81,81,81,81,81,72,72,72,72,72,72,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,81,81,81,81,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,81,
-72,81,145,72,81,81,81,81,81,72,72,72,72,72,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,81,81,81,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,81,
-72,81,145,72,81,81,72,72,72,72,72,72,81,81,81,81,72,72,72,72,72,72,72,72,72,81,81,81,72,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,
-72,81,145,8,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
-72,81,145,72,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,
-72,81,145,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
-72,81,145,8,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
-72,81,145,72,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,
-72,81,145,72,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,72,72,72,72,72,72,81,
-72,81,145,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,81,81,81,81,81,81,72,72,72,72,72,
-72,81,145,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,72,72,72,
-72,81,145,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,72,72,
-72,81,145,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,72,
-72,81,145,72,81,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,72,72,
-72,81,145,72,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,72,72,72,
-72,81,145,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,
-72,81,145,72,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,81,
-72,81,145,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,81,81,
-72,81,145,72,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,
-72,81,145,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,
-72,81,145,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,81,81,
-72,81,145,8,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
-72,81,145,72,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,
-72,81,145,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
-72,81,145,8,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
-72,81,145,72,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,
-72,81,145,72,81,81,81,81,81,81,81,72,72,72,72,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,81,
-72,81,145,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,81,81,72,
-72,81,145,72,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,
-72,81,145,8,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
-72,81,145,72,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,
-72,81,145,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
-72,81,145,8,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
-72,81,145,72,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,
-72,81,145,72,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,81,
-72,81,145,72,72,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,
-72,81,145,72,72,72,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,
-72,81,145,72,72,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,
-72,81,145,72,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,81,
-72,81,145,8,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
-72,81,145,72,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,
-72,81,145,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
-72,81,145,8,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
-72,81,145,72,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,
-72,81,145,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,81,81,
-72,81,145,72,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,
-72,81,145,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,
-72,81,145,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,81,81,
-72,81,145,72,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
-72,81,145,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,
-72,81,145,72,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,
-72,81,145,72,72,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,
-72,81,145,72,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,72,72,72,
-72,81,145,72,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,72,72,72,
-72,81,145,8,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
-72,81,145,72,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,
-72,81,145,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
-72,81,145,8,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
-72,81,145,72,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,
-72,81,145,72,81,81,81,81,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,72,72,72,72,72,72,72,72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,
+// Colors of all levels in rgb233, texels are indices into the palette packed in wood_index_bits each
+constexpr auto wood_index_bits = 2;
+
+constexpr uint8_t wood_palette[4] = {
+8,72,81,145,
+
+};
+
+// Palette indices of the 64x64 texels followed by prefiltered mip levels 1 to 6 (32x32 down to 1x1),
+// box-filtered from the source texture
+// Levels are transposed (stored column by column) and packed least significant bit first, with a byte of padding at the end
+
+constexpr uint8_t wood_texels[1367] = {
+121,85,170,106,85,85,169,86,85,85,169,90,85,85,149,170,121,85,85,170,106,85,85,169,85,85,149,170,90,85,85,165,121,106,85,165,170,86,85,85,106,85,85,169,170,86,85,149,121,170,86,149,170,106,85,85,165,85,85,165,170,170,85,149,
+121,170,90,85,170,90,85,149,106,85,85,169,170,170,85,149,121,170,86,165,170,85,85,169,85,85,149,170,170,86,85,149,121,90,85,170,85,85,169,85,85,85,170,86,85,85,149,170,57,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,
+121,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,121,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+121,170,170,170,106,85,85,85,170,170,90,85,165,170,86,149,121,85,170,170,170,106,85,85,165,170,170,86,85,169,106,85,121,85,165,170,170,170,86,85,85,170,170,90,85,85,170,86,121,85,169,170,170,170,86,85,85,169,170,106,85,85,169,90,
+121,149,170,170,170,170,85,85,85,170,170,106,85,85,165,106,121,170,170,170,90,85,85,85,169,170,170,86,85,85,169,90,121,170,106,85,85,85,85,170,170,170,86,85,85,169,170,86,121,85,85,85,85,165,170,170,106,85,85,85,169,170,106,85,
+121,170,170,170,170,170,86,85,85,85,85,170,170,106,85,149,121,85,85,85,85,85,85,85,165,170,170,170,106,85,85,165,121,170,170,170,170,170,170,170,170,170,106,85,85,85,149,170,121,85,85,85,85,85,85,85,85,85,85,85,85,169,170,170,
+121,85,85,85,85,85,85,85,85,85,85,85,85,85,85,165,57,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,121,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+57,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,121,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,121,170,106,149,170,170,85,85,169,170,170,86,85,170,170,170,121,85,85,170,170,90,85,149,170,170,106,85,165,170,170,106,
+121,170,170,170,170,85,85,170,170,170,85,85,170,170,170,90,57,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,121,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+57,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,121,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,121,170,170,106,85,169,170,170,85,149,170,170,170,86,85,149,121,169,170,170,86,165,170,170,90,85,169,170,170,170,85,85,
+121,165,170,170,90,149,170,170,170,85,149,170,170,170,86,85,121,169,170,170,86,165,170,170,106,85,165,170,170,106,85,85,121,170,170,170,85,169,170,170,86,85,169,170,170,85,85,149,57,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,
+121,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,121,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+121,85,85,85,85,85,85,85,85,85,85,85,85,85,85,165,121,170,170,170,170,170,170,170,170,170,170,170,170,170,170,86,121,85,85,85,85,85,85,85,85,85,85,85,85,85,169,170,121,85,85,85,85,85,85,85,85,85,85,85,85,85,85,165,
+121,170,170,170,170,170,170,170,170,170,170,85,85,85,85,85,121,85,85,85,85,85,85,85,85,169,170,170,170,86,85,85,121,170,170,170,170,170,90,85,85,85,85,169,170,170,85,85,121,85,85,85,170,170,170,170,106,85,85,85,169,170,106,85,
+121,170,170,85,85,85,169,170,170,170,90,85,85,170,170,86,121,170,170,170,170,90,85,169,170,170,170,90,85,85,169,86,57,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,121,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,121,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,121,170,85,85,165,170,86,85,85,170,85,85,85,169,170,170,
+85,101,85,85,85,101,85,149,101,85,90,85,85,149,90,85,165,85,90,85,85,149,90,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,170,86,85,169,86,149,85,85,169,170,85,149,106,85,89,
+85,170,86,85,165,90,85,105,85,85,85,165,86,85,149,86,85,85,85,85,85,165,86,85,85,85,85,85,85,85,85,165,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,106,85,169,86,165,106,
+85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,149,106,149,170,85,169,90,85,149,170,85,170,86,165,106,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,
+85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,149,85,85,85,85,149,90,85,85,85,85,170,86,85,85,169,85,165,90,85,149,170,86,85,89,85,85,85,85,85,85,85,85,5,0,0,0,0,0,0,0,165,85,169,85,165,85,149,170,
+85,85,85,85,85,85,85,85,85,85,85,85,149,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,
+85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,1,0,
+
+};
+
+// Runs of equal texels in every texture column (row of the transposed data)
+// Column i has the runs [wood_run_offsets[i], wood_run_offsets[i + 1]) in wood_run_ends
+// Each entry is the exclusive end texel of a run, so a column's last run always ends at 64
+
+constexpr uint16_t wood_run_offsets[64 + 1] = {
+0,11,22,35,48,61,74,87,92,97,101,106,111,122,132,142,152,162,172,182,190,199,206,213,218,223,228,233,237,242,247,258,268,278,283,288,292,297,302,313,323,333,343,354,359,364,368,373,378,383,389,394,399,405,411,419,427,437,447,452,457,461,466,471,482,
+
+};
+
+constexpr uint8_t wood_run_ends[482] = {
+1,2,3,8,15,25,29,41,46,59,64,
+1,2,3,12,19,29,32,43,50,62,64,
+1,2,3,4,7,14,21,32,35,45,53,63,64,
+1,2,3,4,9,15,23,34,36,46,56,63,64,
+1,2,3,4,10,16,22,31,35,45,56,63,64,
+1,2,3,4,9,14,20,29,32,43,53,63,64,
+1,2,3,4,6,12,16,25,28,40,45,59,64,
+1,2,3,4,64,
+1,2,3,4,64,
+1,2,3,64,
+1,2,3,4,64,
+1,2,3,4,64,
+1,2,3,4,19,32,42,50,57,63,64,
+1,2,3,8,23,34,45,53,59,64,
+1,2,3,10,25,36,46,56,61,64,
+1,2,3,9,25,37,47,57,62,64,
+1,2,3,7,24,36,47,58,63,64,
+1,2,3,4,18,33,45,57,62,64,
+1,2,3,4,11,28,41,53,61,64,
+1,2,3,22,35,49,59,64,
+1,2,3,4,25,44,55,63,64,
+1,2,3,34,51,62,64,
+1,2,3,4,43,59,64,
+1,2,3,53,64,
+1,2,3,62,64,
+1,2,3,4,64,
+1,2,3,4,64,
+1,2,3,64,
+1,2,3,4,64,
+1,2,3,4,64,
+1,2,3,4,11,15,24,33,45,52,64,
+1,2,3,12,22,31,43,50,63,64,
+1,2,3,4,20,28,40,48,62,64,
+1,2,3,4,64,
+1,2,3,4,64,
+1,2,3,64,
+1,2,3,4,64,
+1,2,3,4,64,
+1,2,3,4,15,21,32,39,53,63,64,
+1,2,3,5,17,22,34,41,56,64,
+1,2,3,6,18,23,36,43,57,64,
+1,2,3,5,17,22,35,42,55,64,
+1,2,3,4,16,21,33,41,52,63,64,
+1,2,3,4,64,
+1,2,3,4,64,
+1,2,3,64,
+1,2,3,4,64,
+1,2,3,4,64,
+1,2,3,62,64,
+1,2,3,4,61,64,
+1,2,3,57,64,
+1,2,3,62,64,
+1,2,3,4,44,64,
+1,2,3,37,53,64,
+1,2,3,4,26,45,56,64,
+1,2,3,16,35,49,59,64,
+1,2,3,4,12,25,42,52,61,64,
+1,2,3,4,22,29,46,57,61,64,
+1,2,3,4,64,
+1,2,3,4,64,
+1,2,3,64,
+1,2,3,4,64,
+1,2,3,4,64,
+1,2,3,4,8,18,25,36,40,53,64,
 
 };
 
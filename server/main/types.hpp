@@ -2,6 +2,9 @@
 
 #include <cstdint>
 
+#include "common/codec.hpp"
+#include "common/config.hpp"
+
 struct pose_t
 {
     uint64_t ts   {0};
@@ -28,8 +31,48 @@ struct render_command_t
 
 struct encoded_slice_t
 {
+    int start  {0}; // First column in the frame
     int width  {0};
     int height {0};
-    int size   {0};
+    int size   {0}; // Encoded bytes, set when the slice is encoded without streaming
     uint8_t* buffer {nullptr};
+    uint8_t* end    {nullptr}; // End of the encoded bytes, which streaming may have wrapped to the start of its ring
+    codec::codec_id_t codec {codec::codec_id_t::rle};
+};
+
+// Billboard standing on the floor, always facing the camera
+struct sprite_t
+{
+    float pos_x {0};
+    float pos_y {0};
+    float size  {1}; // Width and height in world units
+    int tex_id  {0};
+};
+
+struct ray_hit_t
+{
+    float dist {0};
+    int cell {0};
+    bool is_front_side {true};
+    int map_x {0}; // Cell that was hit
+    int map_y {0};
+};
+
+enum class floor_mode_t
+{
+    flat,
+    floor,
+    floor_ceiling,
+};
+
+struct render_options_t
+{
+    int ray_packet_size {config::server::ray_packet_size};
+    bool use_mipmaps {config::server::use_mipmaps};
+    bool use_fixed_point {config::server::use_fixed_point};
+    floor_mode_t floor_mode {static_cast<floor_mode_t>(config::server::floor_mode)};
+    bool use_sprites {config::server::use_sprites};
+    bool use_distance_field {config::server::use_distance_field};
+    bool use_wall_coherence {config::server::use_wall_coherence};
+    bool use_column_matches {config::server::use_column_matches};
 };